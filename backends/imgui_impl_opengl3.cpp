@@ -15,6 +15,8 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026-10-19: OpenGL: Upload font atlas as a single-channel GL_R8 texture with texture swizzle when it has no colored pixels (Desktop GL 3.3+, ES 3.0. Not on WebGL which lacks swizzle).
+//  2026-10-19: OpenGL: Upload regions listed in ImFontAtlas::TexDirtyRects[] with glTexSubImage2D() on NewFrame(). Added ImGui_ImplOpenGL3_UpdateFontsTexture().
 //  2022-XX-XX: Platform: Added support for multiple windows via the ImGuiPlatformIO interface.
 //  2021-12-15: OpenGL: Using buffer orphaning + glBufferSubData(), seems to fix leaks with multi-viewports with some Intel HD drivers.
 //  2021-08-23: OpenGL: Fixed ES 3.0 shader ("#version 300 es") use normal precision floats to avoid wobbly rendering at HD resolutions.
@@ -173,6 +175,12 @@
 #define IMGUI_IMPL_OPENGL_MAY_HAVE_PRIMITIVE_RESTART
 #endif
 
+// Desktop GL 3.3+ and GL ES 3.0 have texture swizzle, which we use to sample single-channel font textures as (1,1,1,R)
+// WebGL 2 doesn't support GL_TEXTURE_SWIZZLE_XXX: we keep uploading the font texture as RGBA there.
+#if !defined(IMGUI_IMPL_OPENGL_ES2) && (defined(IMGUI_IMPL_OPENGL_ES3) || defined(GL_VERSION_3_3)) && !defined(__EMSCRIPTEN__)
+#define IMGUI_IMPL_OPENGL_MAY_HAVE_TEXTURE_SWIZZLE
+#endif
+
 // Desktop GL use extension detection
 #if !defined(IMGUI_IMPL_OPENGL_ES2) && !defined(IMGUI_IMPL_OPENGL_ES3)
 #define IMGUI_IMPL_OPENGL_MAY_HAVE_EXTENSIONS
@@ -184,6 +192,9 @@ struct ImGui_ImplOpenGL3_Data
     GLuint          GlVersion;               // Extracted at runtime using GL_MAJOR_VERSION, GL_MINOR_VERSION queries (e.g. 320 for GL 3.2)
     char            GlslVersionString[32];   // Specified by user or detected based on compile time GL settings.
     GLuint          FontTexture;
+    int             FontTextureWidth;        // Size of FontTexture, to detect atlas rebuilds with a different size
+    int             FontTextureHeight;
+    bool            FontTextureIsAlpha8;     // FontTexture was created as a single-channel GL_R8 texture
     GLuint          ShaderHandle;
     GLint           AttribLocationTex;       // Uniforms location
     GLint           AttribLocationProjMtx;
@@ -194,6 +205,7 @@ struct ImGui_ImplOpenGL3_Data
     GLsizeiptr      VertexBufferSize;
     GLsizeiptr      IndexBufferSize;
     bool            HasClipOrigin;
+    bool            HasTextureSwizzle;
 
     ImGui_ImplOpenGL3_Data() { memset(this, 0, sizeof(*this)); }
 };
@@ -251,6 +263,7 @@ bool    ImGui_ImplOpenGL3_Init(const char* glsl_version)
         io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
 #endif
     io.BackendFlags |= ImGuiBackendFlags_RendererHasViewports;  // We can create multi-viewports on the Renderer side (optional)
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasTexUpdates; // We can upload modified regions of the font atlas (optional)
 
     // Store GLSL version string so we can refer to it later in case we recreate shaders.
     // Note: GLSL version is NOT the same as GL version. Leave this to NULL if unsure.
@@ -277,6 +290,11 @@ bool    ImGui_ImplOpenGL3_Init(const char* glsl_version)
 
     // Detect extensions we support
     bd->HasClipOrigin = (bd->GlVersion >= 450);
+#if defined(IMGUI_IMPL_OPENGL_MAY_HAVE_TEXTURE_SWIZZLE) && defined(IMGUI_IMPL_OPENGL_ES3)
+    bd->HasTextureSwizzle = true;
+#elif defined(IMGUI_IMPL_OPENGL_MAY_HAVE_TEXTURE_SWIZZLE)
+    bd->HasTextureSwizzle = (bd->GlVersion >= 330);
+#endif
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_EXTENSIONS
     GLint num_extensions = 0;
     glGetIntegerv(GL_NUM_EXTENSIONS, &num_extensions);
@@ -314,6 +332,8 @@ void    ImGui_ImplOpenGL3_NewFrame()
 
     if (!bd->ShaderHandle)
         ImGui_ImplOpenGL3_CreateDeviceObjects();
+    else if (ImGui::GetIO().Fonts->IsTexDirty())
+        ImGui_ImplOpenGL3_UpdateFontsTexture();
 }
 
 static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_width, int fb_height, GLuint vertex_array_object)
@@ -539,6 +559,21 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
     (void)bd; // Not all compilation paths use this
 }
 
+// Retrieve font atlas pixels in the format we want to upload them.
+// - We use a single-channel texture (1 byte per texel instead of 4) unless the atlas is known to contain colored pixels:
+//   either TexPixelsUseColors is set, or the RGBA32 data was already requested (e.g. to render colored custom rectangles).
+// - Texture swizzle expands the red channel as (1,1,1,R) so the same shader keeps working with user's RGBA textures.
+static void ImGui_ImplOpenGL3_GetFontsTexData(unsigned char** out_pixels, int* out_width, int* out_height, bool* out_is_alpha8)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+    *out_is_alpha8 = bd->HasTextureSwizzle && !atlas->TexPixelsUseColors && atlas->TexPixelsRGBA32 == NULL;
+    if (*out_is_alpha8)
+        atlas->GetTexDataAsAlpha8(out_pixels, out_width, out_height);
+    else
+        atlas->GetTexDataAsRGBA32(out_pixels, out_width, out_height);   // Load as RGBA 32-bit (75% of the memory is wasted) when we cannot use swizzle or when the atlas has colors.
+}
+
 bool ImGui_ImplOpenGL3_CreateFontsTexture()
 {
     ImGuiIO& io = ImGui::GetIO();
@@ -547,7 +582,8 @@ bool ImGui_ImplOpenGL3_CreateFontsTexture()
     // Build texture atlas
     unsigned char* pixels;
     int width, height;
-    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);   // Load as RGBA 32-bit (75% of the memory is wasted, but default font is so small) because it is more likely to be compatible with user's existing shaders. If your ImTextureId represent a higher-level concept than just a GL texture id, consider calling GetTexDataAsAlpha8() instead to save on GPU memory.
+    bool is_alpha8;
+    ImGui_ImplOpenGL3_GetFontsTexData(&pixels, &width, &height, &is_alpha8);
 
     // Upload texture to graphics system
     GLint last_texture;
@@ -559,10 +595,90 @@ bool ImGui_ImplOpenGL3_CreateFontsTexture()
 #ifdef GL_UNPACK_ROW_LENGTH // Not on WebGL/ES
     glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
 #endif
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_TEXTURE_SWIZZLE
+    if (is_alpha8)
+    {
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_R, GL_ONE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_G, GL_ONE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_B, GL_ONE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_A, GL_RED);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, width, height, 0, GL_RED, GL_UNSIGNED_BYTE, pixels);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    }
+    else
+#endif
+    {
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+    }
+    bd->FontTextureWidth = width;
+    bd->FontTextureHeight = height;
+    bd->FontTextureIsAlpha8 = is_alpha8;
 
     // Store our identifier
     io.Fonts->SetTexID((ImTextureID)(intptr_t)bd->FontTexture);
+    io.Fonts->ClearTexDirtyRects();
+
+    // Restore state
+    glBindTexture(GL_TEXTURE_2D, last_texture);
+
+    return true;
+}
+
+// Upload regions of the atlas modified since the texture was created (see ImFontAtlas::MarkTexDirty()).
+// If the atlas was rebuilt with a different size or now requires a different format we need to recreate the texture.
+bool ImGui_ImplOpenGL3_UpdateFontsTexture()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    ImFontAtlas* atlas = io.Fonts;
+    if (!atlas->IsTexDirty())
+        return true;
+
+    unsigned char* pixels;
+    int width, height;
+    bool is_alpha8;
+    ImGui_ImplOpenGL3_GetFontsTexData(&pixels, &width, &height, &is_alpha8);
+    if (bd->FontTexture == 0 || bd->FontTextureWidth != width || bd->FontTextureHeight != height || bd->FontTextureIsAlpha8 != is_alpha8)
+    {
+        ImGui_ImplOpenGL3_DestroyFontsTexture();
+        return ImGui_ImplOpenGL3_CreateFontsTexture();
+    }
+
+    GLint last_texture;
+    glGetIntegerv(GL_TEXTURE_BINDING_2D, &last_texture);
+    glBindTexture(GL_TEXTURE_2D, bd->FontTexture);
+    GLenum format = GL_RGBA;
+    int bytes_per_pixel = 4;
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_TEXTURE_SWIZZLE
+    if (is_alpha8)
+    {
+        format = GL_RED;
+        bytes_per_pixel = 1;
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    }
+#endif
+    for (int n = 0; n < atlas->TexDirtyRects.Size; n++)
+    {
+        const ImFontAtlasDirtyRect& r = atlas->TexDirtyRects[n];
+#ifdef GL_UNPACK_ROW_LENGTH // Not on WebGL/ES
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, width);
+        glPixelStorei(GL_UNPACK_SKIP_PIXELS, r.X);
+        glPixelStorei(GL_UNPACK_SKIP_ROWS, r.Y);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, r.X, r.Y, r.Width, r.Height, format, GL_UNSIGNED_BYTE, pixels);
+#else
+        // Without GL_UNPACK_ROW_LENGTH we can only upload full rows
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, r.Y, width, r.Height, format, GL_UNSIGNED_BYTE, pixels + (size_t)r.Y * width * bytes_per_pixel);
+#endif
+    }
+#ifdef GL_UNPACK_ROW_LENGTH
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+    glPixelStorei(GL_UNPACK_SKIP_PIXELS, 0);
+    glPixelStorei(GL_UNPACK_SKIP_ROWS, 0);
+#endif
+    if (bytes_per_pixel == 1)
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    atlas->ClearTexDirtyRects();
 
     // Restore state
     glBindTexture(GL_TEXTURE_2D, last_texture);
@@ -31,6 +31,8 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026-10-19: Vulkan: Upload font atlas as a single-channel VK_FORMAT_R8_UNORM image, swizzled as (1,1,1,R) by the image view, when it has no colored pixels.
+//  2026-10-19: Vulkan: Added ImGui_ImplVulkan_UpdateFontsTexture() to upload regions listed in ImFontAtlas::TexDirtyRects[] with a buffer-to-image copy per region.
 //  2022-XX-XX: Platform: Added support for multiple windows via the ImGuiPlatformIO interface.
 //  2021-10-15: Vulkan: Call vkCmdSetScissor() at the end of render a full-viewport to reduce likehood of issues with people using VK_DYNAMIC_STATE_SCISSOR in their app without calling vkCmdSetScissor() explicitly every frame.
 //  2021-06-29: Reorganized backend to pull data from a single structure to facilitate usage with multiple-contexts (all g_XXXX access changed to bd->XXXX).
@@ -124,8 +126,12 @@ struct ImGui_ImplVulkan_Data
     VkImage                     FontImage;
     VkImageView                 FontView;
     VkDescriptorSet             FontDescriptorSet;
+    int                         FontImageWidth;     // Size of FontImage, to detect atlas rebuilds with a different size
+    int                         FontImageHeight;
+    bool                        FontImageIsAlpha8;  // FontImage was created as a single-channel VK_FORMAT_R8_UNORM image
     VkDeviceMemory              UploadBufferMemory;
     VkBuffer                    UploadBuffer;
+    VkDeviceSize                UploadBufferSize;
 
     // Render buffers for main window
     ImGui_ImplVulkanH_WindowRenderBuffers MainWindowRenderBuffers;
@@ -602,6 +608,52 @@ void ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_data, VkCommandBuffer comm
     vkCmdSetScissor(command_buffer, 0, 1, &scissor);
 }
 
+// Create or grow the staging buffer used to upload font atlas pixels.
+// The previous upload (if any) needs to have been completed by the GPU.
+static void ImGui_ImplVulkan_CreateFontUploadBuffer(VkDeviceSize upload_size)
+{
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    ImGui_ImplVulkan_InitInfo* v = &bd->VulkanInitInfo;
+    if (bd->UploadBuffer != VK_NULL_HANDLE && bd->UploadBufferSize >= upload_size)
+        return;
+    ImGui_ImplVulkan_DestroyFontUploadObjects();
+
+    VkResult err;
+    VkBufferCreateInfo buffer_info = {};
+    buffer_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    buffer_info.size = upload_size;
+    buffer_info.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+    buffer_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    err = vkCreateBuffer(v->Device, &buffer_info, v->Allocator, &bd->UploadBuffer);
+    check_vk_result(err);
+    VkMemoryRequirements req;
+    vkGetBufferMemoryRequirements(v->Device, bd->UploadBuffer, &req);
+    bd->BufferMemoryAlignment = (bd->BufferMemoryAlignment > req.alignment) ? bd->BufferMemoryAlignment : req.alignment;
+    VkMemoryAllocateInfo alloc_info = {};
+    alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    alloc_info.allocationSize = req.size;
+    alloc_info.memoryTypeIndex = ImGui_ImplVulkan_MemoryType(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, req.memoryTypeBits);
+    err = vkAllocateMemory(v->Device, &alloc_info, v->Allocator, &bd->UploadBufferMemory);
+    check_vk_result(err);
+    err = vkBindBufferMemory(v->Device, bd->UploadBuffer, bd->UploadBufferMemory, 0);
+    check_vk_result(err);
+    bd->UploadBufferSize = upload_size;
+}
+
+// Retrieve font atlas pixels in the format we want to upload them.
+// - We use a single-channel image (1 byte per texel instead of 4) unless the atlas is known to contain colored pixels:
+//   either TexPixelsUseColors is set, or the RGBA32 data was already requested (e.g. to render colored custom rectangles).
+// - The image view swizzles the red channel as (1,1,1,R) so the same shader keeps working with user's RGBA textures.
+static void ImGui_ImplVulkan_GetFontsTexData(unsigned char** out_pixels, int* out_width, int* out_height, bool* out_is_alpha8)
+{
+    ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+    *out_is_alpha8 = !atlas->TexPixelsUseColors && atlas->TexPixelsRGBA32 == NULL;
+    if (*out_is_alpha8)
+        atlas->GetTexDataAsAlpha8(out_pixels, out_width, out_height);
+    else
+        atlas->GetTexDataAsRGBA32(out_pixels, out_width, out_height);
+}
+
 bool ImGui_ImplVulkan_CreateFontsTexture(VkCommandBuffer command_buffer)
 {
     ImGuiIO& io = ImGui::GetIO();
@@ -610,8 +662,10 @@ bool ImGui_ImplVulkan_CreateFontsTexture(VkCommandBuffer command_buffer)
 
     unsigned char* pixels;
     int width, height;
-    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
-    size_t upload_size = width * height * 4 * sizeof(char);
+    bool is_alpha8;
+    ImGui_ImplVulkan_GetFontsTexData(&pixels, &width, &height, &is_alpha8);
+    const VkFormat format = is_alpha8 ? VK_FORMAT_R8_UNORM : VK_FORMAT_R8G8B8A8_UNORM;
+    size_t upload_size = width * height * (is_alpha8 ? 1 : 4) * sizeof(char);
 
     VkResult err;
 
@@ -620,7 +674,7 @@ bool ImGui_ImplVulkan_CreateFontsTexture(VkCommandBuffer command_buffer)
         VkImageCreateInfo info = {};
         info.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
         info.imageType = VK_IMAGE_TYPE_2D;
-        info.format = VK_FORMAT_R8G8B8A8_UNORM;
+        info.format = format;
         info.extent.width = width;
         info.extent.height = height;
         info.extent.depth = 1;
@@ -651,7 +705,14 @@ bool ImGui_ImplVulkan_CreateFontsTexture(VkCommandBuffer command_buffer)
         info.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
         info.image = bd->FontImage;
         info.viewType = VK_IMAGE_VIEW_TYPE_2D;
-        info.format = VK_FORMAT_R8G8B8A8_UNORM;
+        info.format = format;
+        if (is_alpha8)
+        {
+            info.components.r = VK_COMPONENT_SWIZZLE_ONE;
+            info.components.g = VK_COMPONENT_SWIZZLE_ONE;
+            info.components.b = VK_COMPONENT_SWIZZLE_ONE;
+            info.components.a = VK_COMPONENT_SWIZZLE_R;
+        }
         info.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
         info.subresourceRange.levelCount = 1;
         info.subresourceRange.layerCount = 1;
@@ -663,26 +724,7 @@ bool ImGui_ImplVulkan_CreateFontsTexture(VkCommandBuffer command_buffer)
     bd->FontDescriptorSet = (VkDescriptorSet)ImGui_ImplVulkan_AddTexture(bd->FontSampler, bd->FontView, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
 
     // Create the Upload Buffer:
-    {
-        VkBufferCreateInfo buffer_info = {};
-        buffer_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
-        buffer_info.size = upload_size;
-        buffer_info.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
-        buffer_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
-        err = vkCreateBuffer(v->Device, &buffer_info, v->Allocator, &bd->UploadBuffer);
-        check_vk_result(err);
-        VkMemoryRequirements req;
-        vkGetBufferMemoryRequirements(v->Device, bd->UploadBuffer, &req);
-        bd->BufferMemoryAlignment = (bd->BufferMemoryAlignment > req.alignment) ? bd->BufferMemoryAlignment : req.alignment;
-        VkMemoryAllocateInfo alloc_info = {};
-        alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-        alloc_info.allocationSize = req.size;
-        alloc_info.memoryTypeIndex = ImGui_ImplVulkan_MemoryType(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, req.memoryTypeBits);
-        err = vkAllocateMemory(v->Device, &alloc_info, v->Allocator, &bd->UploadBufferMemory);
-        check_vk_result(err);
-        err = vkBindBufferMemory(v->Device, bd->UploadBuffer, bd->UploadBufferMemory, 0);
-        check_vk_result(err);
-    }
+    ImGui_ImplVulkan_CreateFontUploadBuffer(upload_size);
 
     // Upload to Buffer:
     {
@@ -739,7 +781,112 @@ bool ImGui_ImplVulkan_CreateFontsTexture(VkCommandBuffer command_buffer)
 
     // Store our identifier
     io.Fonts->SetTexID((ImTextureID)bd->FontDescriptorSet);
+    io.Fonts->ClearTexDirtyRects();
+    bd->FontImageWidth = width;
+    bd->FontImageHeight = height;
+    bd->FontImageIsAlpha8 = is_alpha8;
+
+    return true;
+}
+
+// Record the upload of regions of the atlas modified since the texture was created (see ImFontAtlas::MarkTexDirty()).
+// - Each dirty region is packed into the upload buffer and copied with its own VkBufferImageCopy region.
+// - Same as ImGui_ImplVulkan_CreateFontsTexture(): submit the command buffer, then call ImGui_ImplVulkan_DestroyFontUploadObjects()
+//   (or leave the upload buffer alive to be reused) once the GPU is done with it, before calling this again.
+// - Return false if the atlas was rebuilt with a different size or now requires a different format: in that case the texture needs to be recreated.
+bool ImGui_ImplVulkan_UpdateFontsTexture(VkCommandBuffer command_buffer)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    ImGui_ImplVulkan_InitInfo* v = &bd->VulkanInitInfo;
+    ImFontAtlas* atlas = io.Fonts;
+    if (!atlas->IsTexDirty())
+        return true;
+
+    unsigned char* pixels;
+    int width, height;
+    bool is_alpha8;
+    ImGui_ImplVulkan_GetFontsTexData(&pixels, &width, &height, &is_alpha8);
+    if (bd->FontImage == VK_NULL_HANDLE || bd->FontImageWidth != width || bd->FontImageHeight != height || bd->FontImageIsAlpha8 != is_alpha8)
+        return false;
+
+    const int bytes_per_pixel = is_alpha8 ? 1 : 4;
+    VkDeviceSize upload_size = 0;
+    for (int n = 0; n < atlas->TexDirtyRects.Size; n++)
+        upload_size += (VkDeviceSize)atlas->TexDirtyRects[n].Width * atlas->TexDirtyRects[n].Height * bytes_per_pixel;
+    ImGui_ImplVulkan_CreateFontUploadBuffer(upload_size);
+
+    // Pack dirty regions into the upload buffer
+    VkResult err;
+    ImVector<VkBufferImageCopy> regions;
+    regions.resize(atlas->TexDirtyRects.Size);
+    {
+        char* map = NULL;
+        err = vkMapMemory(v->Device, bd->UploadBufferMemory, 0, upload_size, 0, (void**)(&map));
+        check_vk_result(err);
+        VkDeviceSize offset = 0;
+        for (int n = 0; n < atlas->TexDirtyRects.Size; n++)
+        {
+            const ImFontAtlasDirtyRect& r = atlas->TexDirtyRects[n];
+            const size_t row_size = (size_t)r.Width * bytes_per_pixel;
+            for (int y = 0; y < r.Height; y++)
+                memcpy(map + offset + y * row_size, pixels + ((size_t)(r.Y + y) * width + r.X) * bytes_per_pixel, row_size);
+
+            VkBufferImageCopy& region = regions[n];
+            memset(&region, 0, sizeof(region));
+            region.bufferOffset = offset;
+            region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+            region.imageSubresource.layerCount = 1;
+            region.imageOffset.x = r.X;
+            region.imageOffset.y = r.Y;
+            region.imageExtent.width = r.Width;
+            region.imageExtent.height = r.Height;
+            region.imageExtent.depth = 1;
+            offset += row_size * r.Height;
+        }
+        VkMappedMemoryRange range[1] = {};
+        range[0].sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+        range[0].memory = bd->UploadBufferMemory;
+        range[0].size = VK_WHOLE_SIZE;
+        err = vkFlushMappedMemoryRanges(v->Device, 1, range);
+        check_vk_result(err);
+        vkUnmapMemory(v->Device, bd->UploadBufferMemory);
+    }
+
+    // Copy to Image: contents outside of the dirty regions are preserved as we transition from the SHADER_READ_ONLY_OPTIMAL layout.
+    {
+        VkImageMemoryBarrier copy_barrier[1] = {};
+        copy_barrier[0].sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        copy_barrier[0].srcAccessMask = VK_ACCESS_SHADER_READ_BIT;
+        copy_barrier[0].dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        copy_barrier[0].oldLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        copy_barrier[0].newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        copy_barrier[0].srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        copy_barrier[0].dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        copy_barrier[0].image = bd->FontImage;
+        copy_barrier[0].subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        copy_barrier[0].subresourceRange.levelCount = 1;
+        copy_barrier[0].subresourceRange.layerCount = 1;
+        vkCmdPipelineBarrier(command_buffer, VK_PIPELINE_STAGE_HOST_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, NULL, 0, NULL, 1, copy_barrier);
+
+        vkCmdCopyBufferToImage(command_buffer, bd->UploadBuffer, bd->FontImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, (uint32_t)regions.Size, regions.Data);
+
+        VkImageMemoryBarrier use_barrier[1] = {};
+        use_barrier[0].sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        use_barrier[0].srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        use_barrier[0].dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+        use_barrier[0].oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        use_barrier[0].newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        use_barrier[0].srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        use_barrier[0].dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        use_barrier[0].image = bd->FontImage;
+        use_barrier[0].subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        use_barrier[0].subresourceRange.levelCount = 1;
+        use_barrier[0].subresourceRange.layerCount = 1;
+        vkCmdPipelineBarrier(command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, 0, NULL, 0, NULL, 1, use_barrier);
+    }
 
+    atlas->ClearTexDirtyRects();
     return true;
 }
 
@@ -1014,6 +1161,7 @@ void    ImGui_ImplVulkan_DestroyFontUploadObjects()
         vkFreeMemory(v->Device, bd->UploadBufferMemory, v->Allocator);
         bd->UploadBufferMemory = VK_NULL_HANDLE;
     }
+    bd->UploadBufferSize = 0;
 }
 
 void    ImGui_ImplVulkan_DestroyDeviceObjects()
@@ -1067,6 +1215,7 @@ bool    ImGui_ImplVulkan_Init(ImGui_ImplVulkan_InitInfo* info, VkRenderPass rend
     io.BackendRendererUserData = (void*)bd;
     io.BackendRendererName = "imgui_impl_vulkan";
     io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasTexUpdates; // We can upload modified regions of the font atlas with ImGui_ImplVulkan_UpdateFontsTexture() (optional)
     io.BackendFlags |= ImGuiBackendFlags_RendererHasViewports;  // We can create multi-viewports on the Renderer side (optional)
 
     IM_ASSERT(info->Instance != VK_NULL_HANDLE);
@@ -397,6 +397,15 @@ int main(int, char**)
     while (!done)
     {
         toggleFullscreen = false;
+
+        // Idle: when Dear ImGui doesn't need a new frame, sleep until a message arrives or until io.WantRedrawDelay elapses.
+        // Gamepads are polled by the backend and don't generate messages, so we keep polling them at a low rate.
+        float wait_time = io.WantRedrawDelay;
+        if ((io.ConfigFlags & ImGuiConfigFlags_NavEnableGamepad) && (io.BackendFlags & ImGuiBackendFlags_HasGamepad))
+            wait_time = ImMin(wait_time, 0.10f);
+        if (wait_time > 0.0f)
+            ::MsgWaitForMultipleObjects(0, nullptr, FALSE, (wait_time == FLT_MAX) ? INFINITE : (DWORD)(wait_time * 1000.0f), QS_ALLINPUT);
+
         // Poll and handle messages (inputs, window resize, etc.)
         // See the WndProc() function below for our to dispatch events to the Win32 backend.
         MSG msg;
@@ -46,8 +46,13 @@
 //#define IMGUI_DISABLE_DEFAULT_MATH_FUNCTIONS              // Don't implement ImFabs/ImSqrt/ImPow/ImFmod/ImCos/ImSin/ImAcos/ImAtan2 so you can implement them yourself.
 //#define IMGUI_DISABLE_FILE_FUNCTIONS                      // Don't implement ImFileOpen/ImFileClose/ImFileRead/ImFileWrite and ImFileHandle at all (replace them with dummies)
 //#define IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS              // Don't implement ImFileOpen/ImFileClose/ImFileRead/ImFileWrite and ImFileHandle so you can implement them yourself if you don't want to link with fopen/fclose/fread/fwrite. This will also disable the LogToTTY() function.
+//#define IMGUI_ENABLE_THREAD_LOCAL_CONTEXT                 // Make the current context pointer thread_local, so different threads can use different contexts concurrently (C++11, not for DLL builds). Read comments about GImGui in imgui.cpp.
 //#define IMGUI_DISABLE_DEFAULT_ALLOCATORS                  // Don't implement default allocators calling malloc()/free() to avoid linking with them. You will need to call ImGui::SetAllocatorFunctions().
+//#define IMGUI_ENABLE_FILE_WRITER_THREAD                   // Write .ini settings and LogToFile() output to disk from a background thread (C++11 std::thread, may require linking with -pthread) so saving and logging don't stall the main thread.
+//#define IMGUI_ENABLE_PROFILER                             // Record timings of internal zones (NewFrame, Begin/End per window, tables layout, Render...) into a per-context ring buffer. Displayed in Metrics window, can be exported to Chrome trace JSON.
+//#define IMGUI_ENABLE_MEMORY_TAGS                          // Track live/peak bytes and allocation count per subsystem (see ImGuiMemTag_ in imgui_internal.h, Metrics window). Adds a 32 bytes header to every MemAlloc() allocation.
 //#define IMGUI_DISABLE_SSE                                 // Disable use of SSE intrinsics even if available
+//#define IMGUI_DISABLE_ARM_CRC32                           // Disable use of ARMv8 CRC32 instructions for ImHashData/ImHashStr even if available
 
 //---- Include imgui_user.h at the end of imgui.h as a convenience
 //#define IMGUI_INCLUDE_IMGUI_USER_H
@@ -61,6 +61,7 @@ CODE
 // [SECTION] MISC HELPERS/UTILITIES (Geometry functions)
 // [SECTION] MISC HELPERS/UTILITIES (String, Format, Hash functions)
 // [SECTION] MISC HELPERS/UTILITIES (File functions)
+// [SECTION] MISC HELPERS/UTILITIES (File writer)
 // [SECTION] MISC HELPERS/UTILITIES (ImText* functions)
 // [SECTION] MISC HELPERS/UTILITIES (Color functions)
 // [SECTION] ImGuiStorage
@@ -84,6 +85,7 @@ CODE
 // [SECTION] VIEWPORTS, PLATFORM WINDOWS
 // [SECTION] DOCKING
 // [SECTION] PLATFORM DEPENDENT HELPERS
+// [SECTION] PROFILER
 // [SECTION] METRICS/DEBUGGER WINDOW
 // [SECTION] OTHER DEBUG TOOLS (ITEM PICKER, STACK TOOL)
 
@@ -865,6 +867,11 @@ CODE
 #include <TargetConditionals.h>
 #endif
 
+// [Profiler] Timer (see ProfilerGetTimeNs())
+#if defined(IMGUI_ENABLE_PROFILER) && (!defined(_WIN32) || defined(IMGUI_DISABLE_WIN32_FUNCTIONS))
+#include <time.h>           // clock_gettime
+#endif
+
 // Visual Studio warnings
 #ifdef _MSC_VER
 #pragma warning (disable: 4127)             // condition expression is constant
@@ -931,11 +938,14 @@ static const float DOCKING_SPLITTER_SIZE                    = 2.0f;
 
 static void             SetCurrentWindow(ImGuiWindow* window);
 static void             FindHoveredWindow();
+static void             UpdateWindowHoverGrid(ImGuiWindow* window);
 static ImGuiWindow*     CreateNewWindow(const char* name, ImGuiWindowFlags flags);
 static ImVec2           CalcNextScrollFromScrollTargetAndClamp(ImGuiWindow* window);
 
 static void             AddDrawListToDrawData(ImVector<ImDrawList*>* out_list, ImDrawList* draw_list);
 static void             AddWindowToSortBuffer(ImVector<ImGuiWindow*>* out_sorted_windows, ImGuiWindow* window);
+static void             AddChildWindowToParent(ImGuiWindow* parent_window, ImGuiWindow* window);
+static void             BuildWindowsDisplayOrder(ImVector<ImGuiWindow*>* out_sorted_windows);
 
 // Settings
 static void             WindowSettingsHandler_ClearAll(ImGuiContext*, ImGuiSettingsHandler*);
@@ -943,12 +953,18 @@ static void*            WindowSettingsHandler_ReadOpen(ImGuiContext*, ImGuiSetti
 static void             WindowSettingsHandler_ReadLine(ImGuiContext*, ImGuiSettingsHandler*, void* entry, const char* line);
 static void             WindowSettingsHandler_ApplyAll(ImGuiContext*, ImGuiSettingsHandler*);
 static void             WindowSettingsHandler_WriteAll(ImGuiContext*, ImGuiSettingsHandler*, ImGuiTextBuffer* buf);
+static void             WindowSettingsHandler_ReadAllBinary(ImGuiContext*, ImGuiSettingsHandler*, ImGuiSettingsBinaryReader* reader);
+static void             WindowSettingsHandler_WriteAllBinary(ImGuiContext*, ImGuiSettingsHandler*, ImGuiSettingsBinaryWriter* writer);
 
 // Platform Dependents default implementation for IO functions
 static const char*      GetClipboardTextFn_DefaultImpl(void* user_data);
 static void             SetClipboardTextFn_DefaultImpl(void* user_data, const char* text);
 static void             SetPlatformImeDataFn_DefaultImpl(ImGuiViewport* viewport, ImGuiPlatformImeData* data);
 
+#ifdef IMGUI_ENABLE_PROFILER
+static void             ProfilerUpdateStats(ImGuiProfiler* profiler, int frame_count);
+#endif
+
 namespace ImGui
 {
 // Navigation
@@ -965,6 +981,9 @@ static void             NavEndFrame();
 static bool             NavScoreItem(ImGuiNavItemData* result);
 static void             NavApplyItemToResult(ImGuiNavItemData* result);
 static void             NavProcessItem();
+static void             NavMoveIndexBeginRequest();
+static void             NavMoveIndexCalcBound();
+static void             NavMoveIndexUpdatePruneRect();
 static void             NavProcessItemForTabbingRequest(ImGuiID id);
 static ImVec2           NavCalcPreferredRefPos();
 static void             NavSaveLastChildNavWindowIntoParent(ImGuiWindow* nav_window);
@@ -1001,6 +1020,7 @@ static void             UpdateDebugToolStackQueries();
 
 // Misc
 static void             UpdateSettings();
+static void             UpdateWantRedrawDelay();
 static void             UpdateKeyboardInputs();
 static void             UpdateMouseInputs();
 static void             UpdateMouseWheel();
@@ -1045,7 +1065,13 @@ static void             UpdateViewportPlatformMonitor(ImGuiViewportP* viewport);
 //   Change to a different context by calling ImGui::SetCurrentContext().
 // - Important: Dear ImGui functions are not thread-safe because of this pointer.
 //   If you want thread-safety to allow N threads to access N different contexts:
-//   - Change this variable to use thread local storage so each thread can refer to a different context, in your imconfig.h:
+//   - Define IMGUI_ENABLE_THREAD_LOCAL_CONTEXT in your imconfig.h (requires C++11, not compatible with DLL builds).
+//     Each thread then has its own current context, and NewFrame()/Render() can run in parallel on different contexts, with restrictions:
+//     - SetAllocatorFunctions() is global: call it before starting other threads, and use thread-safe allocators.
+//     - Don't share an ImFontAtlas between contexts used concurrently (NewFrame()/EndFrame() write to it). Building atlases
+//       concurrently is fine, but GetGlyphRangesChineseFull()/GetGlyphRangesChineseSimplifiedCommon() should be called once from one thread first.
+//     - ShowDemoWindow() uses static variables and is not thread-safe.
+//   - Or change this variable to use thread local storage yourself, in your imconfig.h:
 //         struct ImGuiContext;
 //         extern thread_local ImGuiContext* MyImGuiTLS;
 //         #define GImGui MyImGuiTLS
@@ -1054,8 +1080,12 @@ static void             UpdateViewportPlatformMonitor(ImGuiViewportP* viewport);
 //   - If you need a finite number of contexts, you may compile and use multiple instances of the ImGui code from a different namespace.
 // - DLL users: read comments above.
 #ifndef GImGui
+#ifdef IMGUI_ENABLE_THREAD_LOCAL_CONTEXT
+thread_local ImGuiContext*  GImGui = NULL;
+#else
 ImGuiContext*   GImGui = NULL;
 #endif
+#endif
 
 // Memory Allocator functions. Use SetAllocatorFunctions() to change them.
 // - You probably don't want to modify that mid-program, and if you use global/static e.g. ImVector<> instances you may need to keep them accessible during program destruction.
@@ -1165,6 +1195,7 @@ ImGuiIO::ImGuiIO()
     DeltaTime = 1.0f / 60.0f;
     IniSavingRate = 5.0f;
     IniFilename = "imgui.ini"; // Important: "imgui.ini" is relative to current working dir, most apps will want to lock this to an absolute path (e.g. same path as executables).
+    IniSavingBinary = false;
     LogFilename = "imgui_log.txt";
     MouseDoubleClickTime = 0.30f;
     MouseDoubleClickMaxDist = 6.0f;
@@ -1202,10 +1233,12 @@ ImGuiIO::ImGuiIO()
     ConfigMacOSXBehaviors = false;
 #endif
     ConfigInputTrickleEventQueue = true;
+    ConfigInputCoalesceMouseEvents = false;
     ConfigInputTextCursorBlink = true;
     ConfigWindowsResizeFromEdges = true;
     ConfigWindowsMoveFromTitleBarOnly = false;
     ConfigMemoryCompactTimer = 60.0f;
+    ConfigMemoryCompactBudget = 0;
 
     // Platform Functions
     BackendPlatformName = BackendRendererName = NULL;
@@ -1393,6 +1426,15 @@ void ImGuiIO::AddMousePosEvent(float x, float y)
     ImGuiContext& g = *GImGui;
     IM_ASSERT(&g.IO == this && "Can only add events to current context.");
 
+    // Coalesce with previous event if it is also a mouse move
+    if (ConfigInputCoalesceMouseEvents && g.InputEventsQueue.Size > 0 && g.InputEventsQueue.back().Type == ImGuiInputEventType_MousePos)
+    {
+        ImGuiInputEvent* last_e = &g.InputEventsQueue.back();
+        last_e->MousePos.PosX = x;
+        last_e->MousePos.PosY = y;
+        return;
+    }
+
     ImGuiInputEvent e;
     e.Type = ImGuiInputEventType_MousePos;
     e.Source = ImGuiInputSource_Mouse;
@@ -1423,6 +1465,15 @@ void ImGuiIO::AddMouseWheelEvent(float wheel_x, float wheel_y)
     if (wheel_x == 0.0f && wheel_y == 0.0f)
         return;
 
+    // Coalesce with previous event if it is also a mouse wheel (otherwise trickling processes one wheel event per frame)
+    if (ConfigInputCoalesceMouseEvents && g.InputEventsQueue.Size > 0 && g.InputEventsQueue.back().Type == ImGuiInputEventType_MouseWheel)
+    {
+        ImGuiInputEvent* last_e = &g.InputEventsQueue.back();
+        last_e->MouseWheel.WheelX += wheel_x;
+        last_e->MouseWheel.WheelY += wheel_y;
+        return;
+    }
+
     ImGuiInputEvent e;
     e.Type = ImGuiInputEventType_MouseWheel;
     e.Source = ImGuiInputSource_Mouse;
@@ -1779,9 +1830,20 @@ ImGuiID ImHashData(const void* data_p, size_t data_size, ImU32 seed)
 {
     ImU32 crc = ~seed;
     const unsigned char* data = (const unsigned char*)data_p;
+#ifdef IMGUI_ENABLE_ARM_CRC32
+    for (; data_size >= 8; data += 8, data_size -= 8)
+    {
+        ImU64 v;
+        memcpy(&v, data, 8);
+        crc = __crc32d(crc, v);
+    }
+    while (data_size-- != 0)
+        crc = __crc32b(crc, *data++);
+#else
     const ImU32* crc32_lut = GCrc32LookupTable;
     while (data_size-- != 0)
         crc = (crc >> 8) ^ crc32_lut[(crc & 0xFF) ^ *data++];
+#endif
     return ~crc;
 }
 
@@ -1791,11 +1853,40 @@ ImGuiID ImHashData(const void* data_p, size_t data_size, ImU32 seed)
 // - If we reach ### in the string we discard the hash so far and reset to the seed.
 // - We don't do 'current += 2; continue;' after handling ### to keep the code smaller/faster (measured ~10% diff in Debug build)
 // FIXME-OPT: Replace with e.g. FNV1a hash? CRC32 pretty much randomly access 1KB. Need to do proper measurements.
+// - With ARMv8 CRC32 instructions we hash 8 bytes at a time, and only fall back to bytes for words containing a '#'.
 ImGuiID ImHashStr(const char* data_p, size_t data_size, ImU32 seed)
 {
     seed = ~seed;
     ImU32 crc = seed;
     const unsigned char* data = (const unsigned char*)data_p;
+#ifdef IMGUI_ENABLE_ARM_CRC32
+    if (data_size == 0)
+        data_size = strlen(data_p);
+    while (data_size != 0)
+    {
+        if (data_size >= 8)
+        {
+            ImU64 v;
+            memcpy(&v, data, 8);
+            const ImU64 v_xor_hash = v ^ 0x2323232323232323ULL; // Any byte == '#' becomes zero
+            if (((v_xor_hash - 0x0101010101010101ULL) & ~v_xor_hash & 0x8080808080808080ULL) == 0)
+            {
+                crc = __crc32d(crc, v);
+                data += 8;
+                data_size -= 8;
+                continue;
+            }
+        }
+        for (int n = (data_size >= 8) ? 8 : (int)data_size; n > 0; n--)
+        {
+            unsigned char c = *data++;
+            data_size--;
+            if (c == '#' && data_size >= 2 && data[0] == '#' && data[1] == '#')
+                crc = seed;
+            crc = __crc32b(crc, c);
+        }
+    }
+#else
     const ImU32* crc32_lut = GCrc32LookupTable;
     if (data_size != 0)
     {
@@ -1816,6 +1907,7 @@ ImGuiID ImHashStr(const char* data_p, size_t data_size, ImU32 seed)
             crc = (crc >> 8) ^ crc32_lut[(crc & 0xFF) ^ c];
         }
     }
+#endif
     return ~crc;
 }
 
@@ -1892,6 +1984,321 @@ void*   ImFileLoadToMemory(const char* filename, const char* mode, size_t* out_f
     return file_data;
 }
 
+// Helper: Write file content without ever leaving a truncated file behind (e.g. if the application is killed while writing).
+// We write to "<filename>.tmp" then rename it over 'filename'. This doesn't use ImGui allocators so it may be called from ImFileWriter thread.
+// With IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS (we can't rename) or very long paths we fallback to writing 'filename' in place.
+bool    ImFileSaveFromMemoryAtomic(const char* filename, const char* mode, const void* data, size_t data_size)
+{
+    IM_ASSERT(filename && mode);
+#ifndef IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS
+    char tmp_filename[1024];
+    const size_t filename_len = strlen(filename);
+    if (filename_len + 5 <= IM_ARRAYSIZE(tmp_filename))
+    {
+        memcpy(tmp_filename, filename, filename_len);
+        memcpy(tmp_filename + filename_len, ".tmp", 5);
+#if defined(_WIN32) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS) && !defined(__CYGWIN__) && !defined(__GNUC__)
+        // Same UTF-8 to wide conversion as ImFileOpen(), using stack buffers.
+        wchar_t wfilename[IM_ARRAYSIZE(tmp_filename)], wtmp_filename[IM_ARRAYSIZE(tmp_filename)], wmode[8];
+        if (::MultiByteToWideChar(CP_UTF8, 0, filename, -1, wfilename, IM_ARRAYSIZE(wfilename)) != 0 &&
+            ::MultiByteToWideChar(CP_UTF8, 0, tmp_filename, -1, wtmp_filename, IM_ARRAYSIZE(wtmp_filename)) != 0 &&
+            ::MultiByteToWideChar(CP_UTF8, 0, mode, -1, wmode, IM_ARRAYSIZE(wmode)) != 0)
+        {
+            FILE* f = ::_wfopen(wtmp_filename, wmode);
+            if (f == NULL)
+                return false;
+            const bool write_ok = (fwrite(data, 1, data_size, f) == data_size);
+            if (fclose(f) != 0 || !write_ok)
+            {
+                ::_wremove(wtmp_filename);
+                return false;
+            }
+            return ::MoveFileExW(wtmp_filename, wfilename, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+        }
+#else
+        ImFileHandle f = ImFileOpen(tmp_filename, mode);
+        if (f == NULL)
+            return false;
+        const bool write_ok = (ImFileWrite(data, 1, data_size, f) == data_size);
+        if (!ImFileClose(f) || !write_ok)
+        {
+            remove(tmp_filename);
+            return false;
+        }
+#if defined(_WIN32) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS) && !defined(__CYGWIN__)
+        return ::MoveFileExA(tmp_filename, filename, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+#if defined(_WIN32)
+        remove(filename); // rename() doesn't replace an existing file on Windows
+#endif
+        return rename(tmp_filename, filename) == 0;
+#endif
+#endif
+    }
+#endif // #ifndef IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS
+
+    ImFileHandle f = ImFileOpen(filename, mode);
+    if (f == NULL)
+        return false;
+    const bool write_ok = (ImFileWrite(data, 1, data_size, f) == data_size);
+    return ImFileClose(f) && write_ok;
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] MISC HELPERS/UTILITIES (File writer)
+//-----------------------------------------------------------------------------
+// Save a file as a whole (e.g. .ini settings) without stalling the calling thread on disk I/O.
+// - With IMGUI_ENABLE_FILE_WRITER_THREAD: data is copied then written by a background thread.
+//   Double-buffered: the calling thread fills 'Pending' while the thread writes 'Writing', the two are swapped under lock.
+//   A newer request replaces a pending one which hasn't been started yet, so we never queue more than one copy.
+//   All buffers are allocated/freed by the calling thread. The background thread only does file I/O (see ImFileSaveFromMemoryAtomic).
+// - Otherwise (or with IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS): ImFileWriterSave() writes synchronously.
+//-----------------------------------------------------------------------------
+
+#if defined(IMGUI_ENABLE_FILE_WRITER_THREAD) && !defined(IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS)
+#define IMGUI_FILE_WRITER_USE_THREAD
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#endif
+
+struct ImGuiFileWriterRequest
+{
+    ImVector<char>          Filename;                   // Zero-terminated
+    char                    Mode[8];
+    ImVector<char>          Data;
+};
+
+struct ImGuiFileWriter
+{
+    ImGuiFileWriterRequest  Pending;                    // Owned by calling thread, until 'HasPending' is set
+    ImGuiFileWriterRequest  Writing;                    // Owned by background thread while 'IsWriting' is set
+    bool                    HasPending;
+    bool                    IsWriting;
+    bool                    RequestExit;
+    int                     WriteCount;                 // Number of completed writes
+#ifdef IMGUI_FILE_WRITER_USE_THREAD
+    std::thread             Thread;
+    std::mutex              Mutex;
+    std::condition_variable Cond;
+#endif
+
+    ImGuiFileWriter()       { HasPending = IsWriting = RequestExit = false; WriteCount = 0; }
+};
+
+#ifdef IMGUI_FILE_WRITER_USE_THREAD
+static void ImFileWriterThreadMain(ImGuiFileWriter* writer)
+{
+    std::unique_lock<std::mutex> lock(writer->Mutex);
+    for (;;)
+    {
+        writer->Cond.wait(lock, [writer] { return writer->HasPending || writer->RequestExit; });
+        if (!writer->HasPending)
+            break;
+        writer->Pending.Filename.swap(writer->Writing.Filename);
+        writer->Pending.Data.swap(writer->Writing.Data);
+        memcpy(writer->Writing.Mode, writer->Pending.Mode, sizeof(writer->Writing.Mode));
+        writer->HasPending = false;
+        writer->IsWriting = true;
+        lock.unlock();
+
+        ImFileSaveFromMemoryAtomic(writer->Writing.Filename.Data, writer->Writing.Mode, writer->Writing.Data.Data, (size_t)writer->Writing.Data.Size);
+
+        lock.lock();
+        writer->IsWriting = false;
+        writer->WriteCount++;
+        writer->Cond.notify_all();
+    }
+}
+#endif
+
+ImGuiFileWriter* ImFileWriterCreate()
+{
+    return IM_NEW(ImGuiFileWriter)();
+}
+
+void ImFileWriterDestroy(ImGuiFileWriter* writer)
+{
+#ifdef IMGUI_FILE_WRITER_USE_THREAD
+    if (writer->Thread.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock(writer->Mutex);
+            writer->RequestExit = true;
+        }
+        writer->Cond.notify_all();
+        writer->Thread.join(); // Pending data is written before the thread exits
+    }
+#endif
+    IM_DELETE(writer);
+}
+
+void ImFileWriterSave(ImGuiFileWriter* writer, const char* filename, const char* mode, const void* data, size_t data_size)
+{
+    IM_ASSERT(filename && mode && strlen(mode) < IM_ARRAYSIZE(writer->Pending.Mode));
+#ifdef IMGUI_FILE_WRITER_USE_THREAD
+    {
+        std::lock_guard<std::mutex> lock(writer->Mutex);
+        const int filename_size = (int)strlen(filename) + 1;
+        writer->Pending.Filename.resize(filename_size);
+        memcpy(writer->Pending.Filename.Data, filename, (size_t)filename_size);
+        ImStrncpy(writer->Pending.Mode, mode, IM_ARRAYSIZE(writer->Pending.Mode));
+        writer->Pending.Data.resize((int)data_size);
+        if (data_size > 0)
+            memcpy(writer->Pending.Data.Data, data, data_size);
+        writer->HasPending = true;
+    }
+    if (!writer->Thread.joinable())
+        writer->Thread = std::thread(ImFileWriterThreadMain, writer);
+    writer->Cond.notify_all();
+#else
+    ImFileSaveFromMemoryAtomic(filename, mode, data, data_size);
+    writer->WriteCount++;
+#endif
+}
+
+void ImFileWriterFlush(ImGuiFileWriter* writer)
+{
+#ifdef IMGUI_FILE_WRITER_USE_THREAD
+    std::unique_lock<std::mutex> lock(writer->Mutex);
+    writer->Cond.wait(lock, [writer] { return !writer->HasPending && !writer->IsWriting; });
+#else
+    IM_UNUSED(writer);
+#endif
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] MISC HELPERS/UTILITIES (File stream)
+//-----------------------------------------------------------------------------
+// Append text to an open file (e.g. LogToFile) without stalling the calling thread on disk I/O.
+// - Data is copied into a ring of fixed size chunks. A chunk is submitted once full, or by ImFileStreamClose().
+// - With IMGUI_ENABLE_FILE_WRITER_THREAD: submitted chunks are written by a background thread.
+//   When all chunks are submitted and not written yet the calling thread waits for the oldest one (back-pressure),
+//   so output is never dropped and memory usage is bounded to FILE_STREAM_CHUNK_COUNT * FILE_STREAM_CHUNK_SIZE.
+//   All buffers are allocated/freed by the calling thread. The background thread only does file I/O.
+// - Otherwise (or with IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS): chunks are written synchronously when submitted,
+//   which still batches many small writes into a few large ones.
+//-----------------------------------------------------------------------------
+
+static const int FILE_STREAM_CHUNK_SIZE = 64 * 1024;
+#ifdef IMGUI_FILE_WRITER_USE_THREAD
+static const int FILE_STREAM_CHUNK_COUNT = 4;
+#else
+static const int FILE_STREAM_CHUNK_COUNT = 1;
+#endif
+
+struct ImGuiFileStream
+{
+    ImFileHandle            File;
+    ImVector<char>          Chunks[FILE_STREAM_CHUNK_COUNT];
+    int                     ChunksSubmitted;            // Number of chunks submitted so far. Chunks[ChunksSubmitted % COUNT] is being filled by the calling thread
+    int                     ChunksWritten;              // Number of chunks written so far. Chunks between ChunksWritten and ChunksSubmitted are owned by the background thread
+    bool                    RequestExit;
+    bool                    WriteError;
+#ifdef IMGUI_FILE_WRITER_USE_THREAD
+    std::thread             Thread;
+    std::mutex              Mutex;
+    std::condition_variable Cond;
+#endif
+
+    ImGuiFileStream()       { File = NULL; ChunksSubmitted = ChunksWritten = 0; RequestExit = WriteError = false; }
+};
+
+#ifdef IMGUI_FILE_WRITER_USE_THREAD
+static void ImFileStreamThreadMain(ImGuiFileStream* stream)
+{
+    std::unique_lock<std::mutex> lock(stream->Mutex);
+    for (;;)
+    {
+        stream->Cond.wait(lock, [stream] { return stream->ChunksWritten < stream->ChunksSubmitted || stream->RequestExit; });
+        if (stream->ChunksWritten == stream->ChunksSubmitted)
+            break;
+        ImVector<char>& chunk = stream->Chunks[stream->ChunksWritten % FILE_STREAM_CHUNK_COUNT];
+        lock.unlock();
+
+        const bool write_ok = (ImFileWrite(chunk.Data, sizeof(char), (ImU64)chunk.Size, stream->File) == (ImU64)chunk.Size);
+
+        lock.lock();
+        if (!write_ok)
+            stream->WriteError = true;
+        stream->ChunksWritten++;
+        stream->Cond.notify_all();
+    }
+}
+#endif
+
+// Hand over the chunk being filled and make the next one available, waiting for it to be written if needed.
+static void ImFileStreamSubmitChunk(ImGuiFileStream* stream)
+{
+    ImVector<char>& chunk = stream->Chunks[stream->ChunksSubmitted % FILE_STREAM_CHUNK_COUNT];
+    if (chunk.Size == 0)
+        return;
+#ifdef IMGUI_FILE_WRITER_USE_THREAD
+    if (!stream->Thread.joinable())
+        stream->Thread = std::thread(ImFileStreamThreadMain, stream);
+    {
+        std::unique_lock<std::mutex> lock(stream->Mutex);
+        stream->ChunksSubmitted++;
+        stream->Cond.notify_all();
+        stream->Cond.wait(lock, [stream] { return stream->ChunksSubmitted - stream->ChunksWritten < FILE_STREAM_CHUNK_COUNT; });
+    }
+#else
+    if (ImFileWrite(chunk.Data, sizeof(char), (ImU64)chunk.Size, stream->File) != (ImU64)chunk.Size)
+        stream->WriteError = true;
+    stream->ChunksSubmitted++;
+    stream->ChunksWritten++;
+#endif
+    stream->Chunks[stream->ChunksSubmitted % FILE_STREAM_CHUNK_COUNT].resize(0);
+}
+
+// Takes ownership of 'file', which is closed by ImFileStreamClose()
+ImGuiFileStream* ImFileStreamCreate(ImFileHandle file)
+{
+    IM_ASSERT(file != NULL);
+    ImGuiFileStream* stream = IM_NEW(ImGuiFileStream)();
+    stream->File = file;
+    stream->Chunks[0].reserve(FILE_STREAM_CHUNK_SIZE);
+    return stream;
+}
+
+void ImFileStreamWrite(ImGuiFileStream* stream, const void* data, size_t data_size)
+{
+    const char* src = (const char*)data;
+    while (data_size > 0)
+    {
+        ImVector<char>& chunk = stream->Chunks[stream->ChunksSubmitted % FILE_STREAM_CHUNK_COUNT];
+        if (chunk.Capacity < FILE_STREAM_CHUNK_SIZE)
+            chunk.reserve(FILE_STREAM_CHUNK_SIZE);
+        const size_t copy_size = ImMin(data_size, (size_t)(FILE_STREAM_CHUNK_SIZE - chunk.Size));
+        memcpy(chunk.Data + chunk.Size, src, copy_size);
+        chunk.Size += (int)copy_size;
+        src += copy_size;
+        data_size -= copy_size;
+        if (chunk.Size == FILE_STREAM_CHUNK_SIZE)
+            ImFileStreamSubmitChunk(stream);
+    }
+}
+
+// Write all pending data, close the file and destroy the stream. Return false if any write failed.
+bool ImFileStreamClose(ImGuiFileStream* stream)
+{
+    ImFileStreamSubmitChunk(stream);
+#ifdef IMGUI_FILE_WRITER_USE_THREAD
+    if (stream->Thread.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock(stream->Mutex);
+            stream->RequestExit = true;
+        }
+        stream->Cond.notify_all();
+        stream->Thread.join(); // Submitted chunks are written before the thread exits
+    }
+#endif
+    const bool ok = ImFileClose(stream->File) && !stream->WriteError;
+    IM_DELETE(stream);
+    return ok;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] MISC HELPERS/UTILITIES (ImText* functions)
 //-----------------------------------------------------------------------------
@@ -2162,27 +2569,100 @@ void ImGui::ColorConvertHSVtoRGB(float h, float s, float v, float& out_r, float&
 // Helper: Key->value storage
 //-----------------------------------------------------------------------------
 
-// std::lower_bound but without the bullshit
-static ImGuiStorage::ImGuiStoragePair* LowerBound(ImVector<ImGuiStorage::ImGuiStoragePair>& data, ImGuiID key)
+// Below this amount of pairs we use a linear search and don't allocate an index.
+#define IMGUI_STORAGE_INDEX_MIN_PAIRS   16
+
+// Keys are often already hashed but may also be small sequential integers: scramble so they spread over the table.
+static inline ImU32 StorageHashKey(ImGuiID key)
 {
-    ImGuiStorage::ImGuiStoragePair* first = data.Data;
-    ImGuiStorage::ImGuiStoragePair* last = data.Data + data.Size;
-    size_t count = (size_t)(last - first);
-    while (count > 0)
-    {
-        size_t count2 = count >> 1;
-        ImGuiStorage::ImGuiStoragePair* mid = first + count2;
-        if (mid->key < key)
-        {
-            first = ++mid;
-            count -= count2 + 1;
-        }
-        else
+    ImU32 h = key * 2654435761u;
+    return h ^ (h >> 16);
+}
+
+static void StorageIndexInsert(ImVector<int>& index, ImGuiID key, int data_idx)
+{
+    const ImU32 mask = (ImU32)index.Size - 1;
+    for (ImU32 slot = StorageHashKey(key) & mask; ; slot = (slot + 1) & mask)
+        if (index.Data[slot] == -1)
         {
-            count = count2;
+            index.Data[slot] = data_idx;
+            return;
         }
+}
+
+// Rebuild index, growing it to keep load factor under 50%.
+static void StorageRebuildIndex(ImGuiStorage* storage)
+{
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_Storage);
+    const int count = storage->Data.Size;
+    storage->IndexedCount = count;
+    if (count < IMGUI_STORAGE_INDEX_MIN_PAIRS)
+    {
+        storage->Index.clear();
+        return;
+    }
+    int capacity = ImMax(storage->Index.Size, IMGUI_STORAGE_INDEX_MIN_PAIRS * 2);
+    while (capacity < count * 2)
+        capacity *= 2;
+    storage->Index.resize(capacity);
+    memset(storage->Index.Data, 0xFF, (size_t)capacity * sizeof(int));
+    for (int n = 0; n < count; n++)
+        StorageIndexInsert(storage->Index, storage->Data.Data[n].key, n);
+}
+
+static ImGuiStorage::ImGuiStoragePair* StorageFindPairLinear(const ImGuiStorage* storage, ImGuiID key)
+{
+    ImGuiStorage::ImGuiStoragePair* pairs = storage->Data.Data;
+    for (int n = 0; n < storage->Data.Size; n++)
+        if (pairs[n].key == key)
+            return &pairs[n];
+    return NULL;
+}
+
+// Never modifies the storage, so concurrent const lookups are safe. Index[] is only rebuilt by mutating functions.
+static ImGuiStorage::ImGuiStoragePair* StorageFindPair(const ImGuiStorage* storage, ImGuiID key)
+{
+    IM_ASSERT(storage->IndexedCount == storage->Data.Size && "Data[] was modified directly: call BuildSortByKey() afterwards!");
+    if (storage->Index.Size == 0 || storage->IndexedCount != storage->Data.Size)
+        return StorageFindPairLinear(storage, key);
+    ImGuiStorage::ImGuiStoragePair* pairs = storage->Data.Data;
+    const int* index = storage->Index.Data;
+    const ImU32 mask = (ImU32)storage->Index.Size - 1;
+    for (ImU32 slot = StorageHashKey(key) & mask; ; slot = (slot + 1) & mask)
+    {
+        const int data_idx = index[slot];
+#ifdef IMGUI_DEBUG_PARANOID
+        // Detect keys edited in place in Data[], which the size check above can't see.
+        if (data_idx == -1 || pairs[data_idx].key == key)
+            IM_ASSERT(StorageFindPairLinear(storage, key) == (data_idx == -1 ? NULL : &pairs[data_idx]) && "Data[] was modified directly: call BuildSortByKey() afterwards!");
+#endif
+        if (data_idx == -1)
+            return NULL;
+        if (pairs[data_idx].key == key)
+            return &pairs[data_idx];
     }
-    return first;
+}
+
+// Used by mutating functions before a lookup
+static void StorageUpdateIndex(ImGuiStorage* storage)
+{
+    if (storage->IndexedCount != storage->Data.Size)
+        StorageRebuildIndex(storage);
+}
+
+// Caller needs to have called StorageUpdateIndex() + StorageFindPair() first, so the index is up to date.
+static ImGuiStorage::ImGuiStoragePair* StorageAddPair(ImGuiStorage* storage, const ImGuiStorage::ImGuiStoragePair& pair)
+{
+    IM_ASSERT(storage->IndexedCount == storage->Data.Size);
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_Storage);
+    storage->Data.push_back(pair);
+    const int count = storage->Data.Size;
+    if (count >= IMGUI_STORAGE_INDEX_MIN_PAIRS && count * 2 > storage->Index.Size)
+        StorageRebuildIndex(storage);
+    else if (storage->Index.Size > 0)
+        StorageIndexInsert(storage->Index, pair.key, count - 1);
+    storage->IndexedCount = count;
+    return &storage->Data.back();
 }
 
 // For quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
@@ -2199,14 +2679,13 @@ void ImGuiStorage::BuildSortByKey()
         }
     };
     ImQsort(Data.Data, (size_t)Data.Size, sizeof(ImGuiStoragePair), StaticFunc::PairComparerByID);
+    StorageRebuildIndex(this);
 }
 
 int ImGuiStorage::GetInt(ImGuiID key, int default_val) const
 {
-    ImGuiStoragePair* it = LowerBound(const_cast<ImVector<ImGuiStoragePair>&>(Data), key);
-    if (it == Data.end() || it->key != key)
-        return default_val;
-    return it->val_i;
+    ImGuiStoragePair* it = StorageFindPair(this, key);
+    return it ? it->val_i : default_val;
 }
 
 bool ImGuiStorage::GetBool(ImGuiID key, bool default_val) const
@@ -2216,26 +2695,23 @@ bool ImGuiStorage::GetBool(ImGuiID key, bool default_val) const
 
 float ImGuiStorage::GetFloat(ImGuiID key, float default_val) const
 {
-    ImGuiStoragePair* it = LowerBound(const_cast<ImVector<ImGuiStoragePair>&>(Data), key);
-    if (it == Data.end() || it->key != key)
-        return default_val;
-    return it->val_f;
+    ImGuiStoragePair* it = StorageFindPair(this, key);
+    return it ? it->val_f : default_val;
 }
 
 void* ImGuiStorage::GetVoidPtr(ImGuiID key) const
 {
-    ImGuiStoragePair* it = LowerBound(const_cast<ImVector<ImGuiStoragePair>&>(Data), key);
-    if (it == Data.end() || it->key != key)
-        return NULL;
-    return it->val_p;
+    ImGuiStoragePair* it = StorageFindPair(this, key);
+    return it ? it->val_p : NULL;
 }
 
 // References are only valid until a new value is added to the storage. Calling a Set***() function or a Get***Ref() function invalidates the pointer.
 int* ImGuiStorage::GetIntRef(ImGuiID key, int default_val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
+    StorageUpdateIndex(this);
+    ImGuiStoragePair* it = StorageFindPair(this, key);
+    if (it == NULL)
+        it = StorageAddPair(this, ImGuiStoragePair(key, default_val));
     return &it->val_i;
 }
 
@@ -2246,30 +2722,29 @@ bool* ImGuiStorage::GetBoolRef(ImGuiID key, bool default_val)
 
 float* ImGuiStorage::GetFloatRef(ImGuiID key, float default_val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
+    StorageUpdateIndex(this);
+    ImGuiStoragePair* it = StorageFindPair(this, key);
+    if (it == NULL)
+        it = StorageAddPair(this, ImGuiStoragePair(key, default_val));
     return &it->val_f;
 }
 
 void** ImGuiStorage::GetVoidPtrRef(ImGuiID key, void* default_val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
+    StorageUpdateIndex(this);
+    ImGuiStoragePair* it = StorageFindPair(this, key);
+    if (it == NULL)
+        it = StorageAddPair(this, ImGuiStoragePair(key, default_val));
     return &it->val_p;
 }
 
-// FIXME-OPT: Need a way to reuse the result of lower_bound when doing GetInt()/SetInt() - not too bad because it only happens on explicit interaction (maximum one a frame)
 void ImGuiStorage::SetInt(ImGuiID key, int val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-    {
-        Data.insert(it, ImGuiStoragePair(key, val));
-        return;
-    }
-    it->val_i = val;
+    StorageUpdateIndex(this);
+    if (ImGuiStoragePair* it = StorageFindPair(this, key))
+        it->val_i = val;
+    else
+        StorageAddPair(this, ImGuiStoragePair(key, val));
 }
 
 void ImGuiStorage::SetBool(ImGuiID key, bool val)
@@ -2279,24 +2754,20 @@ void ImGuiStorage::SetBool(ImGuiID key, bool val)
 
 void ImGuiStorage::SetFloat(ImGuiID key, float val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-    {
-        Data.insert(it, ImGuiStoragePair(key, val));
-        return;
-    }
-    it->val_f = val;
+    StorageUpdateIndex(this);
+    if (ImGuiStoragePair* it = StorageFindPair(this, key))
+        it->val_f = val;
+    else
+        StorageAddPair(this, ImGuiStoragePair(key, val));
 }
 
 void ImGuiStorage::SetVoidPtr(ImGuiID key, void* val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-    {
-        Data.insert(it, ImGuiStoragePair(key, val));
-        return;
-    }
-    it->val_p = val;
+    StorageUpdateIndex(this);
+    if (ImGuiStoragePair* it = StorageFindPair(this, key))
+        it->val_p = val;
+    else
+        StorageAddPair(this, ImGuiStoragePair(key, val));
 }
 
 void ImGuiStorage::SetAllInt(int v)
@@ -2592,10 +3063,48 @@ static void ImGuiListClipper_SeekCursorForItem(ImGuiListClipper* clipper, int it
     // StartPosY starts from ItemsFrozen hence the subtraction
     // Perform the add and multiply with double to allow seeking through larger ranges
     ImGuiListClipperData* data = (ImGuiListClipperData*)clipper->TempData;
+    if (ImGuiListClipperHeights* heights = clipper->Heights)
+    {
+        float pos_y = (float)((double)clipper->StartPosY + data->LossynessOffset + heights->GetItemPos(item_n) - heights->GetItemPos(data->ItemsFrozen));
+        ImGuiListClipper_SeekCursorAndSetupPrevLine(pos_y, heights->GetItemHeight(item_n > 0 ? item_n - 1 : item_n));
+        return;
+    }
     float pos_y = (float)((double)clipper->StartPosY + data->LossynessOffset + (double)(item_n - data->ItemsFrozen) * clipper->ItemsHeight);
     ImGuiListClipper_SeekCursorAndSetupPrevLine(pos_y, clipper->ItemsHeight);
 }
 
+// With ImGuiListClipperHeights: display one item at a time so the next step can measure it.
+// After the end of a range we keep going while the cursor is in the visible area, as unmeasured items may be shorter than estimated.
+// Here data->StepNo is 1 + the index of the current range.
+static bool ImGuiListClipper_StepWithHeights(ImGuiListClipper* clipper)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    ImGuiListClipperData* data = (ImGuiListClipperData*)clipper->TempData;
+
+    // Cursor is always at the position of item DisplayEnd
+    const int prev_end = clipper->DisplayEnd;
+    while (data->StepNo <= data->Ranges.Size && data->Ranges[data->StepNo - 1].Max <= prev_end)
+        data->StepNo++;
+    int item_n = (data->StepNo <= data->Ranges.Size) ? ImMax(data->Ranges[data->StepNo - 1].Min, prev_end) : clipper->ItemsCount;
+    if (item_n > prev_end && window->DC.CursorPos.y >= window->ClipRect.Min.y && window->DC.CursorPos.y < window->ClipRect.Max.y)
+        item_n = prev_end;
+
+    if (item_n >= clipper->ItemsCount)
+    {
+        ImGuiListClipper_SeekCursorForItem(clipper, clipper->ItemsCount);
+        clipper->ItemsCount = -1;
+        return false;
+    }
+    if (item_n > prev_end)
+        ImGuiListClipper_SeekCursorForItem(clipper, item_n);
+    data->MeasureItem = item_n;
+    data->MeasurePosY = window->DC.CursorPos.y;
+    clipper->DisplayStart = item_n;
+    clipper->DisplayEnd = item_n + 1;
+    return true;
+}
+
 ImGuiListClipper::ImGuiListClipper()
 {
     memset(this, 0, sizeof(*this));
@@ -2622,6 +3131,7 @@ void ImGuiListClipper::Begin(int items_count, float items_height)
     StartPosY = window->DC.CursorPos.y;
     ItemsHeight = items_height;
     ItemsCount = items_count;
+    Heights = NULL;
     DisplayStart = -1;
     DisplayEnd = 0;
 
@@ -2634,6 +3144,16 @@ void ImGuiListClipper::Begin(int items_count, float items_height)
     TempData = data;
 }
 
+void ImGuiListClipper::BeginWithHeights(int items_count, ImGuiListClipperHeights* heights)
+{
+    IM_ASSERT(heights != NULL && items_count >= 0 && items_count < INT_MAX);
+    if (heights->DefaultHeight <= 0.0f)
+        heights->SetDefaultHeight(ImGui::GetTextLineHeightWithSpacing());
+    heights->Resize(items_count);
+    Begin(items_count, heights->DefaultHeight); // Known height: skip measuring the first item in Step()
+    Heights = heights;
+}
+
 void ImGuiListClipper::End()
 {
     // In theory here we should assert that we are already at the right position, but it seems saner to just seek at the end and not assert/crash the user.
@@ -2675,6 +3195,14 @@ bool ImGuiListClipper::Step()
     if (table && table->IsInsideRow)
         ImGui::TableEndRow(table);
 
+    // Measure item displayed by previous step
+    if (data->MeasureItem >= 0)
+    {
+        if (!ImIsFloatAboveGuaranteedIntegerPrecision(data->MeasurePosY) && !ImIsFloatAboveGuaranteedIntegerPrecision(window->DC.CursorPos.y))
+            Heights->SetItemHeight(data->MeasureItem, ImMax(window->DC.CursorPos.y - data->MeasurePosY, 0.0f));
+        data->MeasureItem = -1;
+    }
+
     // No items
     if (ItemsCount == 0 || GetSkipItemForListClipping())
         return (void)End(), false;
@@ -2762,8 +3290,18 @@ bool ImGuiListClipper::Step()
         for (int i = 0; i < data->Ranges.Size; i++)
             if (data->Ranges[i].PosToIndexConvert)
             {
-                int m1 = (int)(((double)data->Ranges[i].Min - window->DC.CursorPos.y - data->LossynessOffset) / ItemsHeight);
-                int m2 = (int)((((double)data->Ranges[i].Max - window->DC.CursorPos.y - data->LossynessOffset) / ItemsHeight) + 0.999999f);
+                int m1, m2;
+                if (Heights)
+                {
+                    const double base_pos = window->DC.CursorPos.y + data->LossynessOffset - Heights->GetItemPos(already_submitted);
+                    m1 = Heights->FindItemAtPos((double)data->Ranges[i].Min - base_pos) - already_submitted;
+                    m2 = Heights->FindItemAtPos((double)data->Ranges[i].Max - base_pos) + 1 - already_submitted;
+                }
+                else
+                {
+                    m1 = (int)(((double)data->Ranges[i].Min - window->DC.CursorPos.y - data->LossynessOffset) / ItemsHeight);
+                    m2 = (int)((((double)data->Ranges[i].Max - window->DC.CursorPos.y - data->LossynessOffset) / ItemsHeight) + 0.999999f);
+                }
                 data->Ranges[i].Min = ImClamp(already_submitted + m1 + data->Ranges[i].PosToIndexOffsetMin, already_submitted, ItemsCount - 1);
                 data->Ranges[i].Max = ImClamp(already_submitted + m2 + data->Ranges[i].PosToIndexOffsetMax, data->Ranges[i].Min + 1, ItemsCount);
                 data->Ranges[i].PosToIndexConvert = false;
@@ -2771,6 +3309,14 @@ bool ImGuiListClipper::Step()
         ImGuiListClipper_SortAndFuseRanges(data->Ranges, data->StepNo);
     }
 
+    // Step 0+ (with ImGuiListClipperHeights): Display the next item.
+    if (Heights)
+    {
+        if (calc_clipping)
+            data->StepNo = 1;
+        return ImGuiListClipper_StepWithHeights(this);
+    }
+
     // Step 0+ (if item height is given in advance) or 1+: Display the next range in line.
     if (data->StepNo < data->Ranges.Size)
     {
@@ -2791,6 +3337,83 @@ bool ImGuiListClipper::Step()
     return false;
 }
 
+// ImGuiListClipperHeights: Fenwick tree (aka binary indexed tree) of item heights.
+// Node n (1-based, stored in SumTree[n-1]) holds the sum of heights of items [n - lowbit(n), n), where lowbit(n) = n & -n.
+// Its children are nodes n-1, then repeatedly minus their own lowbit, down to n - lowbit(n) (excluded).
+static void ImGuiListClipperHeights_BuildTree(ImGuiListClipperHeights* heights, int first_node)
+{
+    for (int n = first_node + 1; n <= heights->SumTree.Size; n++)
+    {
+        double sum = heights->GetItemHeight(n - 1);
+        for (int child = n - 1; child > n - (n & -n); child -= child & -child)
+            sum += heights->SumTree[child - 1];
+        heights->SumTree[n - 1] = sum;
+    }
+}
+
+void ImGuiListClipperHeights::Clear()
+{
+    Heights.clear();
+    SumTree.clear();
+}
+
+// Nodes don't depend on following items, so appending only needs to compute the new nodes: O(log N) per item.
+void ImGuiListClipperHeights::Resize(int items_count)
+{
+    IM_ASSERT(items_count >= 0);
+    const int old_count = Heights.Size;
+    if (items_count == old_count)
+        return;
+    Heights.resize(items_count, -1.0f);
+    SumTree.resize(items_count);
+    ImGuiListClipperHeights_BuildTree(this, old_count);
+}
+
+void ImGuiListClipperHeights::SetDefaultHeight(float height)
+{
+    IM_ASSERT(height >= 0.0f);
+    if (DefaultHeight == height)
+        return;
+    DefaultHeight = height;
+    ImGuiListClipperHeights_BuildTree(this, 0);
+}
+
+void ImGuiListClipperHeights::SetItemHeight(int item_n, float height)
+{
+    IM_ASSERT(item_n >= 0 && item_n < Heights.Size);
+    const double delta = (double)(height >= 0.0f ? height : DefaultHeight) - GetItemHeight(item_n);
+    Heights[item_n] = (height >= 0.0f) ? height : -1.0f;
+    if (delta != 0.0)
+        for (int n = item_n + 1; n <= SumTree.Size; n += n & -n)
+            SumTree[n - 1] += delta;
+}
+
+double ImGuiListClipperHeights::GetItemPos(int item_n) const
+{
+    IM_ASSERT(item_n >= 0 && item_n <= SumTree.Size);
+    double pos = 0.0;
+    for (int n = item_n; n > 0; n -= n & -n)
+        pos += SumTree[n - 1];
+    return pos;
+}
+
+int ImGuiListClipperHeights::FindItemAtPos(double pos) const
+{
+    // Descend the tree to find the number of items ending before or at 'pos', which is the index of the item containing it.
+    const int count = SumTree.Size;
+    int step = 1;
+    while (step <= count / 2)
+        step <<= 1;
+    int n = 0;
+    for (; step > 0; step >>= 1)
+        if (n + step <= count && SumTree[n + step - 1] <= pos)
+        {
+            n += step;
+            pos -= SumTree[n - 1];
+        }
+    return ImMax(ImMin(n, count - 1), 0);
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] STYLING
 //-----------------------------------------------------------------------------
@@ -3463,6 +4086,143 @@ void ImGui::GcAwakeTransientWindowBuffers(ImGuiWindow* window)
     window->MemoryDrawListIdxCapacity = window->MemoryDrawListVtxCapacity = 0;
 }
 
+// Size of the buffers freed by GcCompactTransientWindowBuffers()
+size_t ImGui::GcCalcTransientWindowBuffersSize(ImGuiWindow* window)
+{
+    IM_ASSERT(window->MemoryCompacted == false);
+    const ImDrawList* draw_list = window->DrawList;
+    size_t bytes = ImVectorCapacityInBytes(draw_list->CmdBuffer) + ImVectorCapacityInBytes(draw_list->IdxBuffer) + ImVectorCapacityInBytes(draw_list->VtxBuffer);
+    bytes += ImVectorCapacityInBytes(draw_list->_ClipRectStack) + ImVectorCapacityInBytes(draw_list->_TextureIdStack) + ImVectorCapacityInBytes(draw_list->_Path);
+    bytes += ImVectorCapacityInBytes(draw_list->_Splitter._Channels);
+    for (int n = 0; n < draw_list->_Splitter._Channels.Size; n++)
+        bytes += ImVectorCapacityInBytes(draw_list->_Splitter._Channels[n]._CmdBuffer) + ImVectorCapacityInBytes(draw_list->_Splitter._Channels[n]._IdxBuffer);
+    bytes += ImVectorCapacityInBytes(window->IDStack);
+    bytes += ImVectorCapacityInBytes(window->DC.ChildWindows) + ImVectorCapacityInBytes(window->DC.ItemWidthStack) + ImVectorCapacityInBytes(window->DC.TextWrapPosStack);
+    return bytes;
+}
+
+static int IMGUI_CDECL GcCandidateComparerByLastTimeActive(const void* lhs, const void* rhs)
+{
+    const ImGuiGcCandidate* a = (const ImGuiGcCandidate*)lhs;
+    const ImGuiGcCandidate* b = (const ImGuiGcCandidate*)rhs;
+    if (a->LastTimeActive != b->LastTimeActive)
+        return (a->LastTimeActive < b->LastTimeActive) ? -1 : +1;
+    return (a->Bytes > b->Bytes) ? -1 : (a->Bytes < b->Bytes) ? +1 : 0;
+}
+
+// Called by NewFrame() and CompactMemory(). Free transient buffers of:
+// - windows/tables unused for more than io.ConfigMemoryCompactTimer seconds.
+// - the least recently used windows/tables, until the total is under io.ConfigMemoryCompactBudget bytes.
+// Windows/tables used during the last frame are never freed by the budget: their buffers would be reallocated right away
+// (and while outside of a frame, window draw lists may be referenced by the ImDrawData output of Render()).
+void ImGui::GcUpdateTransientBuffers()
+{
+    ImGuiContext& g = *GImGui;
+    const float memory_compact_start_time = (g.GcCompactAll || g.IO.ConfigMemoryCompactTimer < 0.0f) ? FLT_MAX : (float)g.Time - g.IO.ConfigMemoryCompactTimer;
+    const size_t memory_budget = g.IO.ConfigMemoryCompactBudget;
+    size_t memory_used = 0;
+    g.GcCandidates.resize(0);
+
+    // Garbage collect transient buffers of recently unused windows
+    for (int i = 0; i != g.Windows.Size; i++)
+    {
+        ImGuiWindow* window = g.Windows[i];
+        if (window->MemoryCompacted)
+            continue;
+        const bool is_unused = !window->Active && !window->WasActive;
+        if (is_unused && window->LastTimeActive < memory_compact_start_time)
+        {
+            GcCompactTransientWindowBuffers(window);
+            continue;
+        }
+        const size_t bytes = GcCalcTransientWindowBuffersSize(window);
+        memory_used += bytes;
+        if (is_unused && memory_budget > 0)
+        {
+            ImGuiGcCandidate candidate = { ImGuiGcCandidateType_Window, i, window->LastTimeActive, bytes };
+            g.GcCandidates.push_back(candidate);
+        }
+    }
+
+    // Garbage collect transient buffers of recently unused tables
+    for (int i = 0; i < g.TablesLastTimeActive.Size; i++)
+    {
+        const float last_time_active = g.TablesLastTimeActive[i];
+        if (last_time_active < 0.0f)
+            continue;
+        ImGuiTable* table = g.Tables.GetByIndex(i);
+        const bool is_unused = (table->LastFrameActive < g.FrameCount - 1);
+        if (is_unused && last_time_active < memory_compact_start_time)
+        {
+            TableGcCompactTransientBuffers(table);
+            continue;
+        }
+        const size_t bytes = TableGcCalcTransientBuffersSize(table);
+        memory_used += bytes;
+        if (is_unused && memory_budget > 0)
+        {
+            ImGuiGcCandidate candidate = { ImGuiGcCandidateType_Table, i, last_time_active, bytes };
+            g.GcCandidates.push_back(candidate);
+        }
+    }
+    for (int i = 0; i < g.TablesTempData.Size; i++)
+    {
+        ImGuiTableTempData* temp_data = &g.TablesTempData[i];
+        if (temp_data->LastTimeActive < 0.0f)
+            continue;
+        const bool is_unused = (temp_data->LastFrameActive < g.FrameCount - 1);
+        if (is_unused && temp_data->LastTimeActive < memory_compact_start_time)
+        {
+            TableGcCompactTransientBuffers(temp_data);
+            continue;
+        }
+        const size_t bytes = TableGcCalcTransientBuffersSize(temp_data);
+        memory_used += bytes;
+        if (is_unused && memory_budget > 0)
+        {
+            ImGuiGcCandidate candidate = { ImGuiGcCandidateType_TableTempData, i, temp_data->LastTimeActive, bytes };
+            g.GcCandidates.push_back(candidate);
+        }
+    }
+
+    // Over budget: free least recently used first
+    if (memory_budget > 0 && memory_used > memory_budget && g.GcCandidates.Size > 0)
+    {
+        ImQsort(g.GcCandidates.Data, (size_t)g.GcCandidates.Size, sizeof(ImGuiGcCandidate), GcCandidateComparerByLastTimeActive);
+        for (int n = 0; n < g.GcCandidates.Size && memory_used > memory_budget; n++)
+        {
+            const ImGuiGcCandidate& candidate = g.GcCandidates[n];
+            if (candidate.Type == ImGuiGcCandidateType_Window)
+                GcCompactTransientWindowBuffers(g.Windows[candidate.Index]);
+            else if (candidate.Type == ImGuiGcCandidateType_Table)
+                TableGcCompactTransientBuffers(g.Tables.GetByIndex(candidate.Index));
+            else
+                TableGcCompactTransientBuffers(&g.TablesTempData[candidate.Index]);
+            memory_used -= candidate.Bytes;
+        }
+    }
+
+    if (g.GcCompactAll)
+        GcCompactTransientMiscBuffers();
+    g.GcCompactAll = false;
+
+    g.IO.MetricsTransientMemory = memory_used;
+    g.IO.MetricsTransientMemoryPeak = ImMax(g.IO.MetricsTransientMemoryPeak, memory_used);
+}
+
+void ImGui::CompactMemory()
+{
+    ImGuiContext& g = *GImGui;
+    g.GcCompactAll = true;
+    if (g.WithinFrameScope)
+    {
+        g.FrameArena.ReleasePending = true; // Allocations of the current frame are valid until next NewFrame(): free them on next Reset()
+        return;
+    }
+    GcUpdateTransientBuffers();
+    g.FrameArena.Clear();
+}
+
 void ImGui::SetActiveID(ImGuiID id, ImGuiWindow* window)
 {
     ImGuiContext& g = *GImGui;
@@ -3722,12 +4482,45 @@ float ImGui::CalcWrapWidthForPos(const ImVec2& pos, float wrap_pos_x)
     return ImMax(wrap_pos_x - pos.x, 1.0f);
 }
 
+#ifdef IMGUI_ENABLE_MEMORY_TAGS
+// Stored in front of every allocation. Size is kept a multiple of 16 to preserve alignment of the underlying allocator.
+// Stats are charged to the context which was current at allocation time, regardless of which context (if any) is current when freeing.
+struct ImGuiMemTagHeader
+{
+    size_t                      Size;
+    ImGuiMemTagContextStats*    Owner;      // NULL if allocated without a current context
+    ImGuiMemTag                 Tag;
+};
+#define IMGUI_MEM_TAG_HEADER_SIZE   32          // Also mentioned in imconfig.h
+#endif
+
 // IM_ALLOC() == ImGui::MemAlloc()
 void* ImGui::MemAlloc(size_t size)
 {
-    if (ImGuiContext* ctx = GImGui)
+    ImGuiContext* ctx = GImGui;
+    if (ctx)
         ctx->IO.MetricsActiveAllocations++;
+#ifdef IMGUI_ENABLE_MEMORY_TAGS
+    IM_STATIC_ASSERT(sizeof(ImGuiMemTagHeader) <= IMGUI_MEM_TAG_HEADER_SIZE);
+    ImGuiMemTagHeader* header = (ImGuiMemTagHeader*)(*GImAllocatorAllocFunc)(size + IMGUI_MEM_TAG_HEADER_SIZE, GImAllocatorUserData);
+    if (header == NULL)
+        return NULL;
+    header->Size = size;
+    header->Owner = ctx ? ctx->MemTagStats : NULL;
+    header->Tag = ctx ? ctx->MemTagCurrent : ImGuiMemTag_Misc;
+    if (ImGuiMemTagContextStats* owner = header->Owner)
+    {
+        ImGuiMemTagStats* stats = &owner->Tags[header->Tag];
+        stats->LiveBytes += (ImS64)size;
+        stats->PeakBytes = ImMax(stats->PeakBytes, stats->LiveBytes);
+        stats->LiveAllocs++;
+        stats->AllocsThisFrame++;
+        owner->RefCount++;
+    }
+    return (char*)header + IMGUI_MEM_TAG_HEADER_SIZE;
+#else
     return (*GImAllocatorAllocFunc)(size, GImAllocatorUserData);
+#endif
 }
 
 // IM_FREE() == ImGui::MemFree()
@@ -3736,9 +4529,149 @@ void ImGui::MemFree(void* ptr)
     if (ptr)
         if (ImGuiContext* ctx = GImGui)
             ctx->IO.MetricsActiveAllocations--;
+#ifdef IMGUI_ENABLE_MEMORY_TAGS
+    if (ptr == NULL)
+        return;
+    ImGuiMemTagHeader* header = (ImGuiMemTagHeader*)(void*)((char*)ptr - IMGUI_MEM_TAG_HEADER_SIZE);
+    if (ImGuiMemTagContextStats* owner = header->Owner)
+    {
+        ImGuiMemTagStats* stats = &owner->Tags[header->Tag];
+        stats->LiveBytes -= (ImS64)header->Size;
+        stats->LiveAllocs--;
+        MemTagStatsRelease(owner);
+    }
+    ptr = header;
+#endif
     return (*GImAllocatorFreeFunc)(ptr, GImAllocatorUserData);
 }
 
+// Stats blocks are allocated straight from the underlying allocator: they are not tagged and may outlive their context.
+ImGuiMemTagContextStats* ImGui::MemTagStatsCreate()
+{
+    ImGuiMemTagContextStats* owner = (ImGuiMemTagContextStats*)(*GImAllocatorAllocFunc)(sizeof(ImGuiMemTagContextStats), GImAllocatorUserData);
+    memset(owner, 0, sizeof(*owner));
+    owner->RefCount = 1;
+    return owner;
+}
+
+void ImGui::MemTagStatsRelease(ImGuiMemTagContextStats* owner)
+{
+    IM_ASSERT(owner->RefCount > 0);
+    if (--owner->RefCount == 0)
+        (*GImAllocatorFreeFunc)(owner, GImAllocatorUserData);
+}
+
+// Frame arena
+void* ImGuiFrameArena::Alloc(size_t size)
+{
+    UsedBytes += size;
+    if (size > IMGUI_FRAME_ARENA_LARGE_ALLOC_SIZE)
+    {
+        IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_FrameArena);
+        void* ptr = IM_ALLOC(size);
+        LargeAllocs.push_back(ptr);
+        return ptr;
+    }
+
+    size = IM_MEMALIGN(size, 16);
+    if (Blocks.Size == 0 || CurrOff + size > Blocks.back().Size)
+    {
+        IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_FrameArena);
+        size_t block_size = Blocks.Size ? Blocks.back().Size * 2 : IMGUI_FRAME_ARENA_MIN_BLOCK_SIZE;
+        while (block_size < size)
+            block_size *= 2;
+        ImGuiFrameArenaBlock block;
+        block.Data = (char*)IM_ALLOC(block_size);
+        block.Size = block_size;
+        Blocks.push_back(block);
+        CurrOff = 0;
+    }
+    void* ptr = Blocks.back().Data + CurrOff;
+    CurrOff += size;
+    BlocksUsedBytes += size;
+    return ptr;
+}
+
+void ImGuiFrameArena::Reset()
+{
+    for (int n = 0; n < LargeAllocs.Size; n++)
+        IM_FREE(LargeAllocs[n]);
+    LargeAllocs.resize(0);
+
+    // Shrink when the blocks were mostly unused for a while
+    const size_t capacity = GetCapacityInBytes();
+    const size_t used_bytes = BlocksUsedBytes;
+    UnderusedFrames = (capacity > IMGUI_FRAME_ARENA_MIN_BLOCK_SIZE && used_bytes < capacity / 4) ? UnderusedFrames + 1 : 0;
+    const bool shrink = (UnderusedFrames >= IMGUI_FRAME_ARENA_SHRINK_FRAMES);
+    const size_t used_bytes_last_frame = UsedBytes;
+    if (ReleasePending)
+    {
+        Clear();
+    }
+    else if (Blocks.Size > 1 || shrink)
+    {
+        // Coalesce into a single block large enough for the whole frame
+        IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_FrameArena);
+        size_t block_size = capacity;
+        if (shrink)
+        {
+            block_size = IMGUI_FRAME_ARENA_MIN_BLOCK_SIZE;
+            while (block_size < used_bytes * 2)
+                block_size *= 2;
+        }
+        Clear();
+        ImGuiFrameArenaBlock block;
+        block.Data = (char*)IM_ALLOC(block_size);
+        block.Size = block_size;
+        Blocks.push_back(block);
+    }
+    UsedBytesLastFrame = used_bytes_last_frame;
+    UsedBytes = BlocksUsedBytes = CurrOff = 0;
+}
+
+void ImGuiFrameArena::Clear()
+{
+    for (int n = 0; n < Blocks.Size; n++)
+        IM_FREE(Blocks[n].Data);
+    for (int n = 0; n < LargeAllocs.Size; n++)
+        IM_FREE(LargeAllocs[n]);
+    Blocks.clear();
+    LargeAllocs.clear();
+    UsedBytes = BlocksUsedBytes = CurrOff = 0;
+    UnderusedFrames = 0;
+    ReleasePending = false;
+}
+
+void* ImGui::MemAllocFrame(size_t size)
+{
+    ImGuiContext& g = *GImGui;
+    return g.FrameArena.Alloc(size);
+}
+
+ImGuiMemTag ImGui::SetMemTag(ImGuiMemTag tag)
+{
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(tag >= 0 && tag < ImGuiMemTag_COUNT);
+    ImGuiMemTag backup_tag = g.MemTagCurrent;
+    g.MemTagCurrent = tag;
+    return backup_tag;
+}
+
+const ImGuiMemTagStats* ImGui::GetMemTagStats(ImGuiMemTag tag)
+{
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(tag >= 0 && tag < ImGuiMemTag_COUNT);
+    return &g.MemTagStats->Tags[tag];
+}
+
+const char* ImGui::GetMemTagName(ImGuiMemTag tag)
+{
+    static const char* names[] = { "Misc", "Windows", "DrawList", "Fonts", "Tables", "Docking", "Viewports", "Storage", "Settings", "InputText", "FrameArena" };
+    IM_STATIC_ASSERT(IM_ARRAYSIZE(names) == ImGuiMemTag_COUNT);
+    IM_ASSERT(tag >= 0 && tag < ImGuiMemTag_COUNT);
+    return names[tag];
+}
+
 const char* ImGui::GetClipboardText()
 {
     ImGuiContext& g = *GImGui;
@@ -3791,6 +4724,7 @@ void ImGui::GetAllocatorFunctions(ImGuiMemAllocFunc* p_alloc_func, ImGuiMemFreeF
 ImGuiContext* ImGui::CreateContext(ImFontAtlas* shared_font_atlas)
 {
     ImGuiContext* ctx = IM_NEW(ImGuiContext)(shared_font_atlas);
+    ctx->MemTagStats = MemTagStatsCreate();
     if (GImGui == NULL)
         SetCurrentContext(ctx);
     Initialize(ctx);
@@ -3804,6 +4738,8 @@ void ImGui::DestroyContext(ImGuiContext* ctx)
     Shutdown(ctx);
     if (GImGui == ctx)
         SetCurrentContext(NULL);
+    MemTagStatsRelease(ctx->MemTagStats);
+    ctx->MemTagStats = NULL;
     IM_DELETE(ctx);
 }
 
@@ -4093,6 +5029,7 @@ static void TranslateWindow(ImGuiWindow* window, const ImVec2& delta)
     window->Pos += delta;
     window->ClipRect.Translate(delta);
     window->OuterRectClipped.Translate(delta);
+    UpdateWindowHoverGrid(window);
     window->InnerRect.Translate(delta);
     window->DC.CursorPos += delta;
     window->DC.CursorStartPos += delta;
@@ -4341,6 +5278,7 @@ void ImGui::UpdateMouseWheel()
 // The reason this is exposed in imgui_internal.h is: on touch-based system that don't have hovering, we want to dispatch inputs to the right target (imgui vs imgui+app)
 void ImGui::UpdateHoveredWindowAndCaptureFlags()
 {
+    IMGUI_PROFILE_SCOPE("UpdateHoveredWindowAndCaptureFlags");
     ImGuiContext& g = *GImGui;
     ImGuiIO& io = g.IO;
     g.WindowsHoverPadding = ImMax(g.Style.TouchExtraPadding, ImVec2(WINDOWS_HOVER_PADDING, WINDOWS_HOVER_PADDING));
@@ -4431,6 +5369,10 @@ void ImGui::NewFrame()
 {
     IM_ASSERT(GImGui != NULL && "No current context. Did you call ImGui::CreateContext() and ImGui::SetCurrentContext() ?");
     ImGuiContext& g = *GImGui;
+#ifdef IMGUI_ENABLE_PROFILER
+    ProfilerUpdateStats(&g.Profiler, g.FrameCount);
+#endif
+    IMGUI_PROFILE_SCOPE("NewFrame");
 
     // Remove pending delete hooks before frame start.
     // This deferred removal avoid issues of removal while iterating the hook vector
@@ -4451,6 +5393,12 @@ void ImGui::NewFrame()
     g.Time += g.IO.DeltaTime;
     g.WithinFrameScope = true;
     g.FrameCount += 1;
+    g.FrameArena.Reset();
+    for (int tag = 0; tag < ImGuiMemTag_COUNT; tag++)
+    {
+        g.MemTagStats->Tags[tag].AllocsLastFrame = g.MemTagStats->Tags[tag].AllocsThisFrame;
+        g.MemTagStats->Tags[tag].AllocsThisFrame = 0;
+    }
     g.TooltipOverrideCount = 0;
     g.WindowsActiveCount = 0;
     g.MenusIdSubmittedThisFrame.resize(0);
@@ -4592,32 +5540,22 @@ void ImGui::NewFrame()
     // Mouse wheel scrolling, scale
     UpdateMouseWheel();
 
-    // Mark all windows as not visible and compact unused memory.
+    // Mark all windows as not visible
     IM_ASSERT(g.WindowsFocusOrder.Size <= g.Windows.Size);
-    const float memory_compact_start_time = (g.GcCompactAll || g.IO.ConfigMemoryCompactTimer < 0.0f) ? FLT_MAX : (float)g.Time - g.IO.ConfigMemoryCompactTimer;
+    g.WindowsWasActiveCount = 0;
     for (int i = 0; i != g.Windows.Size; i++)
     {
         ImGuiWindow* window = g.Windows[i];
         window->WasActive = window->Active;
+        if (window->WasActive)
+            g.WindowsWasActiveCount++;
         window->BeginCount = 0;
         window->Active = false;
         window->WriteAccessed = false;
-
-        // Garbage collect transient buffers of recently unused windows
-        if (!window->WasActive && !window->MemoryCompacted && window->LastTimeActive < memory_compact_start_time)
-            GcCompactTransientWindowBuffers(window);
     }
 
-    // Garbage collect transient buffers of recently unused tables
-    for (int i = 0; i < g.TablesLastTimeActive.Size; i++)
-        if (g.TablesLastTimeActive[i] >= 0.0f && g.TablesLastTimeActive[i] < memory_compact_start_time)
-            TableGcCompactTransientBuffers(g.Tables.GetByIndex(i));
-    for (int i = 0; i < g.TablesTempData.Size; i++)
-        if (g.TablesTempData[i].LastTimeActive >= 0.0f && g.TablesTempData[i].LastTimeActive < memory_compact_start_time)
-            TableGcCompactTransientBuffers(&g.TablesTempData[i]);
-    if (g.GcCompactAll)
-        GcCompactTransientMiscBuffers();
-    g.GcCompactAll = false;
+    // Compact unused memory
+    GcUpdateTransientBuffers();
 
     // Closing the focused window restore focus to the first active root window in descending z-order
     if (g.NavWindow && !g.NavWindow->WasActive)
@@ -4664,6 +5602,8 @@ void ImGui::Initialize(ImGuiContext* context)
         ini_handler.ReadLineFn = WindowSettingsHandler_ReadLine;
         ini_handler.ApplyAllFn = WindowSettingsHandler_ApplyAll;
         ini_handler.WriteAllFn = WindowSettingsHandler_WriteAll;
+        ini_handler.ReadAllBinaryFn = WindowSettingsHandler_ReadAllBinary;
+        ini_handler.WriteAllBinaryFn = WindowSettingsHandler_WriteAllBinary;
         g.SettingsHandlers.push_back(ini_handler);
     }
 
@@ -4711,6 +5651,11 @@ void ImGui::Shutdown(ImGuiContext* context)
         SaveIniSettingsToDisk(g.IO.IniFilename);
         SetCurrentContext(backup_context);
     }
+    if (g.SettingsIniWriter)
+    {
+        ImFileWriterDestroy(g.SettingsIniWriter);
+        g.SettingsIniWriter = NULL;
+    }
 
     // Destroy platform windows
     ImGuiContext* backup_context = ImGui::GetCurrentContext();
@@ -4727,6 +5672,7 @@ void ImGui::Shutdown(ImGuiContext* context)
     g.Windows.clear_delete();
     g.WindowsFocusOrder.clear();
     g.WindowsTempSortBuffer.clear();
+    g.WindowsHoverGrid.Clear();
     g.CurrentWindow = NULL;
     g.CurrentWindowStack.clear();
     g.WindowsById.Clear();
@@ -4739,6 +5685,9 @@ void ImGui::Shutdown(ImGuiContext* context)
     g.FontStack.clear();
     g.OpenPopupStack.clear();
     g.BeginPopupStack.clear();
+    g.NavMoveIndexItems.clear();
+    g.NavMoveIndexItemsNext.clear();
+    g.NavMoveIndexWindow = g.NavMoveIndexWindowNext = NULL;
 
     g.CurrentViewport = g.MouseViewport = g.MouseLastHoveredViewport = NULL;
     g.Viewports.clear_delete();
@@ -4752,13 +5701,17 @@ void ImGui::Shutdown(ImGuiContext* context)
     g.Tables.Clear();
     g.TablesTempData.clear_destruct();
     g.DrawChannelsTempMergeBuffer.clear();
+    g.DrawChannelsTempMergeMasks.clear();
 
     g.ClipboardHandlerData.clear();
     g.MenusIdSubmittedThisFrame.clear();
     g.InputTextState.ClearFreeMemory();
+    g.FrameArena.Clear();
 
     g.SettingsWindows.clear();
     g.SettingsHandlers.clear();
+    g.SettingsIniDataPrev.clear();
+    g.SettingsBinaryData.clear();
 
     if (g.LogFile)
     {
@@ -4768,21 +5721,33 @@ void ImGui::Shutdown(ImGuiContext* context)
             ImFileClose(g.LogFile);
         g.LogFile = NULL;
     }
+    if (g.LogFileStream)
+    {
+        ImFileStreamClose(g.LogFileStream);
+        g.LogFileStream = NULL;
+    }
     g.LogBuffer.clear();
 
     g.Initialized = false;
 }
 
+// Child windows are kept in DC.ChildWindows[] in this order: regular child windows, then child tooltips, then child popups
+// (a popup which is also a tooltip sorts last). This matches the order of the former ChildWindowComparer.
+// Within each group they are in Begin() order (BeginOrderWithinParent).
 // FIXME: Add a more explicit sort order in the window structure.
-static int IMGUI_CDECL ChildWindowComparer(const void* lhs, const void* rhs)
+static int GetChildWindowSortGroup(ImGuiWindowFlags flags)
+{
+    return ((flags & ImGuiWindowFlags_Popup) ? 2 : 0) + ((flags & ImGuiWindowFlags_Tooltip) ? 1 : 0);
+}
+
+static void AddChildWindowToParent(ImGuiWindow* parent_window, ImGuiWindow* window)
 {
-    const ImGuiWindow* const a = *(const ImGuiWindow* const *)lhs;
-    const ImGuiWindow* const b = *(const ImGuiWindow* const *)rhs;
-    if (int d = (a->Flags & ImGuiWindowFlags_Popup) - (b->Flags & ImGuiWindowFlags_Popup))
-        return d;
-    if (int d = (a->Flags & ImGuiWindowFlags_Tooltip) - (b->Flags & ImGuiWindowFlags_Tooltip))
-        return d;
-    return (a->BeginOrderWithinParent - b->BeginOrderWithinParent);
+    ImVector<ImGuiWindow*>& child_windows = parent_window->DC.ChildWindows;
+    const int sort_group = GetChildWindowSortGroup(window->Flags);
+    int insert_n = child_windows.Size;
+    while (insert_n > 0 && GetChildWindowSortGroup(child_windows[insert_n - 1]->Flags) > sort_group)
+        insert_n--;
+    child_windows.insert(child_windows.Data + insert_n, window);
 }
 
 static void AddWindowToSortBuffer(ImVector<ImGuiWindow*>* out_sorted_windows, ImGuiWindow* window)
@@ -4791,7 +5756,6 @@ static void AddWindowToSortBuffer(ImVector<ImGuiWindow*>* out_sorted_windows, Im
     if (window->Active)
     {
         int count = window->DC.ChildWindows.Size;
-        ImQsort(window->DC.ChildWindows.Data, (size_t)count, sizeof(ImGuiWindow*), ChildWindowComparer);
         for (int i = 0; i < count; i++)
         {
             ImGuiWindow* child = window->DC.ChildWindows[i];
@@ -4801,6 +5765,26 @@ static void AddWindowToSortBuffer(ImVector<ImGuiWindow*>* out_sorted_windows, Im
     }
 }
 
+// Sort the window list so that all child windows are after their parent
+static void BuildWindowsDisplayOrder(ImVector<ImGuiWindow*>* out_sorted_windows)
+{
+    ImGuiContext& g = *GImGui;
+    out_sorted_windows->resize(0);
+    out_sorted_windows->reserve(g.Windows.Size);
+    for (int i = 0; i != g.Windows.Size; i++)
+    {
+        ImGuiWindow* window = g.Windows[i];
+        if (window->Active && (window->Flags & ImGuiWindowFlags_ChildWindow))       // if a child is active its parent will add it
+            continue;
+        AddWindowToSortBuffer(out_sorted_windows, window);
+    }
+
+    // This usually assert if there is a mismatch between the ImGuiWindowFlags_ChildWindow / ParentWindow values and DC.ChildWindows[] in parents, aka we've done something wrong.
+    IM_ASSERT(g.Windows.Size == out_sorted_windows->Size);
+    for (int i = 0; i != out_sorted_windows->Size; i++)
+        (*out_sorted_windows)[i]->DisplayIndex = i;
+}
+
 static void AddDrawListToDrawData(ImVector<ImDrawList*>* out_list, ImDrawList* draw_list)
 {
     if (draw_list->CmdBuffer.Size == 0)
@@ -5050,9 +6034,87 @@ static void ImGui::RenderDimmedBackgrounds()
     }
 }
 
+// Request another frame within 'delay' seconds. The lowest requested delay is folded into io.WantRedrawDelay by UpdateWantRedrawDelay().
+void ImGui::RequestRedraw(float delay)
+{
+    ImGuiContext& g = *GImGui;
+    delay = ImMax(delay, 0.0f);
+    g.RedrawRequestDelay = ImMin(g.RedrawRequestDelay, delay);
+    g.IO.WantRedrawDelay = ImMin(g.IO.WantRedrawDelay, delay); // In case we are called after EndFrame()
+}
+
+// Called by EndFrame(). Predict when the next frame is needed if no input arrives, for applications which want to idle.
+// Anything animating or waiting on a timer needs to be accounted for here. When in doubt we request a frame right away.
+static void ImGui::UpdateWantRedrawDelay()
+{
+    ImGuiContext& g = *GImGui;
+    float delay = g.RedrawRequestDelay;
+    g.RedrawRequestDelay = FLT_MAX;
+
+    // Pending input events (trickled to next frame), first frames, pending requests, animations driven by io.DeltaTime
+    bool redraw_now = (g.InputEventsQueue.Size > 0) || (g.FrameCount < 3);
+    redraw_now |= g.NavAnyRequest || g.NavInitRequest || g.NavMoveScoringItems || (g.NavWindowingTarget != NULL) || (g.NavWindowingTargetAnim != NULL);
+    redraw_now |= (g.DimBgRatio > 0.0f && g.DimBgRatio < 1.0f) || g.DragDropActive;
+    redraw_now |= (g.DockContext.Requests.Size > 0) || g.DockContext.WantFullRebuild;
+
+    // Held mouse buttons and keys may trigger repeats (repeating buttons, scrollbar clicks, navigation)
+    for (int n = 0; n < IM_ARRAYSIZE(g.IO.MouseDown) && !redraw_now; n++)
+        redraw_now |= g.IO.MouseDown[n];
+    for (int n = ImGuiKey_NamedKey_BEGIN; n < ImGuiKey_NamedKey_END && !redraw_now; n++)
+        if (n < ImGuiKey_ModCtrl || n > ImGuiKey_ModSuper)
+            redraw_now |= GetKeyData(n)->Down;
+
+    // Windows appearing, auto-fitting or scrolling toward a target
+    for (int n = 0; n < g.Windows.Size && !redraw_now; n++)
+    {
+        ImGuiWindow* window = g.Windows[n];
+        if (!window->WasActive)
+            continue;
+        redraw_now |= (window->AutoFitFramesX > 0 || window->AutoFitFramesY > 0);
+        redraw_now |= (window->HiddenFramesCanSkipItems > 0 || window->HiddenFramesCannotSkipItems > 0 || window->HiddenFramesForRenderOnly > 0);
+        redraw_now |= (window->ScrollTarget.x != FLT_MAX || window->ScrollTarget.y != FLT_MAX);
+    }
+
+    // Tab bars scrolling or changing selection, tables auto-fitting columns
+    for (int n = 0; n < g.TabBars.GetMapSize() && !redraw_now; n++)
+        if (ImGuiTabBar* tab_bar = g.TabBars.TryGetMapData(n))
+            if (tab_bar->PrevFrameVisible == g.FrameCount)
+                redraw_now |= (tab_bar->ScrollingAnim != tab_bar->ScrollingTarget) || (tab_bar->NextSelectedTabId != 0) || (tab_bar->ReorderRequestTabId != 0);
+    for (int n = 0; n < g.Tables.GetMapSize() && !redraw_now; n++)
+        if (ImGuiTable* table = g.Tables.TryGetMapData(n))
+            if (table->LastFrameActive == g.FrameCount)
+                for (int column_n = 0; column_n < table->ColumnsCount && !redraw_now; column_n++)
+                    redraw_now |= (table->Columns[column_n].AutoFitQueue != 0 || table->Columns[column_n].CannotSkipItemsQueue != 0);
+
+    if (redraw_now)
+    {
+        g.IO.WantRedrawDelay = 0.0f;
+        return;
+    }
+
+    // Blinking text cursor
+    if (g.IO.ConfigInputTextCursorBlink && g.ActiveId != 0 && g.ActiveId == g.InputTextState.ID)
+    {
+        const float anim = g.InputTextState.CursorAnim;
+        const float t = ImFmod(ImMax(anim, 0.0f), 1.20f);
+        delay = ImMin(delay, (anim < 0.0f) ? -anim + 0.80f : (t <= 0.80f) ? 0.80f - t : 1.20f - t);
+    }
+
+    // Delayed tooltips
+    if (g.HoveredId != 0 && g.HoveredId != g.ActiveId && g.HoveredIdNotActiveTimer < g.TooltipSlowDelay)
+        delay = ImMin(delay, g.TooltipSlowDelay - g.HoveredIdNotActiveTimer);
+
+    // Saving .ini settings
+    if (g.SettingsDirtyTimer > 0.0f)
+        delay = ImMin(delay, g.SettingsDirtyTimer);
+
+    g.IO.WantRedrawDelay = delay;
+}
+
 // This is normally called by Render(). You may want to call it directly if you want to avoid calling Render() but the gain will be very minimal.
 void ImGui::EndFrame()
 {
+    IMGUI_PROFILE_SCOPE("EndFrame");
     ImGuiContext& g = *GImGui;
     IM_ASSERT(g.Initialized);
 
@@ -5074,8 +6136,14 @@ void ImGui::EndFrame()
 
     // Hide implicit/fallback "Debug" window if it hasn't been used
     g.WithinFrameScopeWithImplicitWindow = false;
+    int windows_active_count = g.WindowsActiveCount;
     if (g.CurrentWindow && !g.CurrentWindow->WriteAccessed)
+    {
         g.CurrentWindow->Active = false;
+        windows_active_count--;
+    }
+    if (g.CurrentWindow && g.CurrentWindow->Active != g.CurrentWindow->WasActive) // Begin() doesn't set WindowsDisplayOrderDirty for the fallback window
+        g.WindowsDisplayOrderDirty = true;
     End();
 
     // Update navigation: CTRL+Tab, wrap-around requests
@@ -5115,24 +6183,32 @@ void ImGui::EndFrame()
 
     // Sort the window list so that all child windows are after their parent
     // We cannot do that on FocusWindow() because children may not exist yet
-    g.WindowsTempSortBuffer.resize(0);
-    g.WindowsTempSortBuffer.reserve(g.Windows.Size);
-    for (int i = 0; i != g.Windows.Size; i++)
+    // Sorting again gives the same result unless a window was created, brought to front/back, activated or deactivated,
+    // or a child window changed parent or order within its parent (all of which set WindowsDisplayOrderDirty).
+    // If no window was newly activated, the windows active this frame are a subset of the ones active last frame: compare counts to detect deactivations.
+    if (windows_active_count != g.WindowsWasActiveCount)
+        g.WindowsDisplayOrderDirty = true;
+    if (g.WindowsDisplayOrderDirty)
     {
-        ImGuiWindow* window = g.Windows[i];
-        if (window->Active && (window->Flags & ImGuiWindowFlags_ChildWindow))       // if a child is active its parent will add it
-            continue;
-        AddWindowToSortBuffer(&g.WindowsTempSortBuffer, window);
+        BuildWindowsDisplayOrder(&g.WindowsTempSortBuffer);
+        g.Windows.swap(g.WindowsTempSortBuffer);
+        g.WindowsDisplayOrderDirty = false;
+    }
+    else
+    {
+#ifdef IMGUI_DEBUG_PARANOID
+        BuildWindowsDisplayOrder(&g.WindowsTempSortBuffer);
+        IM_ASSERT_PARANOID(memcmp(g.Windows.Data, g.WindowsTempSortBuffer.Data, (size_t)g.Windows.Size * sizeof(ImGuiWindow*)) == 0);
+#endif
     }
-
-    // This usually assert if there is a mismatch between the ImGuiWindowFlags_ChildWindow / ParentWindow values and DC.ChildWindows[] in parents, aka we've done something wrong.
-    IM_ASSERT(g.Windows.Size == g.WindowsTempSortBuffer.Size);
-    g.Windows.swap(g.WindowsTempSortBuffer);
     g.IO.MetricsActiveWindows = g.WindowsActiveCount;
 
     // Unlock font atlas
     g.IO.Fonts->Locked = false;
 
+    // Predict when next frame is needed
+    UpdateWantRedrawDelay();
+
     // Clear Input data for next frame
     g.IO.MouseWheel = g.IO.MouseWheelH = 0.0f;
     g.IO.InputQueueCharacters.resize(0);
@@ -5147,6 +6223,8 @@ void ImGui::EndFrame()
 // it is the role of the ImGui_ImplXXXX_RenderDrawData() function provided by the renderer backend)
 void ImGui::Render()
 {
+    IMGUI_PROFILE_SCOPE("Render");
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_DrawList);
     ImGuiContext& g = *GImGui;
     IM_ASSERT(g.Initialized);
 
@@ -5238,10 +6316,171 @@ ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_tex
     return text_size;
 }
 
+//-----------------------------------------------------------------------------
+// Hovered window lookup: spatial hash of windows rectangles
+//-----------------------------------------------------------------------------
+
+static inline ImGuiID WindowHoverGridCellKey(int x, int y)
+{
+    return ((ImU32)(ImU16)x << 16) | (ImU32)(ImU16)y;
+}
+
+static inline int WindowHoverGridCellCoord(float v)
+{
+    return ImClamp((int)ImFloor(v * (1.0f / IMGUI_WINDOW_HOVER_GRID_CELL_SIZE)), -32768, 32767);
+}
+
+static void WindowHoverGridRemove(ImGuiWindowHoverGrid* grid, ImGuiWindow* window)
+{
+    if (window->HoverGridState == 2)
+    {
+        grid->LargeWindows.find_erase_unsorted(window);
+    }
+    else if (window->HoverGridState == 1)
+    {
+        for (int y = window->HoverGridCellMin.y; y <= window->HoverGridCellMax.y; y++)
+            for (int x = window->HoverGridCellMin.x; x <= window->HoverGridCellMax.x; x++)
+            {
+                int* p_node_idx = grid->Cells.GetIntRef(WindowHoverGridCellKey(x, y), -1);
+                while (*p_node_idx != -1 && grid->Nodes[*p_node_idx].Window != window)
+                    p_node_idx = &grid->Nodes[*p_node_idx].Next;
+                IM_ASSERT(*p_node_idx != -1);
+                const int node_idx = *p_node_idx;
+                *p_node_idx = grid->Nodes[node_idx].Next;
+                grid->Nodes[node_idx].Next = grid->FreeNodes;
+                grid->FreeNodes = node_idx;
+            }
+    }
+    window->HoverGridState = 0;
+}
+
+// Called whenever window->OuterRectClipped is modified
+static void UpdateWindowHoverGrid(ImGuiWindow* window)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindowHoverGrid* grid = &g.WindowsHoverGrid;
+    const ImRect& r = window->OuterRectClipped;
+    if (r.Min.x >= r.Max.x || r.Min.y >= r.Max.y)
+    {
+        if (window->HoverGridState != 0)
+            WindowHoverGridRemove(grid, window);
+        return;
+    }
+
+    // Early out when covering the same cells as before
+    const ImVec2ih cell_min((short)WindowHoverGridCellCoord(r.Min.x), (short)WindowHoverGridCellCoord(r.Min.y));
+    const ImVec2ih cell_max((short)WindowHoverGridCellCoord(r.Max.x), (short)WindowHoverGridCellCoord(r.Max.y));
+    if (window->HoverGridState != 0 && window->HoverGridCellMin.x == cell_min.x && window->HoverGridCellMin.y == cell_min.y && window->HoverGridCellMax.x == cell_max.x && window->HoverGridCellMax.y == cell_max.y)
+        return;
+
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_Windows);
+    WindowHoverGridRemove(grid, window);
+    window->HoverGridCellMin = cell_min;
+    window->HoverGridCellMax = cell_max;
+    const int cells_count = (cell_max.x - cell_min.x + 1) * (cell_max.y - cell_min.y + 1);
+    if (cells_count > IMGUI_WINDOW_HOVER_GRID_MAX_CELLS)
+    {
+        grid->LargeWindows.push_back(window);
+        window->HoverGridState = 2;
+        return;
+    }
+    for (int y = cell_min.y; y <= cell_max.y; y++)
+        for (int x = cell_min.x; x <= cell_max.x; x++)
+        {
+            int node_idx = grid->FreeNodes;
+            if (node_idx != -1)
+            {
+                grid->FreeNodes = grid->Nodes[node_idx].Next;
+            }
+            else
+            {
+                node_idx = grid->Nodes.Size;
+                grid->Nodes.resize(grid->Nodes.Size + 1);
+            }
+            int* p_head_idx = grid->Cells.GetIntRef(WindowHoverGridCellKey(x, y), -1);
+            grid->Nodes[node_idx].Window = window;
+            grid->Nodes[node_idx].Next = *p_head_idx;
+            *p_head_idx = node_idx;
+        }
+    window->HoverGridState = 1;
+}
+
+// Test if the mouse is over the window, excluding the window being moved
+static bool IsMouseOverWindowForHovering(ImGuiWindow* window, const ImVec2& padding_regular, const ImVec2& padding_for_resize)
+{
+    ImGuiContext& g = *GImGui;
+    IM_MSVC_WARNING_SUPPRESS(28182); // [Static Analyzer] Dereferencing NULL pointer.
+    if (!window->Active || window->Hidden)
+        return false;
+    if (window->Flags & ImGuiWindowFlags_NoMouseInputs)
+        return false;
+    IM_ASSERT(window->Viewport);
+    if (window->Viewport != g.MouseViewport)
+        return false;
+
+    // Using the clipped AABB, a child window will typically be clipped by its parent (not always)
+    ImRect bb(window->OuterRectClipped);
+    if (window->Flags & (ImGuiWindowFlags_ChildWindow | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_AlwaysAutoResize))
+        bb.Expand(padding_regular);
+    else
+        bb.Expand(padding_for_resize);
+    if (!bb.Contains(g.IO.MousePos))
+        return false;
+
+    // Support for one rectangular hole in any given window
+    // FIXME: Consider generalizing hit-testing override (with more generic data, callback, etc.) (#1512)
+    if (window->HitTestHoleSize.x != 0)
+    {
+        ImVec2 hole_pos(window->Pos.x + (float)window->HitTestHoleOffset.x, window->Pos.y + (float)window->HitTestHoleOffset.y);
+        ImVec2 hole_size((float)window->HitTestHoleSize.x, (float)window->HitTestHoleSize.y);
+        if (ImRect(hole_pos, hole_pos + hole_size).Contains(g.IO.MousePos))
+            return false;
+    }
+    return true;
+}
+
+// Test all windows front-to-back
+static void FindHoveredWindowInDisplayOrder(const ImVec2& padding_regular, const ImVec2& padding_for_resize, ImGuiWindow** p_hovered_window, ImGuiWindow** p_hovered_window_ignoring_moving_window)
+{
+    ImGuiContext& g = *GImGui;
+    for (int i = g.Windows.Size - 1; i >= 0; i--)
+    {
+        ImGuiWindow* window = g.Windows[i];
+        if (!IsMouseOverWindowForHovering(window, padding_regular, padding_for_resize))
+            continue;
+
+        if (*p_hovered_window == NULL)
+            *p_hovered_window = window;
+        IM_MSVC_WARNING_SUPPRESS(28182); // [Static Analyzer] Dereferencing NULL pointer.
+        if (*p_hovered_window_ignoring_moving_window == NULL && (!g.MovingWindow || window->RootWindowDockTree != g.MovingWindow->RootWindowDockTree))
+            *p_hovered_window_ignoring_moving_window = window;
+        if (*p_hovered_window && *p_hovered_window_ignoring_moving_window)
+            break;
+    }
+}
+
+// Keep the front-most hovered windows among candidates given in any order
+static void FindHoveredWindowTestCandidate(ImGuiWindow* window, const ImVec2& padding_regular, const ImVec2& padding_for_resize, ImGuiWindow** p_hovered_window, ImGuiWindow** p_hovered_window_ignoring_moving_window)
+{
+    ImGuiContext& g = *GImGui;
+    const bool can_be_hovered = (*p_hovered_window == NULL || (*p_hovered_window)->DisplayIndex < window->DisplayIndex);
+    const bool can_be_hovered_ignoring_moving_window = (*p_hovered_window_ignoring_moving_window == NULL || (*p_hovered_window_ignoring_moving_window)->DisplayIndex < window->DisplayIndex) && (!g.MovingWindow || window->RootWindowDockTree != g.MovingWindow->RootWindowDockTree);
+    if (!can_be_hovered && !can_be_hovered_ignoring_moving_window)
+        return;
+    if (!IsMouseOverWindowForHovering(window, padding_regular, padding_for_resize))
+        return;
+    if (can_be_hovered)
+        *p_hovered_window = window;
+    if (can_be_hovered_ignoring_moving_window)
+        *p_hovered_window_ignoring_moving_window = window;
+}
+
 // Find window given position, search front-to-back
 // FIXME: Note that we have an inconsequential lag here: OuterRectClipped is updated in Begin(), so windows moved programmatically
 // with SetWindowPos() and not SetNextWindowPos() will have that rectangle lagging by a frame at the time FindHoveredWindow() is
 // called, aka before the next Begin(). Moving window isn't affected.
+// When the display order is known (!g.WindowsDisplayOrderDirty), we only test windows registered in g.WindowsHoverGrid cells
+// near the mouse and keep the front-most ones, instead of testing every window.
 static void FindHoveredWindow()
 {
     ImGuiContext& g = *GImGui;
@@ -5258,45 +6497,36 @@ static void FindHoveredWindow()
 
     ImVec2 padding_regular = g.Style.TouchExtraPadding;
     ImVec2 padding_for_resize = g.IO.ConfigWindowsResizeFromEdges ? g.WindowsHoverPadding : padding_regular;
-    for (int i = g.Windows.Size - 1; i >= 0; i--)
-    {
-        ImGuiWindow* window = g.Windows[i];
-        IM_MSVC_WARNING_SUPPRESS(28182); // [Static Analyzer] Dereferencing NULL pointer.
-        if (!window->Active || window->Hidden)
-            continue;
-        if (window->Flags & ImGuiWindowFlags_NoMouseInputs)
-            continue;
-        IM_ASSERT(window->Viewport);
-        if (window->Viewport != g.MouseViewport)
-            continue;
-
-        // Using the clipped AABB, a child window will typically be clipped by its parent (not always)
-        ImRect bb(window->OuterRectClipped);
-        if (window->Flags & (ImGuiWindowFlags_ChildWindow | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_AlwaysAutoResize))
-            bb.Expand(padding_regular);
-        else
-            bb.Expand(padding_for_resize);
-        if (!bb.Contains(g.IO.MousePos))
-            continue;
-
-        // Support for one rectangular hole in any given window
-        // FIXME: Consider generalizing hit-testing override (with more generic data, callback, etc.) (#1512)
-        if (window->HitTestHoleSize.x != 0)
-        {
-            ImVec2 hole_pos(window->Pos.x + (float)window->HitTestHoleOffset.x, window->Pos.y + (float)window->HitTestHoleOffset.y);
-            ImVec2 hole_size((float)window->HitTestHoleSize.x, (float)window->HitTestHoleSize.y);
-            if (ImRect(hole_pos, hole_pos + hole_size).Contains(g.IO.MousePos))
-                continue;
-        }
-
+    if (g.WindowsDisplayOrderDirty)
+    {
+        FindHoveredWindowInDisplayOrder(padding_regular, padding_for_resize, &hovered_window, &hovered_window_ignoring_moving_window);
+    }
+    else if (ImGui::IsMousePosValid(&g.IO.MousePos))
+    {
+        // Windows are registered with their unpadded rectangle: look into every cell within padding distance of the mouse.
+        ImGuiWindowHoverGrid* grid = &g.WindowsHoverGrid;
+        const ImVec2 padding = ImMax(padding_regular, padding_for_resize);
+        const int cell_min_x = WindowHoverGridCellCoord(g.IO.MousePos.x - padding.x), cell_max_x = WindowHoverGridCellCoord(g.IO.MousePos.x + padding.x);
+        const int cell_min_y = WindowHoverGridCellCoord(g.IO.MousePos.y - padding.y), cell_max_y = WindowHoverGridCellCoord(g.IO.MousePos.y + padding.y);
+        ImGuiWindow* hovered_window_candidate = NULL;
+        for (int y = cell_min_y; y <= cell_max_y; y++)
+            for (int x = cell_min_x; x <= cell_max_x; x++)
+                for (int node_idx = grid->Cells.GetInt(WindowHoverGridCellKey(x, y), -1); node_idx != -1; node_idx = grid->Nodes[node_idx].Next)
+                    FindHoveredWindowTestCandidate(grid->Nodes[node_idx].Window, padding_regular, padding_for_resize, &hovered_window_candidate, &hovered_window_ignoring_moving_window);
+        for (int n = 0; n < grid->LargeWindows.Size; n++)
+            FindHoveredWindowTestCandidate(grid->LargeWindows[n], padding_regular, padding_for_resize, &hovered_window_candidate, &hovered_window_ignoring_moving_window);
         if (hovered_window == NULL)
-            hovered_window = window;
-        IM_MSVC_WARNING_SUPPRESS(28182); // [Static Analyzer] Dereferencing NULL pointer.
-        if (hovered_window_ignoring_moving_window == NULL && (!g.MovingWindow || window->RootWindowDockTree != g.MovingWindow->RootWindowDockTree))
-            hovered_window_ignoring_moving_window = window;
-        if (hovered_window && hovered_window_ignoring_moving_window)
-            break;
+            hovered_window = hovered_window_candidate;
+    }
+#ifdef IMGUI_DEBUG_PARANOID
+    if (!g.WindowsDisplayOrderDirty)
+    {
+        ImGuiWindow* hovered_window_linear = (g.MovingWindow && !(g.MovingWindow->Flags & ImGuiWindowFlags_NoMouseInputs)) ? g.MovingWindow : NULL;
+        ImGuiWindow* hovered_window_ignoring_moving_window_linear = NULL;
+        FindHoveredWindowInDisplayOrder(padding_regular, padding_for_resize, &hovered_window_linear, &hovered_window_ignoring_moving_window_linear);
+        IM_ASSERT_PARANOID(hovered_window == hovered_window_linear && hovered_window_ignoring_moving_window == hovered_window_ignoring_moving_window_linear);
     }
+#endif
 
     g.HoveredWindow = hovered_window;
     g.HoveredWindowUnderMovingWindow = hovered_window_ignoring_moving_window;
@@ -5641,6 +6871,7 @@ static void UpdateWindowInFocusOrderList(ImGuiWindow* window, bool just_created,
 
 static ImGuiWindow* CreateNewWindow(const char* name, ImGuiWindowFlags flags)
 {
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_Windows);
     ImGuiContext& g = *GImGui;
     //IMGUI_DEBUG_LOG("CreateNewWindow '%s', flags = 0x%08X\n", name, flags);
 
@@ -5683,6 +6914,7 @@ static ImGuiWindow* CreateNewWindow(const char* name, ImGuiWindowFlags flags)
         g.Windows.push_front(window); // Quite slow but rare and only once
     else
         g.Windows.push_back(window);
+    g.WindowsDisplayOrderDirty = true;
     UpdateWindowInFocusOrderList(window, true, window->Flags);
 
     return window;
@@ -6301,6 +7533,8 @@ void ImGui::RenderWindowTitleBarContents(ImGuiWindow* window, const ImRect& titl
 
 void ImGui::UpdateWindowParentAndRootLinks(ImGuiWindow* window, ImGuiWindowFlags flags, ImGuiWindow* parent_window)
 {
+    if (window->ParentWindow != parent_window)
+        GImGui->WindowsDisplayOrderDirty = true;
     window->ParentWindow = parent_window;
     window->RootWindow = window->RootWindowPopupTree = window->RootWindowDockTree = window->RootWindowForTitleBarHighlight = window->RootWindowForNav = window;
     if (parent_window && (flags & ImGuiWindowFlags_ChildWindow) && !(flags & ImGuiWindowFlags_Tooltip))
@@ -6361,6 +7595,7 @@ static ImGuiWindow* ImGui::FindBlockingModal(ImGuiWindow* window)
 // - Passing 'bool* p_open' displays a Close button on the upper-right corner of the window, the pointed value will be set to false when the button is pressed.
 bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
 {
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_Windows);
     ImGuiContext& g = *GImGui;
     const ImGuiStyle& style = g.Style;
     IM_ASSERT(name != NULL && name[0] != '\0');     // Window name required
@@ -6374,6 +7609,9 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         window = CreateNewWindow(name, flags);
     else
         UpdateWindowInFocusOrderList(window, window_just_created, flags);
+#ifdef IMGUI_ENABLE_PROFILER
+    const ImU64 profiler_zone = ProfilerBeginZone("Window", window->ID);
+#endif
 
     // Automatically disable manual moving/resizing when NoInputs is set
     if ((flags & ImGuiWindowFlags_NoInputs) == ImGuiWindowFlags_NoInputs)
@@ -6397,8 +7635,11 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
 
     // Update Flags, LastFrameActive, BeginOrderXXX fields
     const bool window_was_appearing = window->Appearing;
+    const short begin_order_within_parent_prev = window->BeginOrderWithinParent;
     if (first_begin_of_the_frame)
     {
+        if (!window->WasActive && !window->IsFallbackWindow)
+            g.WindowsDisplayOrderDirty = true;
         window->Appearing = window_just_activated_by_user;
         if (window->Appearing)
             SetWindowConditionAllowFlags(window, ImGuiCond_Appearing, true);
@@ -6465,6 +7706,9 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
     window_stack_data.Window = window;
     window_stack_data.ParentLastItemDataBackup = g.LastItemData;
     window_stack_data.StackSizesOnBegin.SetToCurrentState();
+#ifdef IMGUI_ENABLE_PROFILER
+    window_stack_data.ProfilerZone = profiler_zone;
+#endif
     g.CurrentWindowStack.push_back(window_stack_data);
     g.CurrentWindow = NULL;
     if (flags & ImGuiWindowFlags_ChildMenu)
@@ -6708,11 +7952,17 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         }
 
         // Position child window
+        // (any change of parent, order within parent or kind of child window affects the display order of g.Windows[])
+        const ImGuiWindowFlags sort_flags_mask = ImGuiWindowFlags_ChildWindow | ImGuiWindowFlags_Popup | ImGuiWindowFlags_Tooltip;
+        if ((window->Flags ^ window->FlagsPreviousFrame) & sort_flags_mask)
+            g.WindowsDisplayOrderDirty = true;
         if (flags & ImGuiWindowFlags_ChildWindow)
         {
             IM_ASSERT(parent_window && parent_window->Active);
             window->BeginOrderWithinParent = (short)parent_window->DC.ChildWindows.Size;
-            parent_window->DC.ChildWindows.push_back(window);
+            if (window->BeginOrderWithinParent != begin_order_within_parent_prev)
+                g.WindowsDisplayOrderDirty = true;
+            AddChildWindowToParent(parent_window, window);
             if (!(flags & ImGuiWindowFlags_Popup) && !window_pos_set_by_api && !window_is_child_tooltip)
                 window->Pos = parent_window->DC.CursorPos;
         }
@@ -6884,6 +8134,7 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         if (window->DockIsActive)
             window->OuterRectClipped.Min.y += window->TitleBarHeight();
         window->OuterRectClipped.ClipWith(host_rect);
+        UpdateWindowHoverGrid(window);
 
         // Inner rectangle
         // Not affected by window border size. Used by:
@@ -6946,7 +8197,14 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
             {
                 // - We test overlap with the previous child window only (testing all would end up being O(log N) not a good investment here)
                 // - We disable this when the parent window has zero vertices, which is a common pattern leading to laying out multiple overlapping childs
-                ImGuiWindow* previous_child = parent_window->DC.ChildWindows.Size >= 2 ? parent_window->DC.ChildWindows[parent_window->DC.ChildWindows.Size - 2] : NULL;
+                // - Child popups/tooltips are sorted after regular child windows in DC.ChildWindows[], so we search for our position.
+                ImGuiWindow* previous_child = NULL;
+                for (int n = parent_window->DC.ChildWindows.Size - 1; n > 0; n--)
+                    if (parent_window->DC.ChildWindows[n] == window)
+                    {
+                        previous_child = parent_window->DC.ChildWindows[n - 1];
+                        break;
+                    }
                 bool previous_child_overlapping = previous_child ? previous_child->Rect().Overlaps(window->Rect()) : false;
                 bool parent_is_empty = parent_window->DrawList->VtxBuffer.Size > 0;
                 if (window->DrawList->CmdBuffer.back().ElemCount == 0 && parent_is_empty && !previous_child_overlapping)
@@ -7231,6 +8489,9 @@ void ImGui::End()
     if (window->Flags & ImGuiWindowFlags_Popup)
         g.BeginPopupStack.pop_back();
     g.CurrentWindowStack.back().StackSizesOnBegin.CompareWithCurrentState();
+#ifdef IMGUI_ENABLE_PROFILER
+    ProfilerEndZone(g.CurrentWindowStack.back().ProfilerZone);
+#endif
     g.CurrentWindowStack.pop_back();
     SetCurrentWindow(g.CurrentWindowStack.Size == 0 ? NULL : g.CurrentWindowStack.back().Window);
     if (g.CurrentWindow)
@@ -7269,6 +8530,7 @@ void ImGui::BringWindowToDisplayFront(ImGuiWindow* window)
         {
             memmove(&g.Windows[i], &g.Windows[i + 1], (size_t)(g.Windows.Size - i - 1) * sizeof(ImGuiWindow*));
             g.Windows[g.Windows.Size - 1] = window;
+            g.WindowsDisplayOrderDirty = true;
             break;
         }
 }
@@ -7283,6 +8545,7 @@ void ImGui::BringWindowToDisplayBack(ImGuiWindow* window)
         {
             memmove(&g.Windows[1], &g.Windows[0], (size_t)i * sizeof(ImGuiWindow*));
             g.Windows[0] = window;
+            g.WindowsDisplayOrderDirty = true;
             break;
         }
 }
@@ -7307,6 +8570,7 @@ void ImGui::BringWindowToDisplayBehind(ImGuiWindow* window, ImGuiWindow* behind_
         memmove(&g.Windows.Data[pos_beh + 1], &g.Windows.Data[pos_beh], copy_bytes);
         g.Windows[pos_beh] = window;
     }
+    g.WindowsDisplayOrderDirty = true;
 }
 
 int ImGui::FindWindowDisplayIndex(ImGuiWindow* window)
@@ -8542,8 +9806,12 @@ void ImGui::UpdateInputEvents(bool trickle_fast_inputs)
 
     // Record trail (for domain-specific applications wanting to access a precise trail)
     //if (event_n != 0) IMGUI_DEBUG_LOG("Processed: %d / Remaining: %d\n", event_n, g.InputEventsQueue.Size - event_n);
-    for (int n = 0; n < event_n; n++)
-        g.InputEventsTrail.push_back(g.InputEventsQueue[n]);
+    if (event_n > 0)
+    {
+        const int trail_size = g.InputEventsTrail.Size;
+        g.InputEventsTrail.resize(trail_size + event_n);
+        memcpy(g.InputEventsTrail.Data + trail_size, g.InputEventsQueue.Data, (size_t)event_n * sizeof(ImGuiInputEvent));
+    }
 
     // Remaining events will be processed on the next frame
     if (event_n == g.InputEventsQueue.Size)
@@ -10969,6 +12237,19 @@ static void inline NavClampRectToVisibleAreaForMoveDir(ImGuiDir move_dir, ImRect
     }
 }
 
+// Compute distance between boxes, shared by NavScoreItem() and NavMoveIndexCalcBound()
+// FIXME-NAV: Introducing biases for vertical navigation, needs to be removed.
+static float inline NavScoreItemDistBox(const ImRect& cand, const ImRect& curr, float* out_dbx, float* out_dby)
+{
+    float dbx = NavScoreItemDistInterval(cand.Min.x, cand.Max.x, curr.Min.x, curr.Max.x);
+    float dby = NavScoreItemDistInterval(ImLerp(cand.Min.y, cand.Max.y, 0.2f), ImLerp(cand.Min.y, cand.Max.y, 0.8f), ImLerp(curr.Min.y, curr.Max.y, 0.2f), ImLerp(curr.Min.y, curr.Max.y, 0.8f)); // Scale down on Y to keep using box-distance for vertically touching items
+    if (dby != 0.0f && dbx != 0.0f)
+        dbx = (dbx / 1000.0f) + ((dbx > 0.0f) ? +1.0f : -1.0f);
+    *out_dbx = dbx;
+    *out_dby = dby;
+    return ImFabs(dbx) + ImFabs(dby);
+}
+
 // Scoring function for gamepad/keyboard directional navigation. Based on https://gist.github.com/rygorous/6981057
 static bool ImGui::NavScoreItem(ImGuiNavItemData* result)
 {
@@ -10996,12 +12277,8 @@ static bool ImGui::NavScoreItem(ImGuiNavItemData* result)
     NavClampRectToVisibleAreaForMoveDir(g.NavMoveClipDir, cand, window->ClipRect);
 
     // Compute distance between boxes
-    // FIXME-NAV: Introducing biases for vertical navigation, needs to be removed.
-    float dbx = NavScoreItemDistInterval(cand.Min.x, cand.Max.x, curr.Min.x, curr.Max.x);
-    float dby = NavScoreItemDistInterval(ImLerp(cand.Min.y, cand.Max.y, 0.2f), ImLerp(cand.Min.y, cand.Max.y, 0.8f), ImLerp(curr.Min.y, curr.Max.y, 0.2f), ImLerp(curr.Min.y, curr.Max.y, 0.8f)); // Scale down on Y to keep using box-distance for vertically touching items
-    if (dby != 0.0f && dbx != 0.0f)
-        dbx = (dbx / 1000.0f) + ((dbx > 0.0f) ? +1.0f : -1.0f);
-    float dist_box = ImFabs(dbx) + ImFabs(dby);
+    float dbx, dby;
+    float dist_box = NavScoreItemDistBox(cand, curr, &dbx, &dby);
 
     // Compute distance between centers (this is off by a factor of 2, but we only compare center distances with each other so it doesn't matter)
     float dcx = (cand.Min.x + cand.Max.x) - (curr.Min.x + curr.Max.x);
@@ -11155,10 +12432,29 @@ static void ImGui::NavProcessItem()
         else if ((g.NavId != id || (g.NavMoveFlags & ImGuiNavMoveFlags_AllowCurrentNavId)) && !(item_flags & (ImGuiItemFlags_Disabled | ImGuiItemFlags_NoNav)))
         {
             ImGuiNavItemData* result = (window == g.NavWindow) ? &g.NavMoveResultLocal : &g.NavMoveResultOther;
-            if (!is_tabbing)
+            bool may_score = true;
+            if (g.NavMoveIndexEnabled && window == g.NavWindow && window->DC.NavLayerCurrent == ImGuiNavLayer_Main)
+            {
+                // Record item for next move request, and skip scoring when the item can't beat the best candidate (see NavMoveIndexUpdatePruneRect())
+                if (g.NavMoveIndexBoundPending)
+                    NavMoveIndexCalcBound();
+                ImGuiNavIndexItem index_item = { id, WindowRectAbsToRel(window, nav_bb) };
+                g.NavMoveIndexItemsNext.push_back(index_item);
+                ImRect cand = nav_bb;
+                NavClampRectToVisibleAreaForMoveDir(g.NavMoveClipDir, cand, window->ClipRect);
+                may_score = cand.Overlaps(g.NavMovePruneRect);
+            }
+            if (!is_tabbing && may_score)
             {
                 if (NavScoreItem(result))
+                {
                     NavApplyItemToResult(result);
+                    if (g.NavMoveIndexEnabled && result == &g.NavMoveResultLocal)
+                    {
+                        g.NavMoveIndexResultPos = g.NavMoveIndexItemsNext.Size - 1;
+                        NavMoveIndexUpdatePruneRect();
+                    }
+                }
 
                 // Features like PageUp/PageDown need to maintain a separate score for the visible set of items.
                 const float VISIBLE_RATIO = 0.70f;
@@ -11173,6 +12469,11 @@ static void ImGui::NavProcessItem()
     // Update window-relative bounding box of navigated item
     if (g.NavId == id)
     {
+        if (g.NavMoveScoringItems && g.NavMoveIndexEnabled && window == g.NavWindow && window->DC.NavLayerCurrent == ImGuiNavLayer_Main)
+        {
+            ImGuiNavIndexItem index_item = { id, WindowRectAbsToRel(window, nav_bb) };
+            g.NavMoveIndexItemsNext.push_back(index_item);
+        }
         g.NavWindow = window;                                           // Always refresh g.NavWindow, because some operations such as FocusItem() don't have a window.
         g.NavLayer = window->DC.NavLayerCurrent;
         g.NavFocusScopeId = window->DC.NavFocusScopeIdCurrent;
@@ -11255,6 +12556,7 @@ void ImGui::NavMoveRequestSubmit(ImGuiDir move_dir, ImGuiDir clip_dir, ImGuiNavM
     g.NavMoveResultLocal.Clear();
     g.NavMoveResultLocalVisible.Clear();
     g.NavMoveResultOther.Clear();
+    g.NavMoveIndexEnabled = false;
     NavUpdateAnyRequestFlag();
 }
 
@@ -11467,6 +12769,7 @@ ImVec2 ImGui::GetNavInputAmount2d(ImGuiNavDirSourceFlags dir_sources, ImGuiInput
 
 static void ImGui::NavUpdate()
 {
+    IMGUI_PROFILE_SCOPE("NavUpdate");
     ImGuiContext& g = *GImGui;
     ImGuiIO& io = g.IO;
 
@@ -11535,6 +12838,7 @@ static void ImGui::NavUpdate()
         NavMoveRequestApplyResult();
     g.NavTabbingCounter = 0;
     g.NavMoveSubmitted = g.NavMoveScoringItems = false;
+    g.NavMoveIndexEnabled = false;
 
     // Schedule mouse position update (will be done at the bottom of this function, after 1) processing all move requests and 2) updating scrolling)
     bool set_mouse_pos = false;
@@ -11687,7 +12991,7 @@ void ImGui::NavUpdateCreateMoveRequest()
         // Forwarding previous request (which has been modified, e.g. wrap around menus rewrite the requests with a starting rectangle at the other side of the window)
         // (preserve most state, which were already set by the NavMoveRequestForward() function)
         IM_ASSERT(g.NavMoveDir != ImGuiDir_None && g.NavMoveClipDir != ImGuiDir_None);
-        IM_ASSERT(g.NavMoveFlags & ImGuiNavMoveFlags_Forwarded);
+        IM_ASSERT(g.NavMoveFlags & (ImGuiNavMoveFlags_Forwarded | ImGuiNavMoveFlags_NoPruning));
         IMGUI_DEBUG_LOG_NAV("[nav] NavMoveRequestForward %d\n", g.NavMoveDir);
     }
     else
@@ -11782,6 +13086,118 @@ void ImGui::NavUpdateCreateMoveRequest()
     }
     g.NavScoringRect = scoring_rect;
     g.NavScoringNoClipRect.Add(scoring_rect);
+
+    if (g.NavMoveSubmitted)
+        NavMoveIndexBeginRequest();
+}
+
+// Directional move requests score every item submitted in NavWindow, which is costly for windows with thousands of items.
+// - Items of NavWindow are recorded during a move request, so the next request can look at the items submitted around
+//   NavId (which is generally the result of the previous request) and find a candidate in the direction of movement.
+// - The DistBox of that candidate is a bound: items which can't reach it (see NavMoveIndexUpdatePruneRect()) are not scored.
+//   It is computed when the first item of NavWindow is submitted, so recorded positions match current scrolling.
+// - The bound comes from a previous frame, so it is verified in NavEndFrame(): if no item scored as well as it (layout changed),
+//   the request is redone on the next frame with ImGuiNavMoveFlags_NoPruning, from the same NavRectRel.
+static const int NAV_MOVE_INDEX_SCAN_COUNT = 256; // Number of recorded items to look at on each side of NavId
+static const float NAV_MOVE_INDEX_BOUND_MARGIN = 1.0f; // Added to the bound so small variations (e.g. clipping) don't invalidate it
+
+static void ImGui::NavMoveIndexBeginRequest()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.NavWindow;
+
+    // Items recorded during the last move request become the index
+    if (g.NavMoveIndexItemsNext.Size > 0)
+    {
+        g.NavMoveIndexItems.swap(g.NavMoveIndexItemsNext);
+        g.NavMoveIndexWindow = g.NavMoveIndexWindowNext;
+        g.NavMoveIndexNavIdPos = g.NavMoveIndexResultPos;
+    }
+    g.NavMoveIndexItemsNext.resize(0);
+    g.NavMoveIndexWindowNext = window;
+    g.NavMoveIndexResultPos = -1;
+    g.NavMoveIndexBound = FLT_MAX;
+    g.NavMovePruneRect = ImRect(-FLT_MAX, -FLT_MAX, +FLT_MAX, +FLT_MAX);
+
+    const ImGuiNavMoveFlags incompatible_flags = ImGuiNavMoveFlags_AllowCurrentNavId | ImGuiNavMoveFlags_AlsoScoreVisibleSet | ImGuiNavMoveFlags_Tabbing | ImGuiNavMoveFlags_FocusApi | ImGuiNavMoveFlags_DebugNoResult;
+    g.NavMoveIndexEnabled = !IMGUI_DEBUG_NAV_SCORING && window != NULL && g.NavMoveDir != ImGuiDir_None && g.NavLayer == ImGuiNavLayer_Main && (g.NavMoveFlags & incompatible_flags) == 0;
+    g.NavMoveIndexBoundPending = g.NavMoveIndexEnabled && g.NavId != 0 && g.NavMoveIndexWindow == window && (g.NavMoveFlags & ImGuiNavMoveFlags_NoPruning) == 0;
+    if (g.NavMoveIndexEnabled)
+        g.NavMoveIndexNavRectRel = window->NavRectRel[g.NavLayer];
+}
+
+static void ImGui::NavMoveIndexCalcBound()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.NavWindow;
+    IM_ASSERT(g.NavMoveIndexBoundPending && g.CurrentWindow == window);
+    g.NavMoveIndexBoundPending = false;
+
+    // Locate NavId
+    ImVector<ImGuiNavIndexItem>& items = g.NavMoveIndexItems;
+    int nav_id_pos = g.NavMoveIndexNavIdPos;
+    if (nav_id_pos < 0 || nav_id_pos >= items.Size || items[nav_id_pos].ID != g.NavId)
+        for (nav_id_pos = 0; nav_id_pos < items.Size; nav_id_pos++)
+            if (items[nav_id_pos].ID == g.NavId)
+                break;
+    if (nav_id_pos == items.Size)
+        return;
+
+    // Best candidate around it, using the same distance and quadrant as NavScoreItem()
+    float bound = FLT_MAX;
+    const ImRect curr = g.NavScoringRect;
+    const int pos_min = ImMax(nav_id_pos - NAV_MOVE_INDEX_SCAN_COUNT, 0);
+    const int pos_max = ImMin(nav_id_pos + NAV_MOVE_INDEX_SCAN_COUNT, items.Size - 1);
+    for (int pos = pos_min; pos <= pos_max; pos++)
+    {
+        if (items[pos].ID == g.NavId)
+            continue;
+        ImRect cand = WindowRectRelToAbs(window, items[pos].RectRel);
+        NavClampRectToVisibleAreaForMoveDir(g.NavMoveClipDir, cand, window->ClipRect);
+        float dbx, dby;
+        const float dist_box = NavScoreItemDistBox(cand, curr, &dbx, &dby);
+        const float dcx = (cand.Min.x + cand.Max.x) - (curr.Min.x + curr.Max.x);
+        const float dcy = (cand.Min.y + cand.Max.y) - (curr.Min.y + curr.Max.y);
+        const ImGuiDir quadrant = (dbx != 0.0f || dby != 0.0f) ? ImGetDirQuadrantFromDelta(dbx, dby) : (dcx != 0.0f || dcy != 0.0f) ? ImGetDirQuadrantFromDelta(dcx, dcy) : ImGuiDir_None;
+        if (quadrant == g.NavMoveDir && dist_box < bound)
+            bound = dist_box;
+    }
+    if (bound != FLT_MAX)
+        g.NavMoveIndexBound = bound + NAV_MOVE_INDEX_BOUND_MARGIN;
+    NavMoveIndexUpdatePruneRect();
+}
+
+// Items which can't beat DistBox 'd' are outside of a rectangle built from NavScoreItem() rules:
+// - quadrant == move_dir requires the item center to be past the center of NavScoringRect in that direction.
+// - dist_box >= ImFabs(dby), the distance on Y between 20%-80% bands, which is larger than distance between the item rectangle and the band.
+// - dist_box >= ImFabs(dbx) or 1.0f + ImFabs(dbx) / 1000.0f when dby != 0.0f.
+// We add some slack to keep items which could tie.
+static void ImGui::NavMoveIndexUpdatePruneRect()
+{
+    ImGuiContext& g = *GImGui;
+    const float d = ImMin(g.NavMoveIndexBound, g.NavMoveResultLocal.DistBox);
+    if (d == FLT_MAX)
+    {
+        g.NavMovePruneRect = ImRect(-FLT_MAX, -FLT_MAX, +FLT_MAX, +FLT_MAX);
+        return;
+    }
+    const float slack = 1.0f;
+    const ImRect curr = g.NavScoringRect;
+    const ImVec2 curr_center = curr.GetCenter();
+    const float band_min_y = ImLerp(curr.Min.y, curr.Max.y, 0.2f);
+    const float band_max_y = ImLerp(curr.Min.y, curr.Max.y, 0.8f);
+    const float reach_x = ImMax(d, (d - 1.0f) * 1000.0f) + slack;
+    const float reach_y = d + slack;
+    ImRect r(curr.Min.x - reach_x, band_min_y - reach_y, curr.Max.x + reach_x, band_max_y + reach_y);
+    switch (g.NavMoveDir)
+    {
+    case ImGuiDir_Left:  r.Max.x = curr_center.x + slack; break;
+    case ImGuiDir_Right: r.Min.x = curr_center.x - slack; break;
+    case ImGuiDir_Up:    r.Max.y = curr_center.y + slack; break;
+    case ImGuiDir_Down:  r.Min.y = curr_center.y - slack; break;
+    default: break;
+    }
+    g.NavMovePruneRect = r;
 }
 
 void ImGui::NavUpdateCreateTabbingRequest()
@@ -12032,6 +13448,23 @@ static void ImGui::NavEndFrame()
     if (g.NavWindowingTarget != NULL)
         NavUpdateWindowingOverlay();
 
+    // Pruning bound from NavMoveIndexItems[] wasn't matched by any item: some pruned items may have been better candidates, redo the request without pruning
+    if (g.NavMoveScoringItems && g.NavMoveIndexEnabled && g.NavMoveResultLocal.DistBox > g.NavMoveIndexBound && g.NavWindow == g.NavMoveIndexWindowNext)
+    {
+        const ImGuiDir move_dir = g.NavMoveDir;
+        const ImGuiDir clip_dir = g.NavMoveClipDir;
+        const ImGuiNavMoveFlags move_flags = g.NavMoveFlags & ~(ImGuiNavMoveFlags_WrapX | ImGuiNavMoveFlags_LoopX | ImGuiNavMoveFlags_WrapY | ImGuiNavMoveFlags_LoopY);
+        const ImGuiScrollFlags scroll_flags = g.NavMoveScrollFlags;
+        NavMoveRequestCancel();
+        g.NavWindow->NavRectRel[ImGuiNavLayer_Main] = g.NavMoveIndexNavRectRel;
+        g.NavMoveForwardToNextFrame = true;
+        g.NavMoveDir = move_dir;
+        g.NavMoveClipDir = clip_dir;
+        g.NavMoveFlags = move_flags | ImGuiNavMoveFlags_NoPruning;
+        g.NavMoveScrollFlags = scroll_flags;
+        return;
+    }
+
     // Perform wrap-around in menus
     // FIXME-NAV: Wrap may need to apply a weight bias on the other axis. e.g. 4x4 grid with 2 last items missing on last item won't handle LoopY/WrapY correctly.
     // FIXME-NAV: Wrap (not Loop) support could be handled by the scoring function and then WrapX would function without an extra frame.
@@ -12674,7 +14107,13 @@ void ImGui::EndDragDropTarget()
 // Pass text data straight to log (without being displayed)
 static inline void LogTextV(ImGuiContext& g, const char* fmt, va_list args)
 {
-    if (g.LogFile)
+    if (g.LogFileStream)
+    {
+        g.LogBuffer.Buf.resize(0);
+        g.LogBuffer.appendfv(fmt, args);
+        ImFileStreamWrite(g.LogFileStream, g.LogBuffer.c_str(), (size_t)g.LogBuffer.size());
+    }
+    else if (g.LogFile)
     {
         g.LogBuffer.Buf.resize(0);
         g.LogBuffer.appendfv(fmt, args);
@@ -12774,7 +14213,7 @@ void ImGui::LogBegin(ImGuiLogType type, int auto_open_depth)
     ImGuiContext& g = *GImGui;
     ImGuiWindow* window = g.CurrentWindow;
     IM_ASSERT(g.LogEnabled == false);
-    IM_ASSERT(g.LogFile == NULL);
+    IM_ASSERT(g.LogFile == NULL && g.LogFileStream == NULL);
     IM_ASSERT(g.LogBuffer.empty());
     g.LogEnabled = true;
     g.LogType = type;
@@ -12806,6 +14245,7 @@ void ImGui::LogToTTY(int auto_open_depth)
 }
 
 // Start logging/capturing text output to given file
+// Output is buffered (and written from a background thread with IMGUI_ENABLE_FILE_WRITER_THREAD), the file is complete after LogFinish().
 void ImGui::LogToFile(int auto_open_depth, const char* filename)
 {
     ImGuiContext& g = *GImGui;
@@ -12827,7 +14267,7 @@ void ImGui::LogToFile(int auto_open_depth, const char* filename)
     }
 
     LogBegin(ImGuiLogType_File, auto_open_depth);
-    g.LogFile = f;
+    g.LogFileStream = ImFileStreamCreate(f);
 }
 
 // Start logging/capturing text output to clipboard
@@ -12862,7 +14302,7 @@ void ImGui::LogFinish()
 #endif
         break;
     case ImGuiLogType_File:
-        ImFileClose(g.LogFile);
+        ImFileStreamClose(g.LogFileStream); // Block until all pending output is written
         break;
     case ImGuiLogType_Buffer:
         break;
@@ -12878,6 +14318,7 @@ void ImGui::LogFinish()
     g.LogEnabled = false;
     g.LogType = ImGuiLogType_None;
     g.LogFile = NULL;
+    g.LogFileStream = NULL;
     g.LogBuffer.clear();
 }
 
@@ -12920,14 +14361,27 @@ void ImGui::LogButtons()
 // - FindWindowSettings() [Internal]
 // - FindOrCreateWindowSettings() [Internal]
 // - FindSettingsHandler() [Internal]
+// - WriteIniSettingsEntryFromCache() [Internal]
+// - StoreIniSettingsEntryCache() [Internal]
 // - ClearIniSettings() [Internal]
 // - LoadIniSettingsFromDisk()
 // - LoadIniSettingsFromMemory()
 // - SaveIniSettingsToDisk()
 // - SaveIniSettingsToMemory()
+// - LoadBinarySettingsFromMemory()
+// - SaveBinarySettingsToMemory()
 // - WindowSettingsHandler_***() [Internal]
 //-----------------------------------------------------------------------------
 
+// Binary settings format (see SaveBinarySettingsToMemory())
+static const char IMGUI_SETTINGS_BINARY_MAGIC[4] = { 'I', 'M', 'S', 'B' };
+static const ImU32 IMGUI_SETTINGS_BINARY_VERSION = 1;
+enum ImGuiSettingsBinarySection_
+{
+    ImGuiSettingsBinarySection_Binary,      // Payload written by WriteAllBinaryFn
+    ImGuiSettingsBinarySection_Text         // Payload is .ini text written by WriteAllFn
+};
+
 // Called by NewFrame()
 void ImGui::UpdateSettings()
 {
@@ -12948,7 +14402,14 @@ void ImGui::UpdateSettings()
         if (g.SettingsDirtyTimer <= 0.0f)
         {
             if (g.IO.IniFilename != NULL)
-                SaveIniSettingsToDisk(g.IO.IniFilename);
+            {
+                // Only modified entries are serialized again, and the file is written from a background thread with IMGUI_ENABLE_FILE_WRITER_THREAD.
+                size_t ini_data_size = 0;
+                const void* ini_data = g.IO.IniSavingBinary ? SaveBinarySettingsToMemory(&ini_data_size) : SaveIniSettingsToMemory(&ini_data_size);
+                if (g.SettingsIniWriter == NULL)
+                    g.SettingsIniWriter = ImFileWriterCreate();
+                ImFileWriterSave(g.SettingsIniWriter, g.IO.IniFilename, g.IO.IniSavingBinary ? "wb" : "wt", ini_data, ini_data_size);
+            }
             else
                 g.IO.WantSaveIniSettings = true;  // Let user know they can call SaveIniSettingsToMemory(). user will need to clear io.WantSaveIniSettings themselves.
             g.SettingsDirtyTimer = 0.0f;
@@ -12973,6 +14434,7 @@ void ImGui::MarkIniSettingsDirty(ImGuiWindow* window)
 
 ImGuiWindowSettings* ImGui::CreateNewWindowSettings(const char* name)
 {
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_Settings);
     ImGuiContext& g = *GImGui;
 
 #if !IMGUI_DEBUG_INI_SETTINGS
@@ -13019,49 +14481,54 @@ ImGuiSettingsHandler* ImGui::FindSettingsHandler(const char* type_name)
     return NULL;
 }
 
-void ImGui::ClearIniSettings()
+// Incremental saving: WriteAllFn handlers may call this for each entry, and only serialize the entry when it returns false.
+// - Entry is copied from previously written .ini data, unless it was modified since (*ini_size == 0).
+// - After serializing an entry, call StoreIniSettingsEntryCache() to record its location for the next save.
+bool ImGui::WriteIniSettingsEntryFromCache(ImGuiTextBuffer* buf, int* ini_offset, int* ini_size)
 {
     ImGuiContext& g = *GImGui;
-    g.SettingsIniData.clear();
-    for (int handler_n = 0; handler_n < g.SettingsHandlers.Size; handler_n++)
-        if (g.SettingsHandlers[handler_n].ClearAllFn)
-            g.SettingsHandlers[handler_n].ClearAllFn(&g, &g.SettingsHandlers[handler_n]);
-}
-
-void ImGui::LoadIniSettingsFromDisk(const char* ini_filename)
-{
-    size_t file_data_size = 0;
-    char* file_data = (char*)ImFileLoadToMemory(ini_filename, "rb", &file_data_size);
-    if (!file_data)
-        return;
-    LoadIniSettingsFromMemory(file_data, (size_t)file_data_size);
-    IM_FREE(file_data);
+    if (*ini_size <= 0 || buf != &g.SettingsIniData)
+        return false;
+    IM_ASSERT(*ini_offset >= 0 && *ini_offset + *ini_size <= g.SettingsIniDataPrev.size());
+    const char* src = g.SettingsIniDataPrev.begin() + *ini_offset;
+    *ini_offset = buf->size();
+    buf->append(src, src + *ini_size);
+    return true;
 }
 
-// Zero-tolerance, no error reporting, cheap .ini parsing
-void ImGui::LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size)
+void ImGui::StoreIniSettingsEntryCache(ImGuiTextBuffer* buf, int entry_start, int* ini_offset, int* ini_size)
 {
     ImGuiContext& g = *GImGui;
-    IM_ASSERT(g.Initialized);
-    //IM_ASSERT(!g.WithinFrameScope && "Cannot be called between NewFrame() and EndFrame()");
-    //IM_ASSERT(g.SettingsLoaded == false && g.FrameCount == 0);
-
-    // For user convenience, we allow passing a non zero-terminated string (hence the ini_size parameter).
-    // For our convenience and to make the code simpler, we'll also write zero-terminators within the buffer. So let's create a writable copy..
-    if (ini_size == 0)
-        ini_size = strlen(ini_data);
-    g.SettingsIniData.Buf.resize((int)ini_size + 1);
-    char* const buf = g.SettingsIniData.Buf.Data;
-    char* const buf_end = buf + ini_size;
-    memcpy(buf, ini_data, ini_size);
-    buf_end[0] = 0;
+    *ini_offset = entry_start;
+    *ini_size = (buf == &g.SettingsIniData) ? buf->size() - entry_start : 0;
+}
 
-    // Call pre-read handlers
-    // Some types will clear their data (e.g. dock information) some types will allow merge/override (window)
+void ImGui::ClearIniSettings()
+{
+    ImGuiContext& g = *GImGui;
+    g.SettingsIniData.clear();
+    g.SettingsIniDataPrev.clear();
+    g.SettingsBinaryData.clear();
     for (int handler_n = 0; handler_n < g.SettingsHandlers.Size; handler_n++)
-        if (g.SettingsHandlers[handler_n].ReadInitFn)
-            g.SettingsHandlers[handler_n].ReadInitFn(&g, &g.SettingsHandlers[handler_n]);
+        if (g.SettingsHandlers[handler_n].ClearAllFn)
+            g.SettingsHandlers[handler_n].ClearAllFn(&g, &g.SettingsHandlers[handler_n]);
+}
+
+void ImGui::LoadIniSettingsFromDisk(const char* ini_filename)
+{
+    size_t file_data_size = 0;
+    char* file_data = (char*)ImFileLoadToMemory(ini_filename, "rb", &file_data_size);
+    if (!file_data)
+        return;
+    LoadIniSettingsFromMemory(file_data, (size_t)file_data_size);
+    IM_FREE(file_data);
+}
 
+// Parse .ini lines and dispatch them to handlers. Called between pre-read (ReadInitFn) and post-read (ApplyAllFn) handlers.
+// Writes zero-terminators within the buffer.
+static void LoadIniSettingsParseLines(char* buf, char* buf_end)
+{
+    ImGuiContext& g = *GImGui;
     void* entry_data = NULL;
     ImGuiSettingsHandler* entry_handler = NULL;
 
@@ -13089,7 +14556,7 @@ void ImGui::LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size)
                 continue;
             *type_end = 0; // Overwrite first ']'
             name_start++;  // Skip second '['
-            entry_handler = FindSettingsHandler(type_start);
+            entry_handler = ImGui::FindSettingsHandler(type_start);
             entry_data = entry_handler ? entry_handler->ReadOpenFn(&g, entry_handler, name_start) : NULL;
         }
         else if (entry_handler != NULL && entry_data != NULL)
@@ -13098,6 +14565,41 @@ void ImGui::LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size)
             entry_handler->ReadLineFn(&g, entry_handler, entry_data, line);
         }
     }
+}
+
+// Zero-tolerance, no error reporting, cheap .ini parsing
+void ImGui::LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size)
+{
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_Settings);
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(g.Initialized);
+    //IM_ASSERT(!g.WithinFrameScope && "Cannot be called between NewFrame() and EndFrame()");
+    //IM_ASSERT(g.SettingsLoaded == false && g.FrameCount == 0);
+
+    // Data written by SaveBinarySettingsToMemory() (e.g. loaded from disk while using io.IniSavingBinary)
+    if (ini_size >= IM_ARRAYSIZE(IMGUI_SETTINGS_BINARY_MAGIC) && memcmp(ini_data, IMGUI_SETTINGS_BINARY_MAGIC, IM_ARRAYSIZE(IMGUI_SETTINGS_BINARY_MAGIC)) == 0)
+    {
+        LoadBinarySettingsFromMemory(ini_data, ini_size);
+        return;
+    }
+
+    // For user convenience, we allow passing a non zero-terminated string (hence the ini_size parameter).
+    // For our convenience and to make the code simpler, we'll also write zero-terminators within the buffer. So let's create a writable copy..
+    if (ini_size == 0)
+        ini_size = strlen(ini_data);
+    g.SettingsIniData.Buf.resize((int)ini_size + 1);
+    char* const buf = g.SettingsIniData.Buf.Data;
+    char* const buf_end = buf + ini_size;
+    memcpy(buf, ini_data, ini_size);
+    buf_end[0] = 0;
+
+    // Call pre-read handlers
+    // Some types will clear their data (e.g. dock information) some types will allow merge/override (window)
+    for (int handler_n = 0; handler_n < g.SettingsHandlers.Size; handler_n++)
+        if (g.SettingsHandlers[handler_n].ReadInitFn)
+            g.SettingsHandlers[handler_n].ReadInitFn(&g, &g.SettingsHandlers[handler_n]);
+
+    LoadIniSettingsParseLines(buf, buf_end);
     g.SettingsLoaded = true;
 
     // [DEBUG] Restore untouched copy so it can be browsed in Metrics (not strictly necessary)
@@ -13117,17 +14619,16 @@ void ImGui::SaveIniSettingsToDisk(const char* ini_filename)
         return;
 
     size_t ini_data_size = 0;
-    const char* ini_data = SaveIniSettingsToMemory(&ini_data_size);
-    ImFileHandle f = ImFileOpen(ini_filename, "wt");
-    if (!f)
-        return;
-    ImFileWrite(ini_data, sizeof(char), ini_data_size, f);
-    ImFileClose(f);
+    const void* ini_data = g.IO.IniSavingBinary ? SaveBinarySettingsToMemory(&ini_data_size) : SaveIniSettingsToMemory(&ini_data_size);
+    if (g.SettingsIniWriter)
+        ImFileWriterFlush(g.SettingsIniWriter); // Don't let an older background write land after this one
+    ImFileSaveFromMemoryAtomic(ini_filename, g.IO.IniSavingBinary ? "wb" : "wt", ini_data, ini_data_size);
 }
 
 // Call registered handlers (e.g. SettingsHandlerWindow_WriteAll() + custom handlers) to write their stuff into a text buffer
 const char* ImGui::SaveIniSettingsToMemory(size_t* out_size)
 {
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_Settings);
     ImGuiContext& g = *GImGui;
     g.SettingsDirtyTimer = 0.0f;
     g.SettingsIniData.Buf.resize(0);
@@ -13137,11 +14638,114 @@ const char* ImGui::SaveIniSettingsToMemory(size_t* out_size)
         ImGuiSettingsHandler* handler = &g.SettingsHandlers[handler_n];
         handler->WriteAllFn(&g, handler, &g.SettingsIniData);
     }
+
+    // Keep a copy for WriteIniSettingsEntryFromCache() (SettingsIniData itself may be overwritten by LoadIniSettingsFromMemory())
+    g.SettingsIniDataPrev.Buf.resize(g.SettingsIniData.Buf.Size);
+    memcpy(g.SettingsIniDataPrev.Buf.Data, g.SettingsIniData.Buf.Data, (size_t)g.SettingsIniData.Buf.Size);
     if (out_size)
         *out_size = (size_t)g.SettingsIniData.size();
     return g.SettingsIniData.c_str();
 }
 
+// Binary settings data:
+// - Header: IMGUI_SETTINGS_BINARY_MAGIC, ImU32 version.
+// - Followed by one section per handler: ImU32 TypeHash, ImU8 kind (ImGuiSettingsBinarySection_), ImU32 payload size, payload.
+// - Handlers providing ReadAllBinaryFn/WriteAllBinaryFn store their own binary payload, others store their .ini text.
+// Loading is zero-copy for binary sections: handlers read directly from the supplied data.
+void ImGui::LoadBinarySettingsFromMemory(const void* data, size_t data_size)
+{
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_Settings);
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(g.Initialized);
+
+    // Silently ignore data written by another version (we don't convert, the .ini text format is the interchange format)
+    ImGuiSettingsBinaryReader reader((const char*)data, (const char*)data + data_size);
+    char magic[IM_ARRAYSIZE(IMGUI_SETTINGS_BINARY_MAGIC)];
+    reader.ReadBytes(magic, sizeof(magic));
+    const ImU32 version = reader.ReadU32();
+    if (reader.Error || memcmp(magic, IMGUI_SETTINGS_BINARY_MAGIC, sizeof(magic)) != 0 || version != IMGUI_SETTINGS_BINARY_VERSION)
+        return;
+
+    // Call pre-read handlers
+    for (int handler_n = 0; handler_n < g.SettingsHandlers.Size; handler_n++)
+        if (g.SettingsHandlers[handler_n].ReadInitFn)
+            g.SettingsHandlers[handler_n].ReadInitFn(&g, &g.SettingsHandlers[handler_n]);
+
+    while (reader.HasData())
+    {
+        const ImGuiID type_hash = reader.ReadU32();
+        const ImU8 kind = reader.ReadU8();
+        const ImU32 size = reader.ReadU32();
+        if (reader.Error || (size_t)(reader.DataEnd - reader.Data) < size)
+            break;
+        ImGuiSettingsBinaryReader section_reader(reader.Data, reader.Data + size);
+        reader.Data += size;
+
+        ImGuiSettingsHandler* handler = NULL;
+        for (int handler_n = 0; handler_n < g.SettingsHandlers.Size && handler == NULL; handler_n++)
+            if (g.SettingsHandlers[handler_n].TypeHash == type_hash)
+                handler = &g.SettingsHandlers[handler_n];
+        if (handler == NULL)
+            continue;
+        if (kind == ImGuiSettingsBinarySection_Binary && handler->ReadAllBinaryFn != NULL)
+        {
+            handler->ReadAllBinaryFn(&g, handler, &section_reader);
+        }
+        else if (kind == ImGuiSettingsBinarySection_Text)
+        {
+            // Text parser needs a writable copy
+            g.SettingsIniData.Buf.resize((int)size + 1);
+            memcpy(g.SettingsIniData.Buf.Data, section_reader.Data, size);
+            g.SettingsIniData.Buf.Data[size] = 0;
+            LoadIniSettingsParseLines(g.SettingsIniData.Buf.Data, g.SettingsIniData.Buf.Data + size);
+        }
+    }
+    g.SettingsIniData.clear();
+    g.SettingsLoaded = true;
+
+    // Call post-read handlers
+    for (int handler_n = 0; handler_n < g.SettingsHandlers.Size; handler_n++)
+        if (g.SettingsHandlers[handler_n].ApplyAllFn)
+            g.SettingsHandlers[handler_n].ApplyAllFn(&g, &g.SettingsHandlers[handler_n]);
+}
+
+const void* ImGui::SaveBinarySettingsToMemory(size_t* out_data_size)
+{
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_Settings);
+    ImGuiContext& g = *GImGui;
+    g.SettingsDirtyTimer = 0.0f;
+    g.SettingsBinaryData.resize(0);
+    ImGuiSettingsBinaryWriter writer(&g.SettingsBinaryData);
+    writer.WriteBytes(IMGUI_SETTINGS_BINARY_MAGIC, IM_ARRAYSIZE(IMGUI_SETTINGS_BINARY_MAGIC));
+    writer.WriteU32(IMGUI_SETTINGS_BINARY_VERSION);
+
+    ImGuiTextBuffer text_buf;
+    for (int handler_n = 0; handler_n < g.SettingsHandlers.Size; handler_n++)
+    {
+        ImGuiSettingsHandler* handler = &g.SettingsHandlers[handler_n];
+        writer.WriteU32(handler->TypeHash);
+        writer.WriteU8((ImU8)(handler->WriteAllBinaryFn ? ImGuiSettingsBinarySection_Binary : ImGuiSettingsBinarySection_Text));
+        const int size_offset = g.SettingsBinaryData.Size;
+        writer.WriteU32(0); // Patched below
+        const int payload_offset = g.SettingsBinaryData.Size;
+        if (handler->WriteAllBinaryFn)
+        {
+            handler->WriteAllBinaryFn(&g, handler, &writer);
+        }
+        else
+        {
+            text_buf.Buf.resize(0);
+            handler->WriteAllFn(&g, handler, &text_buf);
+            writer.WriteBytes(text_buf.begin(), (size_t)text_buf.size());
+        }
+        const ImU32 payload_size = (ImU32)(g.SettingsBinaryData.Size - payload_offset);
+        memcpy(g.SettingsBinaryData.Data + size_offset, &payload_size, sizeof(payload_size));
+    }
+    if (out_data_size)
+        *out_data_size = (size_t)g.SettingsBinaryData.Size;
+    return g.SettingsBinaryData.Data;
+}
+
 static void WindowSettingsHandler_ClearAll(ImGuiContext* ctx, ImGuiSettingsHandler*)
 {
     ImGuiContext& g = *ctx;
@@ -13189,10 +14793,10 @@ static void WindowSettingsHandler_ApplyAll(ImGuiContext* ctx, ImGuiSettingsHandl
         }
 }
 
-static void WindowSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* buf)
+// Gather data from windows that were active during this session
+// (if a window wasn't opened in this session we preserve its settings)
+static void WindowSettingsHandler_UpdateFromWindows(ImGuiContext* ctx)
 {
-    // Gather data from windows that were active during this session
-    // (if a window wasn't opened in this session we preserve its settings)
     ImGuiContext& g = *ctx;
     for (int i = 0; i != g.Windows.Size; i++)
     {
@@ -13207,6 +14811,8 @@ static void WindowSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandl
             window->SettingsOffset = g.SettingsWindows.offset_from_ptr(settings);
         }
         IM_ASSERT(settings->ID == window->ID);
+        char settings_backup[sizeof(ImGuiWindowSettings)];
+        memcpy(settings_backup, settings, sizeof(ImGuiWindowSettings));
         settings->Pos = ImVec2ih(window->Pos - window->ViewportPos);
         settings->Size = ImVec2ih(window->SizeFull);
         settings->ViewportId = window->ViewportId;
@@ -13216,12 +14822,23 @@ static void WindowSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandl
         settings->ClassId = window->WindowClass.ClassId;
         settings->DockOrder = window->DockOrder;
         settings->Collapsed = window->Collapsed;
+        if (memcmp(settings_backup, settings, sizeof(ImGuiWindowSettings)) != 0)
+            settings->IniSize = 0; // Serialize again
     }
+}
+
+static void WindowSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* buf)
+{
+    ImGuiContext& g = *ctx;
+    WindowSettingsHandler_UpdateFromWindows(ctx);
 
     // Write to text buffer
     buf->reserve(buf->size() + g.SettingsWindows.size() * 6); // ballpark reserve
     for (ImGuiWindowSettings* settings = g.SettingsWindows.begin(); settings != NULL; settings = g.SettingsWindows.next_chunk(settings))
     {
+        if (ImGui::WriteIniSettingsEntryFromCache(buf, &settings->IniOffset, &settings->IniSize))
+            continue;
+        const int entry_start = buf->size();
         const char* settings_name = settings->GetName();
         buf->appendf("[%s][%s]\n", handler->TypeName, settings_name);
         if (settings->ViewportId != 0 && settings->ViewportId != ImGui::IMGUI_VIEWPORT_DEFAULT_ID)
@@ -13245,6 +14862,54 @@ static void WindowSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandl
                 buf->appendf("ClassId=0x%08X\n", settings->ClassId);
         }
         buf->append("\n");
+        ImGui::StoreIniSettingsEntryCache(buf, entry_start, &settings->IniOffset, &settings->IniSize);
+    }
+}
+
+static void WindowSettingsHandler_ReadAllBinary(ImGuiContext* ctx, ImGuiSettingsHandler*, ImGuiSettingsBinaryReader* reader)
+{
+    // Skip lookups when loading into empty settings (typically at startup)
+    ImGuiContext& g = *ctx;
+    const bool find_existing = !g.SettingsWindows.empty();
+    while (reader->HasData())
+    {
+        const char* name = reader->ReadString();
+        ImGuiWindowSettings data;
+        data.Pos = reader->ReadVec2ih();
+        data.Size = reader->ReadVec2ih();
+        data.ViewportPos = reader->ReadVec2ih();
+        data.ViewportId = reader->ReadU32();
+        data.DockId = reader->ReadU32();
+        data.ClassId = reader->ReadU32();
+        data.DockOrder = reader->ReadS16();
+        data.Collapsed = reader->ReadU8() != 0;
+        if (reader->Error)
+            break;
+
+        ImGuiWindowSettings* settings = find_existing ? ImGui::FindWindowSettings(ImHashStr(name)) : NULL;
+        if (settings == NULL)
+            settings = ImGui::CreateNewWindowSettings(name);
+        data.ID = settings->ID;
+        data.WantApply = true;
+        *settings = data;
+    }
+}
+
+static void WindowSettingsHandler_WriteAllBinary(ImGuiContext* ctx, ImGuiSettingsHandler*, ImGuiSettingsBinaryWriter* writer)
+{
+    ImGuiContext& g = *ctx;
+    WindowSettingsHandler_UpdateFromWindows(ctx);
+    for (ImGuiWindowSettings* settings = g.SettingsWindows.begin(); settings != NULL; settings = g.SettingsWindows.next_chunk(settings))
+    {
+        writer->WriteString(settings->GetName());
+        writer->WriteVec2ih(settings->Pos);
+        writer->WriteVec2ih(settings->Size);
+        writer->WriteVec2ih(settings->ViewportPos);
+        writer->WriteU32(settings->ViewportId);
+        writer->WriteU32(settings->DockId);
+        writer->WriteU32(settings->ClassId);
+        writer->WriteS16(settings->DockOrder);
+        writer->WriteU8(settings->Collapsed ? 1 : 0);
     }
 }
 
@@ -13446,6 +15111,8 @@ ImGuiViewportP* ImGui::FindHoveredViewportFromPlatformWindowStack(const ImVec2&
 // Note that this is running even if 'ImGuiConfigFlags_ViewportsEnable' is not set, in order to clear unused viewports (if any) and update monitor info.
 static void ImGui::UpdateViewportsNewFrame()
 {
+    IMGUI_PROFILE_SCOPE("UpdateViewportsNewFrame");
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_Viewports);
     ImGuiContext& g = *GImGui;
     IM_ASSERT(g.PlatformIO.Viewports.Size <= g.Viewports.Size);
 
@@ -13642,6 +15309,7 @@ static void ImGui::UpdateViewportsEndFrame()
 // FIXME: We should ideally refactor the system to call this every frame (we currently don't)
 ImGuiViewportP* ImGui::AddUpdateViewport(ImGuiWindow* window, ImGuiID id, const ImVec2& pos, const ImVec2& size, ImGuiViewportFlags flags)
 {
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_Viewports);
     ImGuiContext& g = *GImGui;
     IM_ASSERT(id != 0);
 
@@ -13953,6 +15621,7 @@ void ImGui::WindowSyncOwnedViewport(ImGuiWindow* window, ImGuiWindow* parent_win
 // This will handle the creation/update of all OS windows via function defined in the ImGuiPlatformIO api.
 void ImGui::UpdatePlatformWindows()
 {
+    IMGUI_PROFILE_SCOPE("UpdatePlatformWindows");
     ImGuiContext& g = *GImGui;
     IM_ASSERT(g.FrameCountEnded == g.FrameCount && "Forgot to call Render() or EndFrame() before UpdatePlatformWindows()?");
     IM_ASSERT(g.FrameCountPlatformEnded < g.FrameCount);
@@ -14407,6 +16076,8 @@ namespace ImGui
     static void*            DockSettingsHandler_ReadOpen(ImGuiContext*, ImGuiSettingsHandler*, const char* name);
     static void             DockSettingsHandler_ReadLine(ImGuiContext*, ImGuiSettingsHandler*, void* entry, const char* line);
     static void             DockSettingsHandler_WriteAll(ImGuiContext* imgui_ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* buf);
+    static void             DockSettingsHandler_ReadAllBinary(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiSettingsBinaryReader* reader);
+    static void             DockSettingsHandler_WriteAllBinary(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiSettingsBinaryWriter* writer);
 }
 
 //-----------------------------------------------------------------------------
@@ -14451,6 +16122,8 @@ void ImGui::DockContextInitialize(ImGuiContext* ctx)
     ini_handler.ReadLineFn = DockSettingsHandler_ReadLine;
     ini_handler.ApplyAllFn = DockSettingsHandler_ApplyAll;
     ini_handler.WriteAllFn = DockSettingsHandler_WriteAll;
+    ini_handler.ReadAllBinaryFn = DockSettingsHandler_ReadAllBinary;
+    ini_handler.WriteAllBinaryFn = DockSettingsHandler_WriteAllBinary;
     g.SettingsHandlers.push_back(ini_handler);
 }
 
@@ -14486,6 +16159,8 @@ void ImGui::DockContextRebuildNodes(ImGuiContext* ctx)
 // Docking context update function, called by NewFrame()
 void ImGui::DockContextNewFrameUpdateUndocking(ImGuiContext* ctx)
 {
+    IMGUI_PROFILE_SCOPE("DockContextNewFrameUpdateUndocking");
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_Docking);
     ImGuiContext& g = *ctx;
     ImGuiDockContext* dc  = &ctx->DockContext;
     if (!(g.IO.ConfigFlags & ImGuiConfigFlags_DockingEnable))
@@ -14530,6 +16205,8 @@ void ImGui::DockContextNewFrameUpdateUndocking(ImGuiContext* ctx)
 // Docking context update function, called by NewFrame()
 void ImGui::DockContextNewFrameUpdateDocking(ImGuiContext* ctx)
 {
+    IMGUI_PROFILE_SCOPE("DockContextNewFrameUpdateDocking");
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_Docking);
     ImGuiContext& g = *ctx;
     ImGuiDockContext* dc  = &ctx->DockContext;
     if (!(g.IO.ConfigFlags & ImGuiConfigFlags_DockingEnable))
@@ -14721,6 +16398,7 @@ static void ImGui::DockContextPruneUnusedSettingsNodes(ImGuiContext* ctx)
 
 static void ImGui::DockContextBuildNodesFromSettings(ImGuiContext* ctx, ImGuiDockNodeSettings* node_settings_array, int node_settings_count)
 {
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_Docking);
     // Build nodes
     for (int node_n = 0; node_n < node_settings_count; node_n++)
     {
@@ -15017,6 +16695,7 @@ void ImGui::DockContextProcessUndockNode(ImGuiContext* ctx, ImGuiDockNode* node)
             window->Flags &= ~ImGuiWindowFlags_ChildWindow;
             if (window->ParentWindow)
                 window->ParentWindow->DC.ChildWindows.find_erase(window);
+            ctx->WindowsDisplayOrderDirty = true;
             UpdateWindowParentAndRootLinks(window, window->Flags, NULL);
         }
         node = new_node;
@@ -15206,6 +16885,7 @@ static void ImGui::DockNodeRemoveWindow(ImGuiDockNode* node, ImGuiWindow* window
     window->Flags &= ~ImGuiWindowFlags_ChildWindow;
     if (window->ParentWindow)
         window->ParentWindow->DC.ChildWindows.find_erase(window);
+    g.WindowsDisplayOrderDirty = true;
     UpdateWindowParentAndRootLinks(window, window->Flags, NULL); // Update immediately
 
     // Remove window
@@ -15545,6 +17225,8 @@ static void DockNodeSetupHostWindow(ImGuiDockNode* node, ImGuiWindow* host_windo
 
 static void ImGui::DockNodeUpdate(ImGuiDockNode* node)
 {
+    IMGUI_PROFILE_SCOPE("DockNodeUpdate");
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_Docking);
     ImGuiContext& g = *GImGui;
     IM_ASSERT(node->LastFrameActive != g.FrameCount);
     node->LastFrameAlive = g.FrameCount;
@@ -17157,6 +18839,7 @@ void ImGui::DockBuilderDockWindow(const char* window_name, ImGuiID node_id)
             settings = CreateNewWindowSettings(window_name);
         settings->DockId = node_id;
         settings->DockOrder = -1;
+        settings->IniSize = 0;
     }
 }
 
@@ -17283,6 +18966,7 @@ void ImGui::DockBuilderRemoveNodeChildNodes(ImGuiID root_id)
                 if (nodes_to_remove[n]->ID == window_settings_dock_id)
                 {
                     settings->DockId = root_id;
+                    settings->IniSize = 0;
                     break;
                 }
 
@@ -17319,7 +19003,10 @@ void ImGui::DockBuilderRemoveNodeDockedWindows(ImGuiID root_id, bool clear_setti
                     if (DockNodeGetRootNode(node)->ID == root_id)
                         want_removal = true;
             if (want_removal)
+            {
                 settings->DockId = 0;
+                settings->IniSize = 0;
+            }
         }
     }
 
@@ -17448,6 +19135,7 @@ void ImGui::DockBuilderCopyWindowSettings(const char* src_name, const char* dst_
         }
         dst_settings->Size = ImVec2ih(src_window->SizeFull);
         dst_settings->Collapsed = src_window->Collapsed;
+        dst_settings->IniSize = 0;
     }
 }
 
@@ -17598,6 +19286,7 @@ static ImGuiDockNode* ImGui::DockContextBindNodeToWindow(ImGuiContext* ctx, ImGu
 
 void ImGui::BeginDocked(ImGuiWindow* window, bool* p_open)
 {
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_Docking);
     ImGuiContext* ctx = GImGui;
     ImGuiContext& g = *ctx;
 
@@ -17837,7 +19526,10 @@ void ImGui::BeginDockableDragDropTarget(ImGuiWindow* window)
 // - DockSettingsHandler_ReadOpen()
 // - DockSettingsHandler_ReadLine()
 // - DockSettingsHandler_DockNodeToSettings()
+// - DockSettingsHandler_NodesToSettings()
 // - DockSettingsHandler_WriteAll()
+// - DockSettingsHandler_ReadAllBinary()
+// - DockSettingsHandler_WriteAllBinary()
 //-----------------------------------------------------------------------------
 
 static void ImGui::DockSettingsRenameNodeReferences(ImGuiID old_node_id, ImGuiID new_node_id)
@@ -17853,7 +19545,10 @@ static void ImGui::DockSettingsRenameNodeReferences(ImGuiID old_node_id, ImGuiID
     //// FIXME-OPT: We could remove this loop by storing the index in the map
     for (ImGuiWindowSettings* settings = g.SettingsWindows.begin(); settings != NULL; settings = g.SettingsWindows.next_chunk(settings))
         if (settings->DockId == old_node_id)
+        {
             settings->DockId = new_node_id;
+            settings->IniSize = 0;
+        }
 }
 
 // Remove references stored in ImGuiWindowSettings to the given ImGuiDockNodeSettings
@@ -17868,6 +19563,7 @@ static void ImGui::DockSettingsRemoveNodeReferences(ImGuiID* node_ids, int node_
             {
                 settings->DockId = 0;
                 settings->DockOrder = -1;
+                settings->IniSize = 0;
                 if (++found < node_ids_count)
                     break;
                 return;
@@ -17972,21 +19668,25 @@ static void DockSettingsHandler_DockNodeToSettings(ImGuiDockContext* dc, ImGuiDo
         DockSettingsHandler_DockNodeToSettings(dc, node->ChildNodes[1], depth + 1);
 }
 
-static void ImGui::DockSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* buf)
+// Gather settings data
+// (unlike our windows settings, because nodes are always built we can do a full rewrite of the SettingsNode buffer)
+static void DockSettingsHandler_NodesToSettings(ImGuiDockContext* dc)
 {
-    ImGuiContext& g = *ctx;
-    ImGuiDockContext* dc = &ctx->DockContext;
-    if (!(g.IO.ConfigFlags & ImGuiConfigFlags_DockingEnable))
-        return;
-
-    // Gather settings data
-    // (unlike our windows settings, because nodes are always built we can do a full rewrite of the SettingsNode buffer)
     dc->NodesSettings.resize(0);
     dc->NodesSettings.reserve(dc->Nodes.Data.Size);
     for (int n = 0; n < dc->Nodes.Data.Size; n++)
         if (ImGuiDockNode* node = (ImGuiDockNode*)dc->Nodes.Data[n].val_p)
             if (node->IsRootNode())
                 DockSettingsHandler_DockNodeToSettings(dc, node, 0);
+}
+
+static void ImGui::DockSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* buf)
+{
+    ImGuiContext& g = *ctx;
+    ImGuiDockContext* dc = &ctx->DockContext;
+    if (!(g.IO.ConfigFlags & ImGuiConfigFlags_DockingEnable))
+        return;
+    DockSettingsHandler_NodesToSettings(dc);
 
     int max_depth = 0;
     for (int node_n = 0; node_n < dc->NodesSettings.Size; node_n++)
@@ -18050,6 +19750,51 @@ static void ImGui::DockSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettings
     buf->appendf("\n");
 }
 
+static void ImGui::DockSettingsHandler_ReadAllBinary(ImGuiContext* ctx, ImGuiSettingsHandler*, ImGuiSettingsBinaryReader* reader)
+{
+    ImGuiDockContext* dc = &ctx->DockContext;
+    while (reader->HasData())
+    {
+        ImGuiDockNodeSettings node;
+        node.ID = reader->ReadU32();
+        node.ParentNodeId = reader->ReadU32();
+        node.ParentWindowId = reader->ReadU32();
+        node.SelectedTabId = reader->ReadU32();
+        node.SplitAxis = (signed char)reader->ReadU8();
+        node.Depth = (char)reader->ReadU8();
+        node.Flags = (ImGuiDockNodeFlags)reader->ReadU32() & ImGuiDockNodeFlags_SavedFlagsMask_;
+        node.Pos = reader->ReadVec2ih();
+        node.Size = reader->ReadVec2ih();
+        node.SizeRef = reader->ReadVec2ih();
+        if (reader->Error || node.ID == 0)
+            break;
+        dc->NodesSettings.push_back(node);
+    }
+}
+
+static void ImGui::DockSettingsHandler_WriteAllBinary(ImGuiContext* ctx, ImGuiSettingsHandler*, ImGuiSettingsBinaryWriter* writer)
+{
+    ImGuiContext& g = *ctx;
+    ImGuiDockContext* dc = &ctx->DockContext;
+    if (!(g.IO.ConfigFlags & ImGuiConfigFlags_DockingEnable))
+        return;
+    DockSettingsHandler_NodesToSettings(dc);
+    for (int node_n = 0; node_n < dc->NodesSettings.Size; node_n++)
+    {
+        const ImGuiDockNodeSettings* node_settings = &dc->NodesSettings[node_n];
+        writer->WriteU32(node_settings->ID);
+        writer->WriteU32(node_settings->ParentNodeId);
+        writer->WriteU32(node_settings->ParentWindowId);
+        writer->WriteU32(node_settings->SelectedTabId);
+        writer->WriteU8((ImU8)node_settings->SplitAxis);
+        writer->WriteU8((ImU8)node_settings->Depth);
+        writer->WriteU32((ImU32)node_settings->Flags);
+        writer->WriteVec2ih(node_settings->Pos);
+        writer->WriteVec2ih(node_settings->Size);
+        writer->WriteVec2ih(node_settings->SizeRef);
+    }
+}
+
 
 //-----------------------------------------------------------------------------
 // [SECTION] PLATFORM DEPENDENT HELPERS
@@ -18224,6 +19969,197 @@ static void SetPlatformImeDataFn_DefaultImpl(ImGuiViewport*, ImGuiPlatformImeDat
 
 #endif
 
+//-----------------------------------------------------------------------------
+// [SECTION] PROFILER
+//-----------------------------------------------------------------------------
+// - ProfilerGetTimeNs() [Internal]
+// - ProfilerBeginZone()
+// - ProfilerEndZone()
+// - ProfilerUpdateStats() [Internal]
+// - ProfilerExportChromeTrace()
+//-----------------------------------------------------------------------------
+
+#ifdef IMGUI_ENABLE_PROFILER
+
+// No function-level static here: contexts may be used concurrently from different threads (IMGUI_ENABLE_THREAD_LOCAL_CONTEXT).
+static ImU64 ProfilerGetTimeNs(ImGuiProfiler* profiler)
+{
+#if defined(_WIN32) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS)
+    if (profiler->TicksPerSecond == 0)
+    {
+        LARGE_INTEGER frequency;
+        ::QueryPerformanceFrequency(&frequency);
+        profiler->TicksPerSecond = (ImU64)frequency.QuadPart;
+    }
+    LARGE_INTEGER counter;
+    ::QueryPerformanceCounter(&counter);
+    return (ImU64)((double)counter.QuadPart * 1000000000.0 / (double)profiler->TicksPerSecond);
+#elif defined(CLOCK_MONOTONIC)
+    IM_UNUSED(profiler);
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ImU64)ts.tv_sec * 1000000000 + (ImU64)ts.tv_nsec;
+#else
+    IM_UNUSED(profiler);
+    return (ImU64)clock() * (1000000000 / CLOCKS_PER_SEC);
+#endif
+}
+
+ImU64 ImGui::ProfilerBeginZone(const char* name, ImGuiID window_id)
+{
+    ImGuiContext* ctx = GImGui;
+    if (ctx == NULL || ctx->Profiler.Paused)
+        return 0;
+    ImGuiProfiler* profiler = &ctx->Profiler;
+    if (profiler->Zones.Size == 0)
+    {
+        IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_Misc);
+        profiler->Zones.resize(IMGUI_PROFILER_MAX_ZONES);
+    }
+    ImGuiProfilerZone* zone = &profiler->Zones[(int)(profiler->ZonesCount % IMGUI_PROFILER_MAX_ZONES)];
+    zone->Name = name;
+    zone->WindowID = window_id;
+    zone->FrameCount = ctx->FrameCount;
+    zone->Depth = profiler->Depth++;
+    zone->EndNs = 0;
+    zone->StartNs = ProfilerGetTimeNs(profiler);
+    return ++profiler->ZonesCount; // Zone N is returned as N+1 so 0 can mean "not recorded"
+}
+
+void ImGui::ProfilerEndZone(ImU64 zone_id)
+{
+    ImGuiContext* ctx = GImGui;
+    if (zone_id == 0 || ctx == NULL)
+        return;
+    ImGuiProfiler* profiler = &ctx->Profiler;
+    const ImU64 end_ns = ProfilerGetTimeNs(profiler);
+    profiler->Depth--;
+    if (profiler->ZonesCount - (zone_id - 1) > IMGUI_PROFILER_MAX_ZONES)
+        return; // Already overwritten
+    profiler->Zones[(int)((zone_id - 1) % IMGUI_PROFILER_MAX_ZONES)].EndNs = end_ns;
+}
+
+static ImGuiID ProfilerGetStatsKey(const char* name, ImGuiID window_id)
+{
+    return ImHashData(&name, sizeof(name), window_id);
+}
+
+// Accumulate zones recorded since last call into per (Name, WindowID) stats. Called at the beginning of NewFrame().
+static void ProfilerUpdateStats(ImGuiProfiler* profiler, int frame_count)
+{
+    for (int n = 0; n < profiler->Stats.Size; n++)
+    {
+        profiler->Stats[n].Calls = 0;
+        profiler->Stats[n].TimeMs = 0.0f;
+    }
+    ImU64 zone_n = ImMax(profiler->ZonesAggregated, (profiler->ZonesCount > IMGUI_PROFILER_MAX_ZONES) ? profiler->ZonesCount - IMGUI_PROFILER_MAX_ZONES : 0);
+    for (; zone_n < profiler->ZonesCount; zone_n++)
+    {
+        const ImGuiProfilerZone* zone = &profiler->Zones[(int)(zone_n % IMGUI_PROFILER_MAX_ZONES)];
+        if (zone->EndNs == 0 && zone->FrameCount >= frame_count)
+            break; // Still open: resume from there next time
+        if (zone->EndNs == 0)
+            continue; // Never closed (e.g. unbalanced ProfilerBeginZone/ProfilerEndZone calls)
+        int* p_idx = profiler->StatsMap.GetIntRef(ProfilerGetStatsKey(zone->Name, zone->WindowID), -1);
+        if (*p_idx == -1)
+        {
+            *p_idx = profiler->Stats.Size;
+            ImGuiProfilerZoneStats new_stats;
+            memset(&new_stats, 0, sizeof(new_stats));
+            new_stats.Name = zone->Name;
+            new_stats.WindowID = zone->WindowID;
+            profiler->Stats.push_back(new_stats);
+        }
+        ImGuiProfilerZoneStats* stats = &profiler->Stats[*p_idx];
+        stats->Depth = zone->Depth;
+        stats->Calls++;
+        stats->TimeMs += (float)((double)(zone->EndNs - zone->StartNs) / 1000000.0);
+        stats->LastFrameActive = frame_count;
+    }
+    profiler->ZonesAggregated = zone_n;
+
+    // Update averages, discard stats of zones which haven't been recorded for a while (e.g. windows which are gone)
+    int stats_count = 0;
+    for (int n = 0; n < profiler->Stats.Size; n++)
+    {
+        ImGuiProfilerZoneStats* stats = &profiler->Stats[n];
+        if (frame_count - stats->LastFrameActive > IMGUI_PROFILER_STATS_PRUNE_FRAMES)
+            continue;
+        stats->TimeMsAvg = stats->TimeMsAvg * 0.95f + stats->TimeMs * 0.05f;
+        stats->TimeMsMax = ImMax(stats->TimeMsMax, stats->TimeMs);
+        profiler->Stats[stats_count++] = *stats;
+    }
+    if (stats_count < profiler->Stats.Size)
+    {
+        profiler->Stats.resize(stats_count);
+        profiler->StatsMap.Clear();
+        for (int n = 0; n < profiler->Stats.Size; n++)
+            profiler->StatsMap.SetInt(ProfilerGetStatsKey(profiler->Stats[n].Name, profiler->Stats[n].WindowID), n);
+    }
+}
+
+static void ProfilerAppendJsonString(ImGuiTextBuffer* buf, const char* s)
+{
+    buf->append("\"");
+    for (; *s; s++)
+    {
+        const unsigned char c = (unsigned char)*s;
+        if (c == '"' || c == '\\')
+            buf->appendf("\\%c", c);
+        else if (c < 0x20)
+            buf->appendf("\\u%04x", c);
+        else
+            buf->append(s, s + 1);
+    }
+    buf->append("\"");
+}
+
+// Write all completed zones still in the ring buffer in Chrome trace event format.
+// Open with chrome://tracing or https://ui.perfetto.dev
+bool ImGui::ProfilerExportChromeTrace(const char* filename)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiProfiler* profiler = &g.Profiler;
+    ImGuiTextBuffer buf;
+    buf.append("{\"traceEvents\":[\n");
+    const ImU64 zone_first = (profiler->ZonesCount > IMGUI_PROFILER_MAX_ZONES) ? profiler->ZonesCount - IMGUI_PROFILER_MAX_ZONES : 0;
+    ImU64 base_ns = 0;
+    bool first = true;
+    for (ImU64 zone_n = zone_first; zone_n < profiler->ZonesCount; zone_n++)
+    {
+        const ImGuiProfilerZone* zone = &profiler->Zones[(int)(zone_n % IMGUI_PROFILER_MAX_ZONES)];
+        if (zone->EndNs == 0)
+            continue;
+        if (first)
+            base_ns = zone->StartNs;
+        buf.append(first ? "{\"name\":" : ",\n{\"name\":");
+        first = false;
+        if (ImGuiWindow* window = zone->WindowID ? FindWindowByID(zone->WindowID) : NULL)
+        {
+            char name_buf[256];
+            ImFormatString(name_buf, IM_ARRAYSIZE(name_buf), "%s '%s'", zone->Name, window->Name);
+            ProfilerAppendJsonString(&buf, name_buf);
+        }
+        else
+        {
+            ProfilerAppendJsonString(&buf, zone->Name);
+        }
+        const ImS64 start_ns = (ImS64)(zone->StartNs - base_ns);
+        buf.appendf(",\"cat\":\"imgui\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":0,\"tid\":0,\"args\":{\"frame\":%d}}",
+            (double)start_ns / 1000.0, (double)(zone->EndNs - zone->StartNs) / 1000.0, zone->FrameCount);
+    }
+    buf.append("\n]}\n");
+
+    ImFileHandle f = ImFileOpen(filename, "wb");
+    if (!f)
+        return false;
+    const bool ret = ImFileWrite(buf.c_str(), sizeof(char), (ImU64)buf.size(), f) == (ImU64)buf.size();
+    ImFileClose(f);
+    return ret;
+}
+
+#endif // #ifdef IMGUI_ENABLE_PROFILER
+
 //-----------------------------------------------------------------------------
 // [SECTION] METRICS/DEBUGGER WINDOW
 //-----------------------------------------------------------------------------
@@ -18343,7 +20279,9 @@ void ImGui::ShowMetricsWindow(bool* p_open)
     Text("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / io.Framerate, io.Framerate);
     Text("%d vertices, %d indices (%d triangles)", io.MetricsRenderVertices, io.MetricsRenderIndices, io.MetricsRenderIndices / 3);
     Text("%d visible windows, %d active allocations", io.MetricsRenderWindows, io.MetricsActiveAllocations);
-    //SameLine(); if (SmallButton("GC")) { g.GcCompactAll = true; }
+    Text("Frame arena: %d bytes used last frame, %d bytes in %d blocks", (int)g.FrameArena.UsedBytesLastFrame, (int)g.FrameArena.GetCapacityInBytes(), g.FrameArena.Blocks.Size);
+    Text("Transient buffers: %d KB (peak %d KB)", (int)(io.MetricsTransientMemory / 1024), (int)(io.MetricsTransientMemoryPeak / 1024));
+    SameLine(); if (SmallButton("GC")) { CompactMemory(); }
 
     Separator();
 
@@ -18545,7 +20483,7 @@ void ImGui::ShowMetricsWindow(bool* p_open)
         BulletText("MouseViewport: 0x%08X (UserHovered 0x%08X, LastHovered 0x%08X)", g.MouseViewport ? g.MouseViewport->ID : 0, g.IO.MouseHoveredViewport, g.MouseLastHoveredViewport ? g.MouseLastHoveredViewport->ID : 0);
         if (TreeNode("Inferred Z order (front-to-back)"))
         {
-            static ImVector<ImGuiViewportP*> viewports;
+            ImVector<ImGuiViewportP*> viewports;
             viewports.resize(g.Viewports.Size);
             memcpy(viewports.Data, g.Viewports.Data, g.Viewports.size_in_bytes());
             if (viewports.Size > 1)
@@ -18607,16 +20545,15 @@ void ImGui::ShowMetricsWindow(bool* p_open)
 #ifdef IMGUI_HAS_DOCK
     if (TreeNode("Docking"))
     {
-        static bool root_nodes_only = true;
         ImGuiDockContext* dc = &g.DockContext;
-        Checkbox("List root nodes", &root_nodes_only);
+        Checkbox("List root nodes", &cfg->ShowDockingRootNodesOnly);
         Checkbox("Ctrl shows window dock info", &cfg->ShowDockingNodes);
         if (SmallButton("Clear nodes")) { DockContextClearNodes(&g, 0, true); }
         SameLine();
         if (SmallButton("Rebuild all")) { dc->WantFullRebuild = true; }
         for (int n = 0; n < dc->Nodes.Data.Size; n++)
             if (ImGuiDockNode* node = (ImGuiDockNode*)dc->Nodes.Data[n].val_p)
-                if (!root_nodes_only || node->IsRootNode())
+                if (!cfg->ShowDockingRootNodesOnly || node->IsRootNode())
                     DebugNodeDockNode(node, "Node");
         TreePop();
     }
@@ -18639,6 +20576,7 @@ void ImGui::ShowMetricsWindow(bool* p_open)
         else
             TextUnformatted("<NULL>");
         Text("SettingsDirtyTimer %.2f", g.SettingsDirtyTimer);
+        Checkbox("io.IniSavingBinary", &g.IO.IniSavingBinary);
         if (TreeNode("SettingsHandlers", "Settings handlers: (%d)", g.SettingsHandlers.Size))
         {
             for (int n = 0; n < g.SettingsHandlers.Size; n++)
@@ -18693,6 +20631,57 @@ void ImGui::ShowMetricsWindow(bool* p_open)
         TreePop();
     }
 
+    // Memory
+    if (TreeNode("Memory"))
+    {
+#ifdef IMGUI_ENABLE_MEMORY_TAGS
+        if (BeginTable("##memtags", 5, ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders | ImGuiTableFlags_SizingFixedFit))
+        {
+            TableSetupColumn("Tag");
+            TableSetupColumn("Live bytes");
+            TableSetupColumn("Peak bytes");
+            TableSetupColumn("Live allocs");
+            TableSetupColumn("Allocs/frame");
+            TableHeadersRow();
+            ImS64 total_live_bytes = 0;
+            int total_live_allocs = 0, total_allocs_per_frame = 0;
+            for (int tag = 0; tag < ImGuiMemTag_COUNT; tag++)
+            {
+                // Read stats now, as our own calls below may allocate
+                const ImGuiMemTagStats stats = g.MemTagStats->Tags[tag];
+                total_live_bytes += stats.LiveBytes;
+                total_live_allocs += stats.LiveAllocs;
+                total_allocs_per_frame += stats.AllocsLastFrame;
+                TableNextColumn(); TextUnformatted(GetMemTagName(tag));
+                TableNextColumn(); Text("%lld", (long long)stats.LiveBytes);
+                TableNextColumn(); Text("%lld", (long long)stats.PeakBytes);
+                TableNextColumn(); Text("%d", stats.LiveAllocs);
+                TableNextColumn(); Text("%d", stats.AllocsLastFrame);
+            }
+            TableNextColumn(); TextUnformatted("Total");
+            TableNextColumn(); Text("%lld", (long long)total_live_bytes);
+            TableNextColumn();
+            TableNextColumn(); Text("%d", total_live_allocs);
+            TableNextColumn(); Text("%d", total_allocs_per_frame);
+            EndTable();
+        }
+#else
+        TextDisabled("Define IMGUI_ENABLE_MEMORY_TAGS in imconfig.h to track allocations by subsystem.");
+#endif
+        TreePop();
+    }
+
+    // Profiler
+#ifdef IMGUI_ENABLE_PROFILER
+    DebugNodeProfiler(&g.Profiler);
+#else
+    if (TreeNode("Profiler"))
+    {
+        TextDisabled("Define IMGUI_ENABLE_PROFILER in imconfig.h to record timings of internal zones.");
+        TreePop();
+    }
+#endif
+
     // Misc Details
     if (TreeNode("Internal state"))
     {
@@ -19200,6 +21189,60 @@ void ImGui::DebugNodeTabBar(ImGuiTabBar* tab_bar, const char* label)
     }
 }
 
+#ifdef IMGUI_ENABLE_PROFILER
+void ImGui::DebugNodeProfiler(ImGuiProfiler* profiler)
+{
+    if (!TreeNode("Profiler", "Profiler (%llu zones recorded)", (unsigned long long)profiler->ZonesCount))
+        return;
+    Checkbox("Pause", &profiler->Paused);
+    SameLine();
+    if (SmallButton("Reset max"))
+        for (int n = 0; n < profiler->Stats.Size; n++)
+            profiler->Stats[n].TimeMsMax = 0.0f;
+    SameLine();
+    if (SmallButton("Export"))
+        ProfilerExportChromeTrace(profiler->ExportFilename);
+    SameLine();
+    SetNextItemWidth(GetFontSize() * 12);
+    InputText("##ExportFilename", profiler->ExportFilename, IM_ARRAYSIZE(profiler->ExportFilename));
+    SameLine();
+    MetricsHelpMarker("Export last zones in Chrome trace format, open with chrome://tracing or https://ui.perfetto.dev\nRelative paths are relative to the current working directory.");
+
+    if (BeginTable("##profiler", 5, ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders | ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_ScrollY, ImVec2(0.0f, GetTextLineHeightWithSpacing() * 20)))
+    {
+        TableSetupScrollFreeze(0, 1);
+        TableSetupColumn("Zone");
+        TableSetupColumn("Calls");
+        TableSetupColumn("ms");
+        TableSetupColumn("ms (avg)");
+        TableSetupColumn("ms (max)");
+        TableHeadersRow();
+        ImGuiListClipper clipper;
+        clipper.Begin(profiler->Stats.Size);
+        while (clipper.Step())
+            for (int n = clipper.DisplayStart; n < clipper.DisplayEnd; n++)
+            {
+                const ImGuiProfilerZoneStats* stats = &profiler->Stats[n];
+                ImGuiWindow* window = stats->WindowID ? FindWindowByID(stats->WindowID) : NULL;
+                TableNextRow();
+                TableNextColumn();
+                Indent(stats->Depth * GetStyle().IndentSpacing * 0.5f + 1.0f);
+                if (window)
+                    Text("%s '%s'", stats->Name, window->Name);
+                else
+                    TextUnformatted(stats->Name);
+                Unindent(stats->Depth * GetStyle().IndentSpacing * 0.5f + 1.0f);
+                TableNextColumn(); Text("%d", stats->Calls);
+                TableNextColumn(); Text("%.3f", stats->TimeMs);
+                TableNextColumn(); Text("%.3f", stats->TimeMsAvg);
+                TableNextColumn(); Text("%.3f", stats->TimeMsMax);
+            }
+        EndTable();
+    }
+    TreePop();
+}
+#endif
+
 void ImGui::DebugNodeViewport(ImGuiViewportP* viewport)
 {
     SetNextItemOpen(true, ImGuiCond_Once);
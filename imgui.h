@@ -153,6 +153,9 @@ struct ImGuiIO;                     // Main configuration and I/O between your a
 struct ImGuiInputTextCallbackData;  // Shared state of InputText() when using custom ImGuiInputTextCallback (rare/advanced use)
 struct ImGuiKeyData;                // Storage for ImGuiIO and IsKeyDown(), IsKeyPressed() etc functions.
 struct ImGuiListClipper;            // Helper to manually clip large list of items
+struct ImGuiListClipperHeights;     // Helper to store heights of items of variable height for ImGuiListClipper
+struct ImGuiTreeView;               // Helper to display huge hierarchies with ImGuiListClipper, by keeping a flattened list of open rows
+struct ImGuiTreeViewRow;            // A row of ImGuiTreeView
 struct ImGuiOnceUponAFrame;         // Helper for running a block of code not more than once a frame
 struct ImGuiPayload;                // User data payload for drag and drop operations
 struct ImGuiPlatformIO;             // Multi-viewport support: interface for Platform/Renderer backends + viewports to render
@@ -163,8 +166,12 @@ struct ImGuiStorage;                // Helper for key->value storage
 struct ImGuiStyle;                  // Runtime data for styling/colors
 struct ImGuiTableSortSpecs;         // Sorting specifications for a table (often handling sort specs for a single column, occasionally more)
 struct ImGuiTableColumnSortSpecs;   // Sorting specification for one column of a table
+struct ImGuiTableSorter;            // Helper to sort a table by building a permutation of item indices from column keys
+struct ImGuiTableSorterColumn;      // Key accessor for one column of ImGuiTableSorter
 struct ImGuiTextBuffer;             // Helper to hold and append into a text buffer (~string builder)
 struct ImGuiTextFilter;             // Helper to parse and apply text filters (e.g. "aaaaa[,bbbbb][,ccccc]")
+struct ImGuiTextRope;               // Helper to hold a large text edited with InputTextMultiline(), with O(log N) edits
+struct ImGuiTextRopeChunk;          // A chunk of ImGuiTextRope
 struct ImGuiViewport;               // A Platform Window (always 1 unless multi-viewport are enabled. One per platform window to output to). In the future may represent Platform Monitor
 struct ImGuiWindowClass;            // Window class (rare/advanced uses: provide hints to the platform backend via altered viewport flags and parent/child info)
 
@@ -300,6 +307,7 @@ namespace ImGui
     IMGUI_API void          EndFrame();                                 // ends the Dear ImGui frame. automatically called by Render(). If you don't need to render data (skipping rendering) you may call EndFrame() without Render()... but you'll have wasted CPU already! If you don't need to render, better to not create any windows and not call NewFrame() at all!
     IMGUI_API void          Render();                                   // ends the Dear ImGui frame, finalize the draw data. You can then get call GetDrawData().
     IMGUI_API ImDrawData*   GetDrawData();                              // valid after Render() and until the next call to NewFrame(). this is what you have to render.
+    IMGUI_API void          CompactMemory();                            // free transient buffers of all windows/tables not used during the last frame, and of the frame allocator. Applied immediately when called outside of NewFrame()/EndFrame(), otherwise on next NewFrame(). Also see io.ConfigMemoryCompactTimer, io.ConfigMemoryCompactBudget.
 
     // Demo, Debug, Information
     IMGUI_API void          ShowDemoWindow(bool* p_open = NULL);        // create Demo window. demonstrate most ImGui features. call this to learn about the library! try to make it always available in your application!
@@ -585,6 +593,7 @@ namespace ImGui
     // - Most of the ImGuiInputTextFlags flags are only useful for InputText() and not for InputFloatX, InputIntX, InputDouble etc.
     IMGUI_API bool          InputText(const char* label, char* buf, size_t buf_size, ImGuiInputTextFlags flags = 0, ImGuiInputTextCallback callback = NULL, void* user_data = NULL);
     IMGUI_API bool          InputTextMultiline(const char* label, char* buf, size_t buf_size, const ImVec2& size = ImVec2(0, 0), ImGuiInputTextFlags flags = 0, ImGuiInputTextCallback callback = NULL, void* user_data = NULL);
+    IMGUI_API bool          InputTextMultiline(const char* label, ImGuiTextRope* rope, const ImVec2& size = ImVec2(0, 0), ImGuiInputTextFlags flags = 0); // edit text stored in a ImGuiTextRope (for large texts). Callbacks are not supported. Returns true when an edit was made, even if the resulting text is identical (e.g. typing over a selection with the same character).
     IMGUI_API bool          InputTextWithHint(const char* label, const char* hint, char* buf, size_t buf_size, ImGuiInputTextFlags flags = 0, ImGuiInputTextCallback callback = NULL, void* user_data = NULL);
     IMGUI_API bool          InputFloat(const char* label, float* v, float step = 0.0f, float step_fast = 0.0f, const char* format = "%.3f", ImGuiInputTextFlags flags = 0);
     IMGUI_API bool          InputFloat2(const char* label, float v[2], const char* format = "%.3f", ImGuiInputTextFlags flags = 0);
@@ -747,12 +756,14 @@ namespace ImGui
     //                          TableNextColumn()      -> Text("Hello 0") -> TableNextColumn()      -> Text("Hello 1")  // OK: TableNextColumn() automatically gets to next row!
     //        TableNextRow()                           -> Text("Hello 0")                                               // Not OK! Missing TableSetColumnIndex() or TableNextColumn()! Text will not appear!
     //        --------------------------------------------------------------------------------------------------------
+    //    - With many columns and horizontal scrolling, you may use TableGetNextVisibleColumn() + TableSetColumnIndex() to only visit visible columns.
     // - 5. Call EndTable()
     IMGUI_API bool          BeginTable(const char* str_id, int column, ImGuiTableFlags flags = 0, const ImVec2& outer_size = ImVec2(0.0f, 0.0f), float inner_width = 0.0f);
     IMGUI_API void          EndTable();                                 // only call EndTable() if BeginTable() returns true!
     IMGUI_API void          TableNextRow(ImGuiTableRowFlags row_flags = 0, float min_row_height = 0.0f); // append into the first cell of a new row.
     IMGUI_API bool          TableNextColumn();                          // append into the next column (or first column of next row if currently in last column). Return true when column is visible.
     IMGUI_API bool          TableSetColumnIndex(int column_n);          // append into the specified column. Return true when column is visible.
+    IMGUI_API int           TableGetNextVisibleColumn(int column_n);    // return index of next visible column after 'column_n' (pass -1 to get the first one), or -1 when there are no more.
 
     // Tables: Headers & Columns declaration
     // - Use TableSetupColumn() to specify label, resizing policy, default width/weight, id, various other flags etc.
@@ -896,6 +907,7 @@ namespace ImGui
     IMGUI_API bool          IsRectVisible(const ImVec2& size);                                  // test if rectangle (of given size, starting from cursor position) is visible / not clipped.
     IMGUI_API bool          IsRectVisible(const ImVec2& rect_min, const ImVec2& rect_max);      // test if rectangle (in screen space) is visible / not clipped. to perform coarse clipping on user's side.
     IMGUI_API double        GetTime();                                                          // get global imgui time. incremented by io.DeltaTime every frame.
+    IMGUI_API void          RequestRedraw(float delay = 0.0f);                                  // request a new frame within 'delay' seconds even without new input (e.g. for your own animations). Lowers io.WantRedrawDelay.
     IMGUI_API int           GetFrameCount();                                                    // get global imgui frame count. incremented by 1 every frame.
     IMGUI_API ImDrawList*   GetBackgroundDrawList();                                            // get background draw list for the viewport associated to the current window. this draw list will be the first rendering one. Useful to quickly draw shapes/text behind dear imgui contents.
     IMGUI_API ImDrawList*   GetForegroundDrawList();                                            // get foreground draw list for the viewport associated to the current window. this draw list will be the last rendered one. Useful to quickly draw shapes/text over dear imgui contents.
@@ -964,6 +976,8 @@ namespace ImGui
     IMGUI_API void          LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size=0); // call after CreateContext() and before the first call to NewFrame() to provide .ini data from your own data source.
     IMGUI_API void          SaveIniSettingsToDisk(const char* ini_filename);                    // this is automatically called (if io.IniFilename is not empty) a few seconds after any modification that should be reflected in the .ini file (and also by DestroyContext).
     IMGUI_API const char*   SaveIniSettingsToMemory(size_t* out_ini_size = NULL);               // return a zero-terminated string with the .ini data which you can save by your own mean. call when io.WantSaveIniSettings is set, then save data by your own mean and clear io.WantSaveIniSettings.
+    IMGUI_API void          LoadBinarySettingsFromMemory(const void* data, size_t data_size);   // load data returned by SaveBinarySettingsToMemory(). data is read in place without being copied, so it may point to a memory-mapped file. LoadIniSettingsFromMemory()/LoadIniSettingsFromDisk() also detect binary data.
+    IMGUI_API const void*   SaveBinarySettingsToMemory(size_t* out_data_size);                  // return settings in a compact binary format, faster to load than .ini text but not meant for interchange (native byte order, may change between versions). See io.IniSavingBinary.
 
     // Debug Utilities
     // - This is used by the IMGUI_CHECKVERSION() macro.
@@ -1605,6 +1619,7 @@ enum ImGuiBackendFlags_
     ImGuiBackendFlags_HasMouseCursors       = 1 << 1,   // Backend Platform supports honoring GetMouseCursor() value to change the OS cursor shape.
     ImGuiBackendFlags_HasSetMousePos        = 1 << 2,   // Backend Platform supports io.WantSetMousePos requests to reposition the OS mouse position (only used if ImGuiConfigFlags_NavEnableSetMousePos is set).
     ImGuiBackendFlags_RendererHasVtxOffset  = 1 << 3,   // Backend Renderer supports ImDrawCmd::VtxOffset. This enables output of large meshes (64K+ vertices) while still using 16-bit indices.
+    ImGuiBackendFlags_RendererHasTexUpdates = 1 << 4,   // Backend Renderer supports partial font atlas texture updates, uploading regions listed in ImFontAtlas::TexDirtyRects[] instead of the whole texture.
 
     // [BETA] Viewports
     ImGuiBackendFlags_PlatformHasViewports  = 1 << 10,  // Backend Platform supports multiple viewports.
@@ -2005,6 +2020,7 @@ struct ImGuiIO
     float       DeltaTime;                      // = 1.0f/60.0f     // Time elapsed since last frame, in seconds.
     float       IniSavingRate;                  // = 5.0f           // Minimum time between saving positions/sizes to .ini file, in seconds.
     const char* IniFilename;                    // = "imgui.ini"    // Path to .ini file (important: default "imgui.ini" is relative to current working dir!). Set NULL to disable automatic .ini loading/saving or if you want to manually call LoadIniSettingsXXX() / SaveIniSettingsXXX() functions.
+    bool        IniSavingBinary;                // = false          // Save io.IniFilename in compact binary format (see SaveBinarySettingsToMemory()) instead of .ini text. Loading detects both formats.
     const char* LogFilename;                    // = "imgui_log.txt"// Path to .log file (default parameter to ImGui::LogToFile when no file is specified).
     float       MouseDoubleClickTime;           // = 0.30f          // Time for a double-click, in seconds.
     float       MouseDoubleClickMaxDist;        // = 6.0f           // Distance threshold to stay in to validate a double-click, in pixels.
@@ -2035,11 +2051,13 @@ struct ImGuiIO
     bool        MouseDrawCursor;                // = false          // Request ImGui to draw a mouse cursor for you (if you are on a platform without a mouse cursor). Cannot be easily renamed to 'io.ConfigXXX' because this is frequently used by backend implementations.
     bool        ConfigMacOSXBehaviors;          // = defined(__APPLE__) // OS X style: Text editing cursor movement using Alt instead of Ctrl, Shortcuts using Cmd/Super instead of Ctrl, Line/Text Start and End using Cmd+Arrows instead of Home/End, Double click selects by word instead of selecting whole text, Multi-selection in lists uses Cmd/Super instead of Ctrl.
     bool        ConfigInputTrickleEventQueue;   // = true           // Enable input queue trickling: some types of events submitted during the same frame (e.g. button down + up) will be spread over multiple frames, improving interactions with low framerates.
+    bool        ConfigInputCoalesceMouseEvents; // = false          // Merge consecutive mouse position events (keeping the last one) and consecutive mouse wheel events (summing them) when they are queued, so high-frequency mice/pens don't make inputs lag behind by several frames. Button events are never merged so transitions stay ordered. Merged events are lost from the input trail.
     bool        ConfigInputTextCursorBlink;     // = true           // Enable blinking cursor (optional as some users consider it to be distracting).
     bool        ConfigDragClickToInputText;     // = false          // [BETA] Enable turning DragXXX widgets into text input with a simple mouse click-release (without moving). Not desirable on devices without a keyboard.
     bool        ConfigWindowsResizeFromEdges;   // = true           // Enable resizing of windows from their edges and from the lower-left corner. This requires (io.BackendFlags & ImGuiBackendFlags_HasMouseCursors) because it needs mouse cursor feedback. (This used to be a per-window ImGuiWindowFlags_ResizeFromAnySide flag)
     bool        ConfigWindowsMoveFromTitleBarOnly; // = false       // Enable allowing to move windows only when clicking on their title bar. Does not apply to windows without a title bar.
     float       ConfigMemoryCompactTimer;       // = 60.0f          // Timer (in seconds) to free transient windows/tables memory buffers when unused. Set to -1.0f to disable.
+    size_t      ConfigMemoryCompactBudget;      // = 0              // Budget (in bytes) for transient windows/tables memory buffers. When exceeded, buffers of the least recently used windows/tables are freed until under budget. Windows/tables used during the last frame are never freed. Set to 0 to disable.
 
     //------------------------------------------------------------------
     // Platform Functions
@@ -2099,6 +2117,7 @@ struct ImGuiIO
     bool        WantTextInput;                      // Mobile/console: when set, you may display an on-screen keyboard. This is set by Dear ImGui when it wants textual keyboard input to happen (e.g. when a InputText widget is active).
     bool        WantSetMousePos;                    // MousePos has been altered, backend should reposition mouse on next frame. Rarely used! Set only when ImGuiConfigFlags_NavEnableSetMousePos flag is enabled.
     bool        WantSaveIniSettings;                // When manual .ini load/save is active (io.IniFilename == NULL), this will be set to notify your application that you can call SaveIniSettingsToMemory() and save yourself. Important: clear io.WantSaveIniSettings yourself after saving!
+    float       WantRedrawDelay;                    // Updated by EndFrame(): seconds until Dear ImGui needs another frame if no new input arrives (0.0f: as soon as possible, FLT_MAX: not until next input). Power-saving applications may block waiting for events with this timeout (e.g. MsgWaitForMultipleObjects(), SDL_WaitEventTimeout(), glfwWaitEventsTimeout()). Also see RequestRedraw().
     bool        NavActive;                          // Keyboard/Gamepad navigation is currently allowed (will handle ImGuiKey_NavXXX events) = a window is focused and it doesn't use the ImGuiWindowFlags_NoNavInputs flag.
     bool        NavVisible;                         // Keyboard/Gamepad navigation is visible and allowed (will handle ImGuiKey_NavXXX events).
     float       Framerate;                          // Rough estimate of application framerate, in frame per second. Solely for convenience. Rolling average estimation based on io.DeltaTime over 120 frames.
@@ -2107,6 +2126,8 @@ struct ImGuiIO
     int         MetricsRenderWindows;               // Number of visible windows
     int         MetricsActiveWindows;               // Number of active windows
     int         MetricsActiveAllocations;           // Number of active allocations, updated by MemAlloc/MemFree based on current context. May be off if you have multiple imgui contexts.
+    size_t      MetricsTransientMemory;             // Bytes held by transient windows/tables memory buffers (draw lists, stacks, etc.) which may be freed by garbage collection. Updated by NewFrame() and CompactMemory().
+    size_t      MetricsTransientMemoryPeak;         // Peak value of MetricsTransientMemory.
     ImVec2      MouseDelta;                         // Mouse delta. Note that this is zero if either current or previous position are invalid (-FLT_MAX,-FLT_MAX), so a disappearing/reappearing mouse won't have a huge delta.
 
     // Legacy: before 1.87, we required backend to fill io.KeyMap[] (imgui->native map) during initialization and io.KeysDown[] (native indices) every frame.
@@ -2275,6 +2296,7 @@ struct ImGuiTableColumnSortSpecs
 // Obtained by calling TableGetSortSpecs().
 // When 'SpecsDirty == true' you can sort your data. It will be true with sorting specs have changed since last call, or the first time.
 // Make sure to set 'SpecsDirty = false' after sorting, else you may wastefully sort your data every frame!
+// For large tables, ImGuiTableSorter can build a sorted permutation of your items from their keys.
 struct ImGuiTableSortSpecs
 {
     const ImGuiTableColumnSortSpecs* Specs;     // Pointer to sort spec array.
@@ -2352,6 +2374,48 @@ struct ImGuiTextBuffer
     IMGUI_API void      appendfv(const char* fmt, va_list args) IM_FMTLIST(2);
 };
 
+// Helper: Text storage for editing large texts (e.g. multi-megabytes files) with InputTextMultiline().
+// InputTextMultiline() with a char buffer converts the whole text when activated, and moves/converts it again on every edit.
+// Instead this stores the text as wide characters in chunks of bounded size, indexed by Fenwick trees of the chunks sizes and
+// newline counts: inserting/deleting characters and finding a character or line is O(log N), and only visible lines are rendered.
+// Usage:
+//   static ImGuiTextRope text;                // Persistent, owned by you
+//   text.SetText(file_contents);              // UTF-8
+//   if (ImGui::InputTextMultiline("##source", &text, size))
+//       is_modified = true;
+//   text.GetText(&out_buf);                   // Append UTF-8 text to a ImGuiTextBuffer, e.g. to save it
+// Positions are in characters (not UTF-8 bytes). Don't modify the text while its InputTextMultiline() is active.
+struct ImGuiTextRopeChunk
+{
+    int                 Offset;         // Offset of the chunk characters in ImGuiTextRope::Chars[]
+    int                 Size;           // Number of characters
+    int                 NewlineCount;   // Number of '\n' characters
+};
+
+struct ImGuiTextRope
+{
+    ImVector<ImWchar>   Chars;          // [Internal] Storage for all chunks (not in text order)
+    ImVector<ImGuiTextRopeChunk> Chunks;// [Internal] Chunks in text order
+    ImVector<int>       FreeOffsets;    // [Internal] Storage of removed chunks, to be reused
+    ImVector<int>       SizeTree;       // [Internal] Fenwick tree of chunks sizes: SizeTree[n-1] is the sum of chunks in range [n - (n & -n), n)
+    ImVector<int>       NewlineTree;    // [Internal] Fenwick tree of chunks newline counts
+    int                 TextSize;       // [Internal] Number of characters
+    int                 NewlineCount;   // [Internal]
+
+    ImGuiTextRope()     { TextSize = NewlineCount = 0; }
+    int                 Size() const            { return TextSize; }
+    int                 GetLineCount() const    { return NewlineCount + 1; }
+    IMGUI_API void      Clear();
+    IMGUI_API void      SetText(const char* text, const char* text_end = NULL);   // UTF-8
+    IMGUI_API void      GetText(ImGuiTextBuffer* out, int pos = 0, int count = -1) const; // Append UTF-8 text to 'out'. count < 0: until the end.
+    IMGUI_API ImWchar   GetChar(int pos) const;
+    IMGUI_API int       GetChars(int pos, int count, ImWchar* out) const;          // Copy up to 'count' characters, return number of characters copied
+    IMGUI_API int       GetLineStart(int line_n) const;                           // Position of the first character of a line. line_n may be GetLineCount() to get Size().
+    IMGUI_API int       GetLineFromPos(int pos) const;                            // Line containing the character at 'pos' (a '\n' is part of the line it ends)
+    IMGUI_API void      InsertChars(int pos, const ImWchar* text, int text_len);
+    IMGUI_API void      DeleteChars(int pos, int count);
+};
+
 // Helper: Key->Value storage
 // Typically you don't have to worry about this since a storage is held within each Window.
 // We use it to e.g. store collapse state for a tree (Int 0/1)
@@ -2372,12 +2436,17 @@ struct ImGuiStorage
         ImGuiStoragePair(ImGuiID _key, void* _val_p)    { key = _key; val_p = _val_p; }
     };
 
-    ImVector<ImGuiStoragePair>      Data;
-
-    // - Get***() functions find pair, never add/allocate. Pairs are sorted so a query is O(log N)
-    // - Set***() functions find pair, insertion on demand if missing.
-    // - Sorted insertion is costly, paid once. A typical frame shouldn't need to insert any new pair.
-    void                Clear() { Data.clear(); }
+    ImVector<ImGuiStoragePair>      Data;           // Pairs, in insertion order (unless sorted by BuildSortByKey()).
+    ImVector<int>                   Index;          // [Internal] Open-addressing hash table (linear probing): slot -> index into Data[], -1 if empty. Not allocated for small storages.
+    int                             IndexedCount;   // [Internal] Number of Data[] entries present in Index[].
+
+    // - Get***() functions find pair, never add/allocate. Pairs are hashed so a query is O(1) (small storages use a linear search).
+    //   They never modify the storage, so they may be called concurrently as long as nothing modifies it.
+    // - Set***() functions find pair, insertion on demand if missing. Insertion is O(1) amortized.
+    // - If you modify Data[] directly (adding/removing pairs or changing keys), you MUST call BuildSortByKey() afterwards before any lookup.
+    //   Modifying values in place is fine.
+    ImGuiStorage()      { IndexedCount = 0; }
+    void                Clear() { Data.clear(); Index.clear(); IndexedCount = 0; }
     IMGUI_API int       GetInt(ImGuiID key, int default_val = 0) const;
     IMGUI_API void      SetInt(ImGuiID key, int val);
     IMGUI_API bool      GetBool(ImGuiID key, bool default_val = false) const;
@@ -2399,7 +2468,8 @@ struct ImGuiStorage
     // Use on your own storage if you know only integer are being stored (open/close all tree nodes)
     IMGUI_API void      SetAllInt(int val);
 
-    // For quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
+    // For quicker full rebuild of a storage (instead of an incremental one), you may add all your contents to Data[] and then sort once.
+    // This also rebuilds the index. Sorting is not required for lookups but keeps Data[] in a deterministic order.
     IMGUI_API void      BuildSortByKey();
 };
 
@@ -2423,6 +2493,7 @@ struct ImGuiStorage
 // - Clipper calculate the actual range of elements to display based on the current clipping rectangle, position the cursor before the first visible element.
 // - User code submit visible elements.
 // - The clipper also handles various subtleties related to keyboard/gamepad navigation, wrapping etc.
+// For items of variable height (e.g. multi-line entries), use BeginWithHeights() and see ImGuiListClipperHeights below.
 struct ImGuiListClipper
 {
     int             DisplayStart;       // First item to display, updated by each call to Step()
@@ -2430,6 +2501,7 @@ struct ImGuiListClipper
     int             ItemsCount;         // [Internal] Number of items
     float           ItemsHeight;        // [Internal] Height of item after a first step and item submission can calculate it
     float           StartPosY;          // [Internal] Cursor position at the time of Begin() or after table frozen rows are all processed
+    ImGuiListClipperHeights* Heights;   // [Internal] Heights of items, when using BeginWithHeights()
     void*           TempData;           // [Internal] Internal data
 
     // items_count: Use INT_MAX if you don't know how many items you have (in which case the cursor won't be advanced in the final step)
@@ -2437,6 +2509,7 @@ struct ImGuiListClipper
     IMGUI_API ImGuiListClipper();
     IMGUI_API ~ImGuiListClipper();
     IMGUI_API void  Begin(int items_count, float items_height = -1.0f);
+    IMGUI_API void  BeginWithHeights(int items_count, ImGuiListClipperHeights* heights); // Items of variable height. Step() returns one item at a time so each of them can be measured.
     IMGUI_API void  End();             // Automatically called on the last call of Step() that returns false.
     IMGUI_API bool  Step();            // Call until it returns false. The DisplayStart/DisplayEnd fields will be set and you can process/draw those items.
 
@@ -2448,6 +2521,121 @@ struct ImGuiListClipper
 #endif
 };
 
+// Helper: Heights of items of variable height, for ImGuiListClipper::BeginWithHeights().
+// Heights are measured by the clipper as items are displayed and cached by index. Unmeasured items are assumed to be DefaultHeight.
+// Sums are stored in a Fenwick tree, so seeking to an item or a position is O(log N) and lists of millions of items are fine.
+// The total height is the sum of cached heights, so the scrollbar stays stable while scrolling.
+// Usage:
+//   static ImGuiListClipperHeights heights;  // Persistent, one per list
+//   ImGuiListClipper clipper;
+//   clipper.BeginWithHeights(entries.Size, &heights);
+//   while (clipper.Step())
+//       for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
+//           ImGui::TextUnformatted(entries[i]);  // Can be multi-line
+// Items can be added/removed at the end of the list (items_count is passed to Resize()). If items are inserted/removed
+// elsewhere, call Clear(). If an item changes height it is measured again the next time it is displayed.
+struct ImGuiListClipperHeights
+{
+    ImVector<float>     Heights;        // [Internal] Measured height of each item (including spacing), < 0.0f if not measured yet
+    ImVector<double>    SumTree;        // [Internal] Fenwick tree of heights: SumTree[n-1] is the sum of items in range [n - (n & -n), n)
+    float               DefaultHeight;  // Height of unmeasured items, set with SetDefaultHeight(). BeginWithHeights() sets it to GetTextLineHeightWithSpacing() if not set.
+
+    ImGuiListClipperHeights()                   { DefaultHeight = 0.0f; }
+    int                 Size() const            { return Heights.Size; }
+    float               GetItemHeight(int item_n) const { return Heights[item_n] >= 0.0f ? Heights[item_n] : DefaultHeight; }
+    IMGUI_API void      Clear();                                // Forget all items and measurements
+    IMGUI_API void      Resize(int items_count);                // Add unmeasured items or remove items at the end of the list
+    IMGUI_API void      SetDefaultHeight(float height);
+    IMGUI_API void      SetItemHeight(int item_n, float height);// Use -1.0f to forget a measurement
+    IMGUI_API double    GetItemPos(int item_n) const;           // Sum of heights of items before 'item_n'. 'item_n' may be Size() to get the total height.
+    IMGUI_API int       FindItemAtPos(double pos) const;        // Item containing 'pos' (relative to the first item), clamped to valid indices
+};
+
+// Helper: Virtualized tree view, to display huge hierarchies (e.g. scene graphs with millions of nodes) with ImGuiListClipper.
+// Submitting a regular tree with TreeNode()/TreePop() requires submitting every node of every open parent, as the row
+// of a node depends on the open state of all nodes above it. Instead this keeps a flattened list of the rows which are
+// visible with the current open state, so only on-screen rows need to be submitted.
+// - Opening/closing a node only visits the rows of its subtree (rows are inserted/removed in Rows[] with a memmove).
+// - Nodes are identified by an int (e.g. index in your own array). The hierarchy is described by two callbacks, node -1 being the hidden root.
+// - Open state is stored in the window storage like TreeNode() does, with the ID of (void*)(intptr_t)node in the current ID stack.
+// Usage:
+//   static ImGuiTreeView tree;                // Persistent, one per tree
+//   tree.GetChildCount = MyGetChildCount;     // int MyGetChildCount(void* user_data, int node)
+//   tree.GetChild = MyGetChild;               // int MyGetChild(void* user_data, int node, int child_n)
+//   tree.Begin();
+//   ImGuiListClipper clipper;
+//   clipper.Begin(tree.Rows.Size);
+//   while (clipper.Step())
+//       for (int row_n = clipper.DisplayStart; row_n < clipper.DisplayEnd; row_n++)
+//           tree.TreeNode(row_n, my_nodes[tree.Rows[row_n].Node].Name);
+//   tree.End();
+// Call SetDirty() after modifying the hierarchy: the rows will be rebuilt by the next Begin(), which visits all visible rows.
+struct ImGuiTreeViewRow
+{
+    int                 Node;
+    int                 Depth;          // 0 for children of the root
+    bool                IsOpen;         // Rows of children are following this one
+};
+
+struct ImGuiTreeView
+{
+    int                 (*GetChildCount)(void* user_data, int node);
+    int                 (*GetChild)(void* user_data, int node, int child_n);
+    void*               UserData;
+    ImVector<ImGuiTreeViewRow> Rows;    // Flattened list of visible rows, in display order
+    ImVector<ImGuiTreeViewRow> TempRows;// [Internal]
+    ImVector<int>       TempStack;      // [Internal]
+    ImVector<int>       ToggledRows;    // [Internal] Rows toggled by TreeNode() during this frame, applied by End()
+    ImGuiStorage*       Storage;        // [Internal] Set between Begin() and End()
+    ImGuiID             IdSeed;         // [Internal] Set between Begin() and End()
+    bool                IsDirty;        // [Internal]
+
+    ImGuiTreeView()     { GetChildCount = NULL; GetChild = NULL; UserData = NULL; Storage = NULL; IdSeed = 0; IsDirty = true; }
+    void                SetDirty()      { IsDirty = true; }
+    IMGUI_API void      Begin();                                    // Rebuild rows if needed. Call from the ID stack where the rows are submitted.
+    IMGUI_API void      End();                                      // Open/close nodes toggled by TreeNode() during this frame.
+    IMGUI_API bool      TreeNode(int row_n, const char* label, ImGuiTreeNodeFlags flags = 0); // Display row indented according to its depth and return its open state. Never pushes to the tree/ID stack.
+    IMGUI_API void      SetRowOpen(int row_n, bool open);           // Open/close a row immediately (not while iterating rows). Call between Begin() and End().
+};
+
+// Helper: Sort a table by building a permutation of item indices (e.g. for large tables, where sorting your own data with qsort() is too slow).
+// Keys are read from your data with a pointer + stride per column, and items are sorted with a stable radix sort on
+// integer and floating-point keys, in a number of passes which depends on the number of distinct bytes in the keys.
+// - Multi-column sort specs are supported: ties are resolved by the next specs, then by item index.
+// - When only the direction of the primary sort spec has changed, the permutation is reversed in place in O(N) without sorting again.
+// - For string columns, store a precomputed rank (e.g. an int per item, from sorting the unique strings once).
+// Usage:
+//   static ImGuiTableSorter sorter;           // Persistent, one per table
+//   sorter.SetColumnKeys(0, ImGuiDataType_S32, &items[0].ID, sizeof(MyItem));
+//   sorter.SetColumnKeys(1, ImGuiDataType_Float, &items[0].Price, sizeof(MyItem));
+//   if (ImGuiTableSortSpecs* sort_specs = ImGui::TableGetSortSpecs())
+//       sorter.Sort(sort_specs, items.Size);  // Only sorts when needed, clears sort_specs->SpecsDirty
+//   [...] then display items[sorter.Indices[row_n]] for each row
+// Call SetDirty() after modifying the keys of existing items. Changing the items count or a key pointer is detected by Sort().
+struct ImGuiTableSorterColumn
+{
+    ImGuiDataType       DataType;
+    const void*         Data;           // Key of first item
+    int                 Stride;         // Offset in bytes between keys of consecutive items
+
+    ImGuiTableSorterColumn() { DataType = ImGuiDataType_S32; Data = NULL; Stride = 0; }
+};
+
+struct ImGuiTableSorter
+{
+    ImVector<int>       Indices;        // Output: index of the item to display in each row
+    ImVector<ImGuiTableSorterColumn> Columns; // [Internal] Key accessors, indexed by column index (ImGuiTableColumnSortSpecs::ColumnIndex)
+    ImVector<ImGuiTableColumnSortSpecs> LastSpecs; // [Internal] Specs used by the last sort
+    ImVector<ImU64>     TempKeys;       // [Internal]
+    ImVector<int>       TempIndices;    // [Internal]
+    bool                IsDirty;        // [Internal]
+
+    ImGuiTableSorter()  { IsDirty = true; }
+    void                SetDirty()      { IsDirty = true; }
+    IMGUI_API void      SetColumnKeys(int column_n, ImGuiDataType data_type, const void* data, int stride = 0); // Stride 0 = tightly packed keys. Columns without keys are ignored when sorting.
+    IMGUI_API void      Sort(ImGuiTableSortSpecs* sort_specs, int items_count); // Sort if specs, items count or keys have changed. Call every frame.
+};
+
 // Helpers macros to generate 32-bit encoded colors
 #ifdef IMGUI_USE_BGRA_PACKED_COLOR
 #define IM_COL32_R_SHIFT    16
@@ -2842,6 +3030,13 @@ struct ImFontAtlasCustomRect
     bool IsPacked() const           { return X != 0xFFFF; }
 };
 
+// See ImFontAtlas::MarkTexDirty() and ImFontAtlas::TexDirtyRects.
+struct ImFontAtlasDirtyRect
+{
+    unsigned short  X, Y;           // Top-left corner in texture pixels
+    unsigned short  Width, Height;  // Size in texture pixels
+};
+
 // Flags for ImFontAtlas build
 enum ImFontAtlasFlags_
 {
@@ -2877,6 +3072,7 @@ struct ImFontAtlas
     IMGUI_API ImFont*           AddFontFromFileTTF(const char* filename, float size_pixels, const ImFontConfig* font_cfg = NULL, const ImWchar* glyph_ranges = NULL);
     IMGUI_API ImFont*           AddFontFromMemoryTTF(void* font_data, int font_size, float size_pixels, const ImFontConfig* font_cfg = NULL, const ImWchar* glyph_ranges = NULL); // Note: Transfer ownership of 'ttf_data' to ImFontAtlas! Will be deleted after destruction of the atlas. Set font_cfg->FontDataOwnedByAtlas=false to keep ownership of your data and it won't be freed.
     IMGUI_API ImFont*           AddFontFromMemoryCompressedTTF(const void* compressed_font_data, int compressed_font_size, float size_pixels, const ImFontConfig* font_cfg = NULL, const ImWchar* glyph_ranges = NULL); // 'compressed_font_data' still owned by caller. Compress with binary_to_compressed_c.cpp.
+    IMGUI_API ImFont*           AddFontFromMemoryCompressedLZ4TTF(const void* compressed_font_data, int compressed_font_size, float size_pixels, const ImFontConfig* font_cfg = NULL, const ImWchar* glyph_ranges = NULL); // 'compressed_font_data' still owned by caller. Compress with binary_to_compressed_c.cpp with -lz4 parameter. Faster to decompress than the default format.
     IMGUI_API ImFont*           AddFontFromMemoryCompressedBase85TTF(const char* compressed_font_data_base85, float size_pixels, const ImFontConfig* font_cfg = NULL, const ImWchar* glyph_ranges = NULL);              // 'compressed_font_data_base85' still owned by caller. Compress with binary_to_compressed_c.cpp with -base85 parameter.
     IMGUI_API void              ClearInputData();           // Clear input data (all ImFontConfig structures including sizes, TTF data, glyph ranges, etc.) = all the data used to build the texture and fonts.
     IMGUI_API void              ClearTexData();             // Clear output texture data (CPU side). Saves RAM once the texture has been copied to graphics memory.
@@ -2894,6 +3090,15 @@ struct ImFontAtlas
     bool                        IsBuilt() const             { return Fonts.Size > 0 && TexReady; } // Bit ambiguous: used to detect when user didn't built texture but effectively we should check TexID != 0 except that would be backend dependent...
     void                        SetTexID(ImTextureID id)    { TexID = id; }
 
+    // Partial texture updates
+    // - Build() marks the whole texture as dirty. If you modify pixels after your texture was created (e.g. rendering into a custom rectangle), call MarkTexDirty() on the modified region.
+    // - Backends supporting it (see ImGuiBackendFlags_RendererHasTexUpdates) upload the regions listed in TexDirtyRects[] then call ClearTexDirtyRects().
+    //   Other backends/engines need to destroy and recreate the font texture, same as before.
+    IMGUI_API void              MarkTexDirty(int x, int y, int w, int h);
+    IMGUI_API void              MarkCustomRectDirty(int custom_rect_index);
+    bool                        IsTexDirty() const          { return TexDirtyRects.Size > 0; }
+    void                        ClearTexDirtyRects()        { TexDirtyRects.resize(0); }
+
     //-------------------------------------------
     // Glyph Ranges
     //-------------------------------------------
@@ -2917,6 +3122,7 @@ struct ImFontAtlas
     // You can request arbitrary rectangles to be packed into the atlas, for your own purposes.
     // - After calling Build(), you can query the rectangle position and render your pixels.
     // - If you render colored output, set 'atlas->TexPixelsUseColors = true' as this may help some backends decide of prefered texture format.
+    //   (Backends uploading a single-channel texture when possible, e.g. OpenGL3/Vulkan, fall back to RGBA when TexPixelsUseColors is set or when GetTexDataAsRGBA32() was called.)
     // - You can also request your rectangles to be mapped as font glyph (given a font + Unicode point),
     //   so you can render e.g. custom colorful icons and use them as regular glyphs.
     // - Read docs/FONTS.md for more details about using colorful icons.
@@ -2953,6 +3159,7 @@ struct ImFontAtlas
     ImVector<ImFontAtlasCustomRect> CustomRects;    // Rectangles for packing custom texture data into the atlas.
     ImVector<ImFontConfig>      ConfigData;         // Configuration data
     ImVec4                      TexUvLines[IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1];  // UVs for baked anti-aliased lines
+    ImVector<ImFontAtlasDirtyRect> TexDirtyRects;   // Regions of the texture modified since last upload. Overlapping regions are merged.
 
     // [Internal] Font builder
     const ImFontBuilderIO*      FontBuilderIO;      // Opaque interface to a font builder (default to stb_truetype, can be changed to use FreeType by defining IMGUI_ENABLE_FREETYPE).
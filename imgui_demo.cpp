@@ -515,6 +515,8 @@ void ImGui::ShowDemoWindow(bool* p_open)
 
             ImGui::Checkbox("io.ConfigInputTrickleEventQueue", &io.ConfigInputTrickleEventQueue);
             ImGui::SameLine(); HelpMarker("Enable input queue trickling: some types of events submitted during the same frame (e.g. button down + up) will be spread over multiple frames, improving interactions with low framerates.");
+            ImGui::Checkbox("io.ConfigInputCoalesceMouseEvents", &io.ConfigInputCoalesceMouseEvents);
+            ImGui::SameLine(); HelpMarker("Merge consecutive mouse position and mouse wheel events when they are queued, so high-frequency mice/pens don't make inputs lag behind by several frames.");
             ImGui::Checkbox("io.ConfigInputTextCursorBlink", &io.ConfigInputTextCursorBlink);
             ImGui::SameLine(); HelpMarker("Enable blinking cursor (optional as some users consider it to be distracting).");
             ImGui::Checkbox("io.ConfigDragClickToInputText", &io.ConfigDragClickToInputText);
@@ -932,6 +934,41 @@ static void ShowDemoWindowWidgets()
                 ImGui::Indent(ImGui::GetTreeNodeToLabelSpacing());
             ImGui::TreePop();
         }
+
+        IMGUI_DEMO_MARKER("Widgets/Trees/Virtualized tree");
+        if (ImGui::TreeNode("Virtualized tree"))
+        {
+            HelpMarker(
+                "ImGuiTreeView keeps a flattened list of open rows so only visible rows are submitted, "
+                "using ImGuiListClipper. Here a tree of 1 million nodes where each node has 10 children.");
+
+            // Our hierarchy: children of root (-1) are 0..9, children of node N are (N+1)*10..(N+1)*10+9.
+            struct Funcs
+            {
+                static int GetChildCount(void*, int node) { return ((node + 1) * 10 < 1000000) ? 10 : 0; }
+                static int GetChild(void*, int node, int child_n) { return (node + 1) * 10 + child_n; }
+            };
+            static ImGuiTreeView tree;
+            tree.GetChildCount = Funcs::GetChildCount;
+            tree.GetChild = Funcs::GetChild;
+            if (ImGui::BeginChild("##tree", ImVec2(0.0f, ImGui::GetTextLineHeightWithSpacing() * 12), true))
+            {
+                tree.Begin();
+                ImGuiListClipper clipper;
+                clipper.Begin(tree.Rows.Size);
+                while (clipper.Step())
+                    for (int row_n = clipper.DisplayStart; row_n < clipper.DisplayEnd; row_n++)
+                    {
+                        char label[32];
+                        sprintf(label, "Node %d", tree.Rows[row_n].Node);
+                        tree.TreeNode(row_n, label, ImGuiTreeNodeFlags_SpanAvailWidth);
+                    }
+                tree.End();
+            }
+            ImGui::EndChild();
+            ImGui::Text("%d visible rows", tree.Rows.Size);
+            ImGui::TreePop();
+        }
         ImGui::TreePop();
     }
 
@@ -1409,6 +1446,32 @@ static void ShowDemoWindowWidgets()
             ImGui::TreePop();
         }
 
+        IMGUI_DEMO_MARKER("Widgets/Text Input/Large Text Input (ImGuiTextRope)");
+        if (ImGui::TreeNode("Large Text Input (ImGuiTextRope)"))
+        {
+            // Using a ImGuiTextRope, edits and rendering don't depend on the size of the text.
+            static ImGuiTextRope rope;
+            static int lines_count = 100000;
+            static bool generate = true;
+            HelpMarker("InputTextMultiline() can edit a ImGuiTextRope in place instead of a char buffer. Edits cost O(log N) and only visible lines are rendered, which makes it suitable for very large texts. Callbacks are not supported in this mode.");
+            ImGui::SetNextItemWidth(ImGui::GetFontSize() * 8);
+            ImGui::DragInt("##lines", &lines_count, 1000.0f, 1, 10000000);
+            ImGui::SameLine();
+            if (ImGui::Button("Generate") || generate)
+            {
+                generate = false;
+                ImGuiTextBuffer buf;
+                buf.reserve(lines_count * 32);
+                for (int n = 0; n < lines_count; n++)
+                    buf.appendf("%08d: The quick brown fox jumps over the lazy dog.\n", n);
+                rope.SetText(buf.begin(), buf.end());
+            }
+            ImGui::SameLine();
+            ImGui::Text("%d lines, %d characters", rope.GetLineCount(), rope.Size());
+            ImGui::InputTextMultiline("##rope", &rope, ImVec2(-FLT_MIN, ImGui::GetTextLineHeight() * 16), ImGuiInputTextFlags_AllowTabInput);
+            ImGui::TreePop();
+        }
+
         IMGUI_DEMO_MARKER("Widgets/Text Input/Filtered Text Input");
         if (ImGui::TreeNode("Filtered Text Input"))
         {
@@ -4602,6 +4665,44 @@ static void ShowDemoWindowTables()
             }
             ImGui::EndTable();
         }
+
+        ImGui::Spacing();
+        ImGui::TextUnformatted("Many columns");
+        ImGui::SameLine();
+        HelpMarker(
+            "Using TableGetNextVisibleColumn() + TableSetColumnIndex() to only visit visible columns, "
+            "and ImGuiListClipper to only visit visible rows.\n"
+            "Only visible columns are allocated draw channels, so the cost of this table doesn't depend on its number of columns.");
+        const int COLUMNS_COUNT = 1000;
+        ImGuiTableFlags flags3 = ImGuiTableFlags_ScrollX | ImGuiTableFlags_ScrollY | ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersOuter | ImGuiTableFlags_BordersV | ImGuiTableFlags_Resizable | ImGuiTableFlags_Reorderable | ImGuiTableFlags_Hideable;
+        if (ImGui::BeginTable("table_many_columns", COLUMNS_COUNT, flags3, outer_size))
+        {
+            ImGui::TableSetupScrollFreeze(1, 1);
+            ImGui::TableSetupColumn("Line #", ImGuiTableColumnFlags_NoHide);
+            for (int column = 1; column < COLUMNS_COUNT; column++)
+            {
+                char label[16];
+                sprintf(label, "Col %d", column);
+                ImGui::TableSetupColumn(label);
+            }
+            ImGui::TableHeadersRow();
+            ImGuiListClipper clipper;
+            clipper.Begin(1000);
+            while (clipper.Step())
+                for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++)
+                {
+                    ImGui::TableNextRow();
+                    for (int column = ImGui::TableGetNextVisibleColumn(-1); column != -1; column = ImGui::TableGetNextVisibleColumn(column))
+                    {
+                        ImGui::TableSetColumnIndex(column);
+                        if (column == 0)
+                            ImGui::Text("Line %d", row);
+                        else
+                            ImGui::Text("%d,%d", column, row);
+                    }
+                }
+            ImGui::EndTable();
+        }
         ImGui::TreePop();
     }
 
@@ -5319,6 +5420,66 @@ static void ShowDemoWindowTables()
         ImGui::TreePop();
     }
 
+    if (open_action != -1)
+        ImGui::SetNextItemOpen(open_action != 0);
+    IMGUI_DEMO_MARKER("Tables/Sorting with ImGuiTableSorter");
+    if (ImGui::TreeNode("Sorting with ImGuiTableSorter"))
+    {
+        // Demonstrate using ImGuiTableSorter to sort a large table without moving our data:
+        // the sorter reads keys from our items and gives us the index of the item to display in each row.
+        struct MyLargeItem { int ID; int Category; float Value; };
+        static ImVector<MyLargeItem> items;
+        static ImGuiTableSorter sorter;
+        if (items.Size == 0)
+        {
+            items.resize(100000);
+            ImU32 seed = 1;
+            for (int n = 0; n < items.Size; n++)
+            {
+                seed = seed * 1664525u + 1013904223u;
+                items[n].ID = n;
+                items[n].Category = (int)(seed >> 28);
+                items[n].Value = (float)((seed >> 8) % 100000) * 0.01f;
+            }
+        }
+        HelpMarker("ImGuiTableSorter uses a radix sort on integer and floating-point keys. Hold shift when clicking headers to sort on multiple columns. Changing the direction of the primary column only reverses the existing order.");
+
+        const ImGuiTableFlags flags = ImGuiTableFlags_Resizable | ImGuiTableFlags_Sortable | ImGuiTableFlags_SortMulti
+            | ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersOuter | ImGuiTableFlags_BordersV | ImGuiTableFlags_ScrollY;
+        if (ImGui::BeginTable("table_sorter", 3, flags, ImVec2(0.0f, TEXT_BASE_HEIGHT * 15), 0.0f))
+        {
+            ImGui::TableSetupColumn("ID", ImGuiTableColumnFlags_DefaultSort);
+            ImGui::TableSetupColumn("Category");
+            ImGui::TableSetupColumn("Value");
+            ImGui::TableSetupScrollFreeze(0, 1);
+            ImGui::TableHeadersRow();
+
+            // Keys are identified by column index. Sort() only sorts when specs, items count or keys have changed.
+            sorter.SetColumnKeys(0, ImGuiDataType_S32, &items[0].ID, sizeof(MyLargeItem));
+            sorter.SetColumnKeys(1, ImGuiDataType_S32, &items[0].Category, sizeof(MyLargeItem));
+            sorter.SetColumnKeys(2, ImGuiDataType_Float, &items[0].Value, sizeof(MyLargeItem));
+            if (ImGuiTableSortSpecs* sorts_specs = ImGui::TableGetSortSpecs())
+                sorter.Sort(sorts_specs, items.Size);
+
+            ImGuiListClipper clipper;
+            clipper.Begin(sorter.Indices.Size);
+            while (clipper.Step())
+                for (int row_n = clipper.DisplayStart; row_n < clipper.DisplayEnd; row_n++)
+                {
+                    const MyLargeItem& item = items[sorter.Indices[row_n]];
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%06d", item.ID);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%d", item.Category);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.2f", item.Value);
+                }
+            ImGui::EndTable();
+        }
+        ImGui::TreePop();
+    }
+
     // In this example we'll expose most table flags and settings.
     // For specific flags and settings refer to the corresponding section for more detailed explanation.
     // This section is mostly useful to experiment with combining certain flags or settings with each others.
@@ -7367,7 +7528,8 @@ static void ShowExampleAppLongText(bool* p_open)
     ImGui::Combo("Test type", &test_type,
         "Single call to TextUnformatted()\0"
         "Multiple calls to Text(), clipped\0"
-        "Multiple calls to Text(), not clipped (slow)\0");
+        "Multiple calls to Text(), not clipped (slow)\0"
+        "Multiple calls to Text(), variable height, clipped\0");
     ImGui::Text("Buffer contents: %d lines, %d bytes", lines, log.size());
     if (ImGui::Button("Clear")) { log.clear(); lines = 0; }
     ImGui::SameLine();
@@ -7403,6 +7565,25 @@ static void ShowExampleAppLongText(bool* p_open)
             ImGui::Text("%i The quick brown fox jumps over the lazy dog", i);
         ImGui::PopStyleVar();
         break;
+    case 3:
+        {
+            // Items of variable height (here every 10th item has 3 lines): ImGuiListClipperHeights stores the height
+            // of each item, as measured when displayed. It needs to persist so we make it static here.
+            static ImGuiListClipperHeights heights;
+            ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(0, 0));
+            ImGuiListClipper clipper;
+            clipper.BeginWithHeights(lines, &heights);
+            while (clipper.Step())
+                for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
+                {
+                    if (i % 10 == 0)
+                        ImGui::Text("%i The quick brown fox\n  jumps over\n  the lazy dog", i);
+                    else
+                        ImGui::Text("%i The quick brown fox jumps over the lazy dog", i);
+                }
+            ImGui::PopStyleVar();
+            break;
+        }
     }
     ImGui::EndChild();
     ImGui::End();
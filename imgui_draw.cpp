@@ -407,6 +407,7 @@ void ImDrawListSharedData::SetCircleTessellationMaxError(float max_error)
 // Initialize before use in a new frame. We always have a command ready in the buffer.
 void ImDrawList::_ResetForNewFrame()
 {
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_DrawList);
     // Verify that the ImDrawCmd fields we want to memcmp() are contiguous in memory.
     IM_STATIC_ASSERT(IM_OFFSETOF(ImDrawCmd, ClipRect) == 0);
     IM_STATIC_ASSERT(IM_OFFSETOF(ImDrawCmd, TextureId) == sizeof(ImVec4));
@@ -457,6 +458,7 @@ ImDrawList* ImDrawList::CloneOutput() const
 
 void ImDrawList::AddDrawCmd()
 {
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_DrawList);
     ImDrawCmd draw_cmd;
     draw_cmd.ClipRect = _CmdHeader.ClipRect;    // Same as calling ImDrawCmd_HeaderCopy()
     draw_cmd.TextureId = _CmdHeader.TextureId;
@@ -595,6 +597,7 @@ int ImDrawList::_CalcCircleAutoSegmentCount(float radius) const
 // Render-level scissoring. This is passed down to your render function but not used for CPU-side coarse clipping. Prefer using higher-level ImGui::PushClipRect() to affect logic (hit-testing and widget culling)
 void ImDrawList::PushClipRect(ImVec2 cr_min, ImVec2 cr_max, bool intersect_with_current_clip_rect)
 {
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_DrawList);
     ImVec4 cr(cr_min.x, cr_min.y, cr_max.x, cr_max.y);
     if (intersect_with_current_clip_rect)
     {
@@ -626,6 +629,7 @@ void ImDrawList::PopClipRect()
 
 void ImDrawList::PushTextureID(ImTextureID texture_id)
 {
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_DrawList);
     _TextureIdStack.push_back(texture_id);
     _CmdHeader.TextureId = texture_id;
     _OnChangedTextureID();
@@ -643,6 +647,7 @@ void ImDrawList::PopTextureID()
 // submit the intermediate results. PrimUnreserve() can be used to release unused allocations.
 void ImDrawList::PrimReserve(int idx_count, int vtx_count)
 {
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_DrawList);
     // Large mesh support (when enabled)
     IM_ASSERT_PARANOID(idx_count >= 0 && vtx_count >= 0);
     if (sizeof(ImDrawIdx) == 2 && (_VtxCurrentIdx + vtx_count >= (1 << 16)) && (Flags & ImDrawListFlags_AllowVtxOffset))
@@ -1070,6 +1075,7 @@ void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_coun
 
 void ImDrawList::_PathArcToFastEx(const ImVec2& center, float radius, int a_min_sample, int a_max_sample, int a_step)
 {
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_DrawList);
     if (radius <= 0.0f)
     {
         _Path.push_back(center);
@@ -1162,6 +1168,7 @@ void ImDrawList::_PathArcToFastEx(const ImVec2& center, float radius, int a_min_
 
 void ImDrawList::_PathArcToN(const ImVec2& center, float radius, float a_min, float a_max, int num_segments)
 {
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_DrawList);
     if (radius <= 0.0f)
     {
         _Path.push_back(center);
@@ -1701,6 +1708,7 @@ void ImDrawListSplitter::ClearFreeMemory()
 
 void ImDrawListSplitter::Split(ImDrawList* draw_list, int channels_count)
 {
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_DrawList);
     IM_UNUSED(draw_list);
     IM_ASSERT(_Current == 0 && _Count <= 1 && "Nested channel splitting is not supported. Please use separate instances of ImDrawListSplitter.");
     int old_channels_count = _Channels.Size;
@@ -1731,6 +1739,7 @@ void ImDrawListSplitter::Split(ImDrawList* draw_list, int channels_count)
 
 void ImDrawListSplitter::Merge(ImDrawList* draw_list)
 {
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_DrawList);
     // Note that we never use or rely on _Channels.Size because it is merely a buffer that we never shrink back to 0 to keep all sub-buffers ready for use.
     if (_Count <= 1)
         return;
@@ -2031,6 +2040,7 @@ void    ImFontAtlas::ClearTexData()
     TexPixelsAlpha8 = NULL;
     TexPixelsRGBA32 = NULL;
     TexPixelsUseColors = false;
+    TexDirtyRects.clear();
     // Important: we leave TexReady untouched
 }
 
@@ -2050,6 +2060,7 @@ void    ImFontAtlas::Clear()
 
 void    ImFontAtlas::GetTexDataAsAlpha8(unsigned char** out_pixels, int* out_width, int* out_height, int* out_bytes_per_pixel)
 {
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_Fonts);
     // Build atlas on demand
     if (TexPixelsAlpha8 == NULL)
         Build();
@@ -2062,6 +2073,7 @@ void    ImFontAtlas::GetTexDataAsAlpha8(unsigned char** out_pixels, int* out_wid
 
 void    ImFontAtlas::GetTexDataAsRGBA32(unsigned char** out_pixels, int* out_width, int* out_height, int* out_bytes_per_pixel)
 {
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_Fonts);
     // Convert to RGBA32 format on demand
     // Although it is likely to be the most commonly used format, our font rendering is 1 channel / 8 bpp
     if (!TexPixelsRGBA32)
@@ -2086,6 +2098,7 @@ void    ImFontAtlas::GetTexDataAsRGBA32(unsigned char** out_pixels, int* out_wid
 
 ImFont* ImFontAtlas::AddFont(const ImFontConfig* font_cfg)
 {
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_Fonts);
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
     IM_ASSERT(font_cfg->FontData != NULL && font_cfg->FontDataSize > 0);
     IM_ASSERT(font_cfg->SizePixels > 0.0f);
@@ -2119,6 +2132,8 @@ ImFont* ImFontAtlas::AddFont(const ImFontConfig* font_cfg)
 // Default font TTF is compressed with stb_compress then base85 encoded (see misc/fonts/binary_to_compressed_c.cpp for encoder)
 static unsigned int stb_decompress_length(const unsigned char* input);
 static unsigned int stb_decompress(unsigned char* output, const unsigned char* input, unsigned int length);
+static unsigned int ImLZ4DecompressLength(const unsigned char* input, unsigned int input_size);
+static unsigned int ImLZ4Decompress(unsigned char* output, unsigned int output_size, const unsigned char* input, unsigned int input_size);
 static const char*  GetDefaultCompressedFontDataTTFBase85();
 static unsigned int Decode85Byte(char c)                                    { return c >= '\\' ? c-36 : c-35; }
 static void         Decode85(const unsigned char* src, unsigned char* dst)
@@ -2211,6 +2226,24 @@ ImFont* ImFontAtlas::AddFontFromMemoryCompressedBase85TTF(const char* compressed
     return font;
 }
 
+ImFont* ImFontAtlas::AddFontFromMemoryCompressedLZ4TTF(const void* compressed_ttf_data, int compressed_ttf_size, float size_pixels, const ImFontConfig* font_cfg_template, const ImWchar* glyph_ranges)
+{
+    const unsigned int buf_decompressed_size = ImLZ4DecompressLength((const unsigned char*)compressed_ttf_data, (unsigned int)compressed_ttf_size);
+    IM_ASSERT(buf_decompressed_size > 0 && "Invalid data. Compress with binary_to_compressed_c.cpp with -lz4 parameter.");
+    unsigned char* buf_decompressed_data = (unsigned char*)IM_ALLOC(buf_decompressed_size);
+    if (ImLZ4Decompress(buf_decompressed_data, buf_decompressed_size, (const unsigned char*)compressed_ttf_data, (unsigned int)compressed_ttf_size) != buf_decompressed_size)
+    {
+        IM_FREE(buf_decompressed_data);
+        IM_ASSERT_USER_ERROR(0, "Could not decompress font data!");
+        return NULL;
+    }
+
+    ImFontConfig font_cfg = font_cfg_template ? *font_cfg_template : ImFontConfig();
+    IM_ASSERT(font_cfg.FontData == NULL);
+    font_cfg.FontDataOwnedByAtlas = true;
+    return AddFontFromMemoryTTF(buf_decompressed_data, (int)buf_decompressed_size, size_pixels, &font_cfg, glyph_ranges);
+}
+
 int ImFontAtlas::AddCustomRectRegular(int width, int height)
 {
     IM_ASSERT(width > 0 && width <= 0xFFFF);
@@ -2241,6 +2274,47 @@ int ImFontAtlas::AddCustomRectFontGlyph(ImFont* font, ImWchar id, int width, int
     return CustomRects.Size - 1; // Return index
 }
 
+// Register a region of the texture which needs to be uploaded again by the backend.
+// We merge with any overlapping or touching region so the list stays short when e.g. many adjacent custom rectangles are updated.
+void ImFontAtlas::MarkTexDirty(int x, int y, int w, int h)
+{
+    IM_ASSERT(TexWidth > 0 && TexHeight > 0);   // Font atlas needs to be built before we can mark regions
+    x = ImMax(x, 0);
+    y = ImMax(y, 0);
+    int x2 = ImMin(x + w, TexWidth);
+    int y2 = ImMin(y + h, TexHeight);
+    if (x2 <= x || y2 <= y)
+        return;
+
+    // Merge with existing regions (merging may create new overlaps, so we restart the scan until stable)
+    for (int n = 0; n < TexDirtyRects.Size; n++)
+    {
+        const ImFontAtlasDirtyRect& r = TexDirtyRects[n];
+        if (x > r.X + r.Width || x2 < r.X || y > r.Y + r.Height || y2 < r.Y)
+            continue;
+        x = ImMin(x, (int)r.X);
+        y = ImMin(y, (int)r.Y);
+        x2 = ImMax(x2, (int)(r.X + r.Width));
+        y2 = ImMax(y2, (int)(r.Y + r.Height));
+        TexDirtyRects.erase(TexDirtyRects.Data + n);
+        n = -1;
+    }
+
+    ImFontAtlasDirtyRect r;
+    r.X = (unsigned short)x;
+    r.Y = (unsigned short)y;
+    r.Width = (unsigned short)(x2 - x);
+    r.Height = (unsigned short)(y2 - y);
+    TexDirtyRects.push_back(r);
+}
+
+void ImFontAtlas::MarkCustomRectDirty(int custom_rect_index)
+{
+    const ImFontAtlasCustomRect* r = GetCustomRectByIndex(custom_rect_index);
+    IM_ASSERT(r->IsPacked());                   // Make sure the rectangle has been packed
+    MarkTexDirty(r->X, r->Y, r->Width, r->Height);
+}
+
 void ImFontAtlas::CalcCustomRectUV(const ImFontAtlasCustomRect* rect, ImVec2* out_uv_min, ImVec2* out_uv_max) const
 {
     IM_ASSERT(TexWidth > 0 && TexHeight > 0);   // Font atlas needs to be built before we can calculate UV coordinates
@@ -2272,6 +2346,8 @@ bool ImFontAtlas::GetMouseCursorTexData(ImGuiMouseCursor cursor_type, ImVec2* ou
 
 bool    ImFontAtlas::Build()
 {
+    IMGUI_PROFILE_SCOPE("ImFontAtlas::Build");
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_Fonts);
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
 
     // Default font is none are specified
@@ -2608,8 +2684,7 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
 
 const ImFontBuilderIO* ImFontAtlasGetBuilderForStbTruetype()
 {
-    static ImFontBuilderIO io;
-    io.FontBuilder_Build = ImFontAtlasBuildWithStbTruetype;
+    static const ImFontBuilderIO io = { ImFontAtlasBuildWithStbTruetype };
     return &io;
 }
 
@@ -2797,6 +2872,10 @@ void ImFontAtlasBuildFinish(ImFontAtlas* atlas)
     ImFontAtlasBuildRenderDefaultTexData(atlas);
     ImFontAtlasBuildRenderLinesTexData(atlas);
 
+    // Whole texture needs to be uploaded
+    atlas->TexDirtyRects.resize(0);
+    atlas->MarkTexDirty(0, 0, atlas->TexWidth, atlas->TexHeight);
+
     // Register custom rectangle glyphs
     for (int i = 0; i < atlas->CustomRects.Size; i++)
     {
@@ -3162,6 +3241,7 @@ static ImWchar FindFirstExistingGlyph(ImFont* font, const ImWchar* candidate_cha
 
 void ImFont::BuildLookupTable()
 {
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_Fonts);
     int max_codepoint = 0;
     for (int i = 0; i != Glyphs.Size; i++)
         max_codepoint = ImMax(max_codepoint, (int)Glyphs[i].Codepoint);
@@ -3982,44 +4062,49 @@ static unsigned int stb_decompress_length(const unsigned char *input)
     return (input[8] << 24) + (input[9] << 16) + (input[10] << 8) + input[11];
 }
 
-static unsigned char *stb__barrier_out_e, *stb__barrier_out_b;
-static const unsigned char *stb__barrier_in_b;
-static unsigned char *stb__dout;
-static void stb__match(const unsigned char *data, unsigned int length)
+// Decompression state is kept on the stack (instead of the original static variables) so decompression is reentrant.
+struct stb__decompress_state
+{
+    unsigned char *barrier_out_e, *barrier_out_b;
+    const unsigned char *barrier_in_b;
+    unsigned char *dout;
+};
+
+static void stb__match(stb__decompress_state *c, const unsigned char *data, unsigned int length)
 {
     // INVERSE of memmove... write each byte before copying the next...
-    IM_ASSERT(stb__dout + length <= stb__barrier_out_e);
-    if (stb__dout + length > stb__barrier_out_e) { stb__dout += length; return; }
-    if (data < stb__barrier_out_b) { stb__dout = stb__barrier_out_e+1; return; }
-    while (length--) *stb__dout++ = *data++;
+    IM_ASSERT(c->dout + length <= c->barrier_out_e);
+    if (c->dout + length > c->barrier_out_e) { c->dout += length; return; }
+    if (data < c->barrier_out_b) { c->dout = c->barrier_out_e+1; return; }
+    while (length--) *c->dout++ = *data++;
 }
 
-static void stb__lit(const unsigned char *data, unsigned int length)
+static void stb__lit(stb__decompress_state *c, const unsigned char *data, unsigned int length)
 {
-    IM_ASSERT(stb__dout + length <= stb__barrier_out_e);
-    if (stb__dout + length > stb__barrier_out_e) { stb__dout += length; return; }
-    if (data < stb__barrier_in_b) { stb__dout = stb__barrier_out_e+1; return; }
-    memcpy(stb__dout, data, length);
-    stb__dout += length;
+    IM_ASSERT(c->dout + length <= c->barrier_out_e);
+    if (c->dout + length > c->barrier_out_e) { c->dout += length; return; }
+    if (data < c->barrier_in_b) { c->dout = c->barrier_out_e+1; return; }
+    memcpy(c->dout, data, length);
+    c->dout += length;
 }
 
 #define stb__in2(x)   ((i[x] << 8) + i[(x)+1])
 #define stb__in3(x)   ((i[x] << 16) + stb__in2((x)+1))
 #define stb__in4(x)   ((i[x] << 24) + stb__in3((x)+1))
 
-static const unsigned char *stb_decompress_token(const unsigned char *i)
+static const unsigned char *stb_decompress_token(stb__decompress_state *c, const unsigned char *i)
 {
     if (*i >= 0x20) { // use fewer if's for cases that expand small
-        if (*i >= 0x80)       stb__match(stb__dout-i[1]-1, i[0] - 0x80 + 1), i += 2;
-        else if (*i >= 0x40)  stb__match(stb__dout-(stb__in2(0) - 0x4000 + 1), i[2]+1), i += 3;
-        else /* *i >= 0x20 */ stb__lit(i+1, i[0] - 0x20 + 1), i += 1 + (i[0] - 0x20 + 1);
+        if (*i >= 0x80)       stb__match(c, c->dout-i[1]-1, i[0] - 0x80 + 1), i += 2;
+        else if (*i >= 0x40)  stb__match(c, c->dout-(stb__in2(0) - 0x4000 + 1), i[2]+1), i += 3;
+        else /* *i >= 0x20 */ stb__lit(c, i+1, i[0] - 0x20 + 1), i += 1 + (i[0] - 0x20 + 1);
     } else { // more ifs for cases that expand large, since overhead is amortized
-        if (*i >= 0x18)       stb__match(stb__dout-(stb__in3(0) - 0x180000 + 1), i[3]+1), i += 4;
-        else if (*i >= 0x10)  stb__match(stb__dout-(stb__in3(0) - 0x100000 + 1), stb__in2(3)+1), i += 5;
-        else if (*i >= 0x08)  stb__lit(i+2, stb__in2(0) - 0x0800 + 1), i += 2 + (stb__in2(0) - 0x0800 + 1);
-        else if (*i == 0x07)  stb__lit(i+3, stb__in2(1) + 1), i += 3 + (stb__in2(1) + 1);
-        else if (*i == 0x06)  stb__match(stb__dout-(stb__in3(1)+1), i[4]+1), i += 5;
-        else if (*i == 0x04)  stb__match(stb__dout-(stb__in3(1)+1), stb__in2(4)+1), i += 6;
+        if (*i >= 0x18)       stb__match(c, c->dout-(stb__in3(0) - 0x180000 + 1), i[3]+1), i += 4;
+        else if (*i >= 0x10)  stb__match(c, c->dout-(stb__in3(0) - 0x100000 + 1), stb__in2(3)+1), i += 5;
+        else if (*i >= 0x08)  stb__lit(c, i+2, stb__in2(0) - 0x0800 + 1), i += 2 + (stb__in2(0) - 0x0800 + 1);
+        else if (*i == 0x07)  stb__lit(c, i+3, stb__in2(1) + 1), i += 3 + (stb__in2(1) + 1);
+        else if (*i == 0x06)  stb__match(c, c->dout-(stb__in3(1)+1), i[4]+1), i += 5;
+        else if (*i == 0x04)  stb__match(c, c->dout-(stb__in3(1)+1), stb__in2(4)+1), i += 6;
     }
     return i;
 }
@@ -4060,19 +4145,21 @@ static unsigned int stb_decompress(unsigned char *output, const unsigned char *i
     if (stb__in4(0) != 0x57bC0000) return 0;
     if (stb__in4(4) != 0)          return 0; // error! stream is > 4GB
     const unsigned int olen = stb_decompress_length(i);
-    stb__barrier_in_b = i;
-    stb__barrier_out_e = output + olen;
-    stb__barrier_out_b = output;
+    stb__decompress_state state;
+    stb__decompress_state *c = &state;
+    c->barrier_in_b = i;
+    c->barrier_out_e = output + olen;
+    c->barrier_out_b = output;
     i += 16;
 
-    stb__dout = output;
+    c->dout = output;
     for (;;) {
         const unsigned char *old_i = i;
-        i = stb_decompress_token(i);
+        i = stb_decompress_token(c, i);
         if (i == old_i) {
             if (*i == 0x05 && i[1] == 0xfa) {
-                IM_ASSERT(stb__dout == output + olen);
-                if (stb__dout != output + olen) return 0;
+                IM_ASSERT(c->dout == output + olen);
+                if (c->dout != output + olen) return 0;
                 if (stb_adler32(1, output, olen) != (unsigned int) stb__in4(2))
                     return 0;
                 return olen;
@@ -4081,12 +4168,96 @@ static unsigned int stb_decompress(unsigned char *output, const unsigned char *i
                 return 0;
             }
         }
-        IM_ASSERT(stb__dout <= output + olen);
-        if (stb__dout > output + olen)
+        IM_ASSERT(c->dout <= output + olen);
+        if (c->dout > output + olen)
             return 0;
     }
 }
 
+//-----------------------------------------------------------------------------
+// LZ4 block decompression, for AddFontFromMemoryCompressedLZ4TTF()
+//-----------------------------------------------------------------------------
+// Compressed with 'binary_to_compressed_c.cpp -lz4': a 8 bytes header ('I','L','Z','4' + decompressed size as a
+// little-endian 32-bit value) followed by a single block in the standard LZ4 block format.
+// This is much faster to decode than stb_decompress(): there's no checksum and literals/matches are copied in bulk.
+// The decoder is bounds-checked and returns 0 on malformed data.
+//-----------------------------------------------------------------------------
+
+static unsigned int ImLZ4DecompressLength(const unsigned char* input, unsigned int input_size)
+{
+    if (input_size < 8 || input[0] != 'I' || input[1] != 'L' || input[2] != 'Z' || input[3] != '4')
+        return 0;
+    return (unsigned int)input[4] | ((unsigned int)input[5] << 8) | ((unsigned int)input[6] << 16) | ((unsigned int)input[7] << 24);
+}
+
+static unsigned int ImLZ4Decompress(unsigned char* output, unsigned int output_size, const unsigned char* input, unsigned int input_size)
+{
+    if (ImLZ4DecompressLength(input, input_size) != output_size)
+        return 0;
+    const unsigned char* ip = input + 8;
+    const unsigned char* ip_end = input + input_size;
+    unsigned char* op = output;
+    unsigned char* op_end = output + output_size;
+    while (ip < ip_end)
+    {
+        const unsigned int token = *ip++;
+
+        // Literals
+        size_t literal_len = token >> 4;
+        if (literal_len == 15)
+        {
+            unsigned int b;
+            do
+            {
+                if (ip >= ip_end)
+                    return 0;
+                b = *ip++;
+                literal_len += b;
+            } while (b == 255);
+        }
+        if ((size_t)(ip_end - ip) < literal_len || (size_t)(op_end - op) < literal_len)
+            return 0;
+        memcpy(op, ip, literal_len);
+        op += literal_len;
+        ip += literal_len;
+        if (ip == ip_end)
+            break; // Last sequence has no match
+
+        // Match
+        if (ip_end - ip < 2)
+            return 0;
+        const size_t offset = (size_t)ip[0] | ((size_t)ip[1] << 8);
+        ip += 2;
+        if (offset == 0 || offset > (size_t)(op - output))
+            return 0;
+        size_t match_len = token & 15;
+        if (match_len == 15)
+        {
+            unsigned int b;
+            do
+            {
+                if (ip >= ip_end)
+                    return 0;
+                b = *ip++;
+                match_len += b;
+            } while (b == 255);
+        }
+        match_len += 4;
+        if ((size_t)(op_end - op) < match_len)
+            return 0;
+
+        // Overlapping matches (offset < match_len) repeat the last 'offset' bytes: copy by chunks of 'offset' bytes which never overlap.
+        while (match_len > 0)
+        {
+            const size_t chunk_len = ImMin(offset, match_len);
+            memcpy(op, op - offset, chunk_len);
+            op += chunk_len;
+            match_len -= chunk_len;
+        }
+    }
+    return (unsigned int)(op - output);
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] Default font data (ProggyClean.ttf)
 //-----------------------------------------------------------------------------
@@ -60,6 +60,13 @@ Index of this file:
 #include <immintrin.h>
 #endif
 
+// Enable ARMv8 CRC32 instructions if available (same polynomial as our lookup table, so IDs are identical)
+// Note that SSE4.2 _mm_crc32_xxx() instructions use the CRC32C polynomial and cannot be used without changing all IDs.
+#if defined(__ARM_FEATURE_CRC32) && !defined(__ARM_BIG_ENDIAN) && !defined(IMGUI_DISABLE_ARM_CRC32)
+#define IMGUI_ENABLE_ARM_CRC32
+#include <arm_acle.h>
+#endif
+
 // Visual Studio warnings
 #ifdef _MSC_VER
 #pragma warning (push)
@@ -122,10 +129,14 @@ struct ImGuiDockContext;            // Docking system context
 struct ImGuiDockRequest;            // Docking system dock/undock queued request
 struct ImGuiDockNode;               // Docking system node (hold a list of Windows OR two child dock nodes)
 struct ImGuiDockNodeSettings;       // Storage for a dock node in .ini file (we preserve those even if the associated dock node isn't active during the session)
+struct ImGuiFileStream;             // Buffered writer appending to an open file (e.g. LogToFile), optionally from a background thread
+struct ImGuiFileWriter;             // Writer for files replaced as a whole (e.g. .ini settings), optionally from a background thread
+struct ImGuiGcCandidate;            // Candidate for budget-based garbage collection of transient buffers (see io.ConfigMemoryCompactBudget)
 struct ImGuiGroupData;              // Stacked storage data for BeginGroup()/EndGroup()
 struct ImGuiInputTextState;         // Internal state of the currently focused/edited text input box
 struct ImGuiLastItemData;           // Status storage for last submitted items
 struct ImGuiMenuColumns;            // Simple column measurement, currently used for MenuItem() only
+struct ImGuiNavIndexItem;           // Item rectangle recorded during a directional navigation move request, used to bound the scoring of the next one
 struct ImGuiNavItemData;            // Result of a gamepad/keyboard directional navigation move query result
 struct ImGuiMetricsConfig;          // Storage for ShowMetricsWindow() and DebugNodeXXX() functions
 struct ImGuiNextWindowData;         // Storage for SetNextWindow** functions
@@ -133,6 +144,8 @@ struct ImGuiNextItemData;           // Storage for SetNextItem** functions
 struct ImGuiOldColumnData;          // Storage data for a single column for legacy Columns() api
 struct ImGuiOldColumns;             // Storage data for a columns set for legacy Columns() api
 struct ImGuiPopupData;              // Storage for current popup stack
+struct ImGuiSettingsBinaryReader;   // Reader for binary settings data (see LoadBinarySettingsFromMemory())
+struct ImGuiSettingsBinaryWriter;   // Writer for binary settings data (see SaveBinarySettingsToMemory())
 struct ImGuiSettingsHandler;        // Storage for one type registered in the .ini file
 struct ImGuiStackSizes;             // Storage of stack sizes for debugging/asserting
 struct ImGuiStyleMod;               // Stacked style modifier, backup of modified data so we can restore it
@@ -152,6 +165,7 @@ typedef int ImGuiDataAuthority;         // -> enum ImGuiDataAuthority_      // E
 typedef int ImGuiLayoutType;            // -> enum ImGuiLayoutType_         // Enum: Horizontal or vertical
 typedef int ImGuiActivateFlags;         // -> enum ImGuiActivateFlags_      // Flags: for navigation/focus function (will be for ActivateItem() later)
 typedef int ImGuiLayoutItemType;        // -> enum ImGuiLayoutItemType_    // Enum: Item or Spring
+typedef int ImGuiMemTag;                // -> enum ImGuiMemTag_             // Enum: Subsystem owning an allocation, for memory telemetry (see IMGUI_ENABLE_MEMORY_TAGS)
 typedef int ImGuiItemFlags;             // -> enum ImGuiItemFlags_          // Flags: for PushItemFlag()
 typedef int ImGuiItemStatusFlags;       // -> enum ImGuiItemStatusFlags_    // Flags: for DC.LastItemStatusFlags
 typedef int ImGuiOldColumnFlags;        // -> enum ImGuiOldColumnFlags_     // Flags: for BeginColumns()
@@ -173,8 +187,12 @@ typedef void (*ImGuiErrorLogCallback)(void* user_data, const char* fmt, ...);
 //-----------------------------------------------------------------------------
 
 #ifndef GImGui
+#ifdef IMGUI_ENABLE_THREAD_LOCAL_CONTEXT
+extern thread_local ImGuiContext* GImGui;   // Current implicit context pointer, one per thread (thread_local variables cannot be exported from a DLL)
+#else
 extern IMGUI_API ImGuiContext* GImGui;  // Current implicit context pointer
 #endif
+#endif
 
 //-------------------------------------------------------------------------
 // [SECTION] STB libraries includes
@@ -318,6 +336,9 @@ static inline ImGuiID   ImHash(const void* data, int size, ImU32 seed = 0) { ret
 static inline void      ImQsort(void* base, size_t count, size_t size_of_element, int(IMGUI_CDECL *compare_func)(void const*, void const*)) { if (count > 1) qsort(base, count, size_of_element, compare_func); }
 #endif
 
+// Helpers: Memory
+template<typename T> static inline size_t ImVectorCapacityInBytes(const ImVector<T>& v) { return (size_t)v.Capacity * sizeof(T); }
+
 // Helpers: Color Blending
 IMGUI_API ImU32         ImAlphaBlendColors(ImU32 col_a, ImU32 col_b);
 
@@ -401,6 +422,14 @@ IMGUI_API ImU64             ImFileWrite(const void* data, ImU64 size, ImU64 coun
 #define IMGUI_DISABLE_TTY_FUNCTIONS // Can't use stdout, fflush if we are not using default file functions
 #endif
 IMGUI_API void*             ImFileLoadToMemory(const char* filename, const char* mode, size_t* out_file_size = NULL, int padding_bytes = 0);
+IMGUI_API bool              ImFileSaveFromMemoryAtomic(const char* filename, const char* mode, const void* data, size_t data_size); // Write to a temporary file then rename it over 'filename'
+IMGUI_API ImGuiFileWriter*  ImFileWriterCreate();
+IMGUI_API void              ImFileWriterDestroy(ImGuiFileWriter* writer);                                                   // Finish pending write, join thread
+IMGUI_API void              ImFileWriterSave(ImGuiFileWriter* writer, const char* filename, const char* mode, const void* data, size_t data_size); // Queue a copy of 'data' (a newer request replaces a pending one)
+IMGUI_API void              ImFileWriterFlush(ImGuiFileWriter* writer);                                                     // Block until queued data is written
+IMGUI_API ImGuiFileStream*  ImFileStreamCreate(ImFileHandle file);                                                          // Take ownership of an open file
+IMGUI_API void              ImFileStreamWrite(ImGuiFileStream* stream, const void* data, size_t data_size);                 // Copy 'data' into the ring of chunks, may block if all of them are waiting to be written
+IMGUI_API bool              ImFileStreamClose(ImGuiFileStream* stream);                                                     // Write pending data, close the file, return false if any write failed
 
 // Helpers: Maths
 IM_MSVC_RUNTIME_CHECKS_OFF
@@ -535,6 +564,8 @@ struct IMGUI_API ImRect
 IM_MSVC_RUNTIME_CHECKS_RESTORE
 
 // Helper: ImBitArray
+inline size_t   ImBitArrayGetStorageSizeInBytes(int bitcount)   { return (size_t)((bitcount + 31) >> 5) << 2; }
+inline void     ImBitArrayClearAllBits(ImU32* arr, int bitcount){ memset(arr, 0, ImBitArrayGetStorageSizeInBytes(bitcount)); }
 inline bool     ImBitArrayTestBit(const ImU32* arr, int n)      { ImU32 mask = (ImU32)1 << (n & 31); return (arr[n >> 5] & mask) != 0; }
 inline void     ImBitArrayClearBit(ImU32* arr, int n)           { ImU32 mask = (ImU32)1 << (n & 31); arr[n >> 5] &= ~mask; }
 inline void     ImBitArraySetBit(ImU32* arr, int n)             { ImU32 mask = (ImU32)1 << (n & 31); arr[n >> 5] |= mask; }
@@ -551,6 +582,8 @@ inline void     ImBitArraySetBitRange(ImU32* arr, int n, int n2) // Works on ran
     }
 }
 
+typedef ImU32* ImBitArrayPtr; // Name for use in structs
+
 // Helper: ImBitArray class (wrapper over ImBitArray functions)
 // Store 1-bit per value.
 template<int BITCOUNT, int OFFSET = 0>
@@ -690,6 +723,43 @@ struct ImChunkStream
 
 };
 
+// Helper: ImGuiFrameArena
+// Frame-scoped linear allocator for transient data, owned by ImGuiContext and reset by NewFrame(). Use via ImGui::MemAllocFrame().
+// - Allocations are valid until the next NewFrame(). There is no individual free.
+// - Blocks are kept between frames. When a frame needed more than one block, they are coalesced into a single block on Reset(),
+//   so a steady-state frame makes no call to the allocator.
+// - Allocations larger than IMGUI_FRAME_ARENA_LARGE_ALLOC_SIZE (e.g. pasting a huge clipboard) bypass the blocks: they are
+//   allocated individually and freed on Reset(), so they don't stay pinned in the arena capacity.
+// - When the blocks stayed mostly unused for IMGUI_FRAME_ARENA_SHRINK_FRAMES frames, they are shrunk on Reset().
+//   CompactMemory() frees everything: right away when called outside of a frame, otherwise on the next Reset() (via ReleasePending).
+#define IMGUI_FRAME_ARENA_MIN_BLOCK_SIZE    (16 * 1024)
+#define IMGUI_FRAME_ARENA_LARGE_ALLOC_SIZE  (256 * 1024)
+#define IMGUI_FRAME_ARENA_SHRINK_FRAMES     60
+struct ImGuiFrameArenaBlock
+{
+    char*           Data;
+    size_t          Size;
+};
+
+struct IMGUI_API ImGuiFrameArena
+{
+    ImVector<ImGuiFrameArenaBlock> Blocks;  // Last block is the current one
+    ImVector<void*> LargeAllocs;            // Allocations > IMGUI_FRAME_ARENA_LARGE_ALLOC_SIZE made this frame
+    size_t          CurrOff;                // Offset in current block
+    size_t          BlocksUsedBytes;        // Bytes allocated from blocks this frame
+    size_t          UsedBytes;              // Bytes allocated this frame, including large allocations (for display purpose)
+    size_t          UsedBytesLastFrame;     // Bytes allocated during the previous frame (for display purpose)
+    int             UnderusedFrames;        // Number of consecutive frames which used less than a quarter of the blocks capacity
+    bool            ReleasePending;         // Free all memory on next Reset()
+
+    ImGuiFrameArena()   { CurrOff = BlocksUsedBytes = UsedBytes = UsedBytesLastFrame = 0; UnderusedFrames = 0; ReleasePending = false; }
+    ~ImGuiFrameArena()  { Clear(); }
+    void*           Alloc(size_t size);
+    void            Reset();
+    void            Clear();
+    size_t          GetCapacityInBytes() const { size_t sz = 0; for (int n = 0; n < Blocks.Size; n++) sz += Blocks[n].Size; return sz; }
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImDrawList support
 //-----------------------------------------------------------------------------
@@ -1019,6 +1089,7 @@ struct IMGUI_API ImGuiInputTextState
     ImVector<ImWchar>       TextW;                  // edit buffer, we need to persist but can't guarantee the persistence of the user-provided buffer. so we copy into own buffer.
     ImVector<char>          TextA;                  // temporary UTF8 buffer for callbacks and other operations. this is not updated in every code-path! size=capacity.
     ImVector<char>          InitialTextA;           // backup of end-user buffer at the time of focus (in UTF-8, unaltered)
+    ImGuiTextRope*          Rope;                   // end-user text storage edited in place, when using InputTextMultiline() with a ImGuiTextRope. TextW is then only used to measure one line at a time.
     bool                    TextAIsValid;           // temporary UTF8 buffer is not initially valid before we make the widget active (until then we pull the data from user argument)
     int                     BufCapacityA;           // end-user buffer capacity
     float                   ScrollX;                // horizontal scrolling/offset
@@ -1160,6 +1231,51 @@ struct ImGuiWindowStackData
     ImGuiWindow*            Window;
     ImGuiLastItemData       ParentLastItemDataBackup;
     ImGuiStackSizes         StackSizesOnBegin;      // Store size of various stacks for asserting
+#ifdef IMGUI_ENABLE_PROFILER
+    ImU64                   ProfilerZone;           // Zone opened by Begin() and closed by End()
+#endif
+};
+
+// Spatial hash of windows outer rectangles (g.WindowsHoverGrid), so FindHoveredWindow() only tests windows near the mouse.
+// Cells are IMGUI_WINDOW_HOVER_GRID_CELL_SIZE pixels wide in absolute coordinates, shared by all viewports.
+// A window is re-registered by Begin() only when the range of cells covered by its OuterRectClipped changes.
+// Windows covering too many cells (e.g. fullscreen windows) go to LargeWindows[] and are always tested.
+#ifndef IMGUI_WINDOW_HOVER_GRID_CELL_SIZE
+#define IMGUI_WINDOW_HOVER_GRID_CELL_SIZE       128.0f
+#endif
+#define IMGUI_WINDOW_HOVER_GRID_MAX_CELLS       128     // Windows covering more cells are added to LargeWindows[]
+
+struct ImGuiWindowHoverGridNode
+{
+    ImGuiWindow*            Window;
+    int                     Next;                   // Next node in same cell, or in free list. -1 if none.
+};
+
+struct ImGuiWindowHoverGrid
+{
+    ImGuiStorage            Cells;                  // Cell key -> index of first node in Nodes[], -1 if empty
+    ImVector<ImGuiWindowHoverGridNode> Nodes;
+    int                     FreeNodes;              // First unused node in Nodes[], -1 if none
+    ImVector<ImGuiWindow*>  LargeWindows;
+
+    ImGuiWindowHoverGrid()  { FreeNodes = -1; }
+    void                    Clear()                 { Cells.Clear(); Nodes.clear(); FreeNodes = -1; LargeWindows.clear(); }
+};
+
+// Window or table which transient buffers may be freed to honor io.ConfigMemoryCompactBudget
+enum ImGuiGcCandidateType
+{
+    ImGuiGcCandidateType_Window,
+    ImGuiGcCandidateType_Table,
+    ImGuiGcCandidateType_TableTempData
+};
+
+struct ImGuiGcCandidate
+{
+    ImGuiGcCandidateType    Type;
+    int                     Index;                  // Index in g.Windows[], g.Tables or g.TablesTempData[] depending on Type
+    float                   LastTimeActive;
+    size_t                  Bytes;
 };
 
 struct ImGuiShrinkWidthItem
@@ -1278,10 +1394,12 @@ struct ImGuiListClipperData
     float                           LossynessOffset;
     int                             StepNo;
     int                             ItemsFrozen;
+    int                             MeasureItem;            // With ImGuiListClipperHeights: item displayed by the last step, measured by the next one (or -1)
+    float                           MeasurePosY;            // With ImGuiListClipperHeights: cursor position before MeasureItem
     ImVector<ImGuiListClipperRange> Ranges;
 
     ImGuiListClipperData()          { memset(this, 0, sizeof(*this)); }
-    void                            Reset(ImGuiListClipper* clipper) { ListClipper = clipper; StepNo = ItemsFrozen = 0; Ranges.resize(0); }
+    void                            Reset(ImGuiListClipper* clipper) { ListClipper = clipper; StepNo = ItemsFrozen = 0; MeasureItem = -1; MeasurePosY = 0.0f; Ranges.resize(0); }
 };
 
 //-----------------------------------------------------------------------------
@@ -1344,7 +1462,8 @@ enum ImGuiNavMoveFlags_
     ImGuiNavMoveFlags_FocusApi              = 1 << 9,
     ImGuiNavMoveFlags_Tabbing               = 1 << 10,  // == Focus + Activate if item is Inputable + DontChangeNavHighlight
     ImGuiNavMoveFlags_Activate              = 1 << 11,
-    ImGuiNavMoveFlags_DontSetNavHighlight   = 1 << 12   // Do not alter the visible state of keyboard vs mouse nav highlight
+    ImGuiNavMoveFlags_DontSetNavHighlight   = 1 << 12,  // Do not alter the visible state of keyboard vs mouse nav highlight
+    ImGuiNavMoveFlags_NoPruning             = 1 << 13   // Score every item (set when a request is redone because its pruning bound turned out to be invalid, see NavEndFrame())
 };
 
 enum ImGuiNavLayer
@@ -1369,6 +1488,12 @@ struct ImGuiNavItemData
     void Clear()        { Window = NULL; ID = FocusScopeId = 0; InFlags = 0; DistBox = DistCenter = DistAxial = FLT_MAX; }
 };
 
+struct ImGuiNavIndexItem
+{
+    ImGuiID             ID;
+    ImRect              RectRel;        // Item nav rectangle in window relative space
+};
+
 // sizeof() == 48
 struct ImGuiLayoutItem
 {
@@ -1704,11 +1829,46 @@ struct ImGuiWindowSettings
     short       DockOrder;      // Order of the last time the window was visible within its DockNode. This is used to reorder windows that are reappearing on the same frame. Same value between windows that were active and windows that were none are possible.
     bool        Collapsed;
     bool        WantApply;      // Set when loaded from .ini data (to enable merging/loading .ini data into an already running context)
+    int         IniOffset;      // Location of this entry in the last .ini data written (see WriteIniSettingsEntryFromCache())
+    int         IniSize;        // Size of this entry in the last .ini data written, 0 when modified since and needing to be serialized again
 
     ImGuiWindowSettings()       { memset(this, 0, sizeof(*this)); DockOrder = -1; }
     char* GetName()             { return (char*)(this + 1); }
 };
 
+// Helpers to write/read binary settings data (see SaveBinarySettingsToMemory()).
+// Values are stored in native byte order and without alignment, so data can be read in place (e.g. from a memory-mapped file).
+struct ImGuiSettingsBinaryWriter
+{
+    ImVector<char>* Buf;
+
+    ImGuiSettingsBinaryWriter(ImVector<char>* buf)  { Buf = buf; }
+    void        WriteBytes(const void* src, size_t size)    { const int pos = Buf->Size; Buf->resize(pos + (int)size); memcpy(Buf->Data + pos, src, size); }
+    void        WriteU8(ImU8 v)                             { WriteBytes(&v, sizeof(v)); }
+    void        WriteS16(ImS16 v)                           { WriteBytes(&v, sizeof(v)); }
+    void        WriteU32(ImU32 v)                           { WriteBytes(&v, sizeof(v)); }
+    void        WriteFloat(float v)                         { WriteBytes(&v, sizeof(v)); }
+    void        WriteVec2ih(const ImVec2ih& v)              { WriteS16(v.x); WriteS16(v.y); }
+    void        WriteString(const char* s)                  { const ImU32 size = (ImU32)strlen(s) + 1; WriteU32(size); WriteBytes(s, size); } // Stored with zero-terminator
+};
+
+struct ImGuiSettingsBinaryReader
+{
+    const char* Data;
+    const char* DataEnd;
+    bool        Error;                                      // Set when reading past the end of data (or by a handler on invalid data), after which all reads return zero
+
+    ImGuiSettingsBinaryReader(const char* data, const char* data_end) { Data = data; DataEnd = data_end; Error = false; }
+    bool        HasData() const                             { return !Error && Data < DataEnd; }
+    void        ReadBytes(void* dst, size_t size)           { if (Error || (size_t)(DataEnd - Data) < size) { Error = true; memset(dst, 0, size); return; } memcpy(dst, Data, size); Data += size; }
+    ImU8        ReadU8()                                    { ImU8 v; ReadBytes(&v, sizeof(v)); return v; }
+    ImS16       ReadS16()                                   { ImS16 v; ReadBytes(&v, sizeof(v)); return v; }
+    ImU32       ReadU32()                                   { ImU32 v; ReadBytes(&v, sizeof(v)); return v; }
+    float       ReadFloat()                                 { float v; ReadBytes(&v, sizeof(v)); return v; }
+    ImVec2ih    ReadVec2ih()                                { const ImS16 x = ReadS16(); const ImS16 y = ReadS16(); return ImVec2ih(x, y); }
+    const char* ReadString()                                { const ImU32 size = ReadU32(); if (Error || size == 0 || (size_t)(DataEnd - Data) < size || Data[size - 1] != 0) { Error = true; return ""; } const char* s = Data; Data += size; return s; } // Points into data
+};
+
 struct ImGuiSettingsHandler
 {
     const char* TypeName;       // Short description stored in .ini file. Disallowed characters: '[' ']'
@@ -1719,6 +1879,8 @@ struct ImGuiSettingsHandler
     void        (*ReadLineFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, void* entry, const char* line); // Read: Called for every line of text within an ini entry
     void        (*ApplyAllFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler);                                // Read: Called after reading (in registration order)
     void        (*WriteAllFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* out_buf);      // Write: Output every entries into 'out_buf'
+    void        (*ReadAllBinaryFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiSettingsBinaryReader* reader); // Read binary (optional): Parse every entries written by WriteAllBinaryFn (called between ReadInitFn and ApplyAllFn)
+    void        (*WriteAllBinaryFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiSettingsBinaryWriter* writer); // Write binary (optional): Output every entries. Handlers without it are stored as .ini text in binary settings data
     void*       UserData;
 
     ImGuiSettingsHandler() { memset(this, 0, sizeof(*this)); }
@@ -1737,6 +1899,7 @@ struct ImGuiMetricsConfig
     bool        ShowDrawCmdMesh;
     bool        ShowDrawCmdBoundingBoxes;
     bool        ShowDockingNodes;
+    bool        ShowDockingRootNodesOnly;
     int         ShowWindowsRectsType;
     int         ShowTablesRectsType;
 
@@ -1749,11 +1912,100 @@ struct ImGuiMetricsConfig
         ShowDrawCmdMesh = true;
         ShowDrawCmdBoundingBoxes = true;
         ShowDockingNodes = false;
+        ShowDockingRootNodesOnly = true;
         ShowWindowsRectsType = -1;
         ShowTablesRectsType = -1;
     }
 };
 
+// Subsystem tags for memory telemetry. Allocations made by MemAlloc() are attributed to the current tag of the context.
+// Requires IMGUI_ENABLE_MEMORY_TAGS (which adds a small header to every allocation), otherwise stats are left to zero.
+// Allocations made outside of any tagged scope (including all user code) are attributed to ImGuiMemTag_Misc.
+enum ImGuiMemTag_
+{
+    ImGuiMemTag_Misc,
+    ImGuiMemTag_Windows,
+    ImGuiMemTag_DrawList,
+    ImGuiMemTag_Fonts,
+    ImGuiMemTag_Tables,
+    ImGuiMemTag_Docking,
+    ImGuiMemTag_Viewports,
+    ImGuiMemTag_Storage,
+    ImGuiMemTag_Settings,
+    ImGuiMemTag_InputText,
+    ImGuiMemTag_FrameArena,
+    ImGuiMemTag_COUNT
+};
+
+struct ImGuiMemTagStats
+{
+    ImS64                   LiveBytes;                  // Bytes currently allocated
+    ImS64                   PeakBytes;                  // Highest value of LiveBytes
+    int                     LiveAllocs;                 // Number of allocations currently alive
+    int                     AllocsThisFrame;            // Number of calls to MemAlloc() since last NewFrame()
+    int                     AllocsLastFrame;            // Number of calls to MemAlloc() during the previous frame
+
+    ImGuiMemTagStats()      { memset(this, 0, sizeof(*this)); }
+};
+
+// Per-context memory stats. Allocated separately from the context and reference counted by the context and by each tagged allocation,
+// so memory freed after its owning context was destroyed (e.g. a shared font atlas) or while another context is current is still accounted correctly.
+// The reference count is not atomic: freeing memory owned by a context which is concurrently used by another thread is not supported.
+struct ImGuiMemTagContextStats
+{
+    int                     RefCount;
+    ImGuiMemTagStats        Tags[ImGuiMemTag_COUNT];
+};
+
+#ifdef IMGUI_ENABLE_PROFILER
+#ifndef IMGUI_PROFILER_MAX_ZONES
+#define IMGUI_PROFILER_MAX_ZONES    (64 * 1024)                 // Capacity of the ring buffer of recorded zones
+#endif
+#ifndef IMGUI_PROFILER_STATS_PRUNE_FRAMES
+#define IMGUI_PROFILER_STATS_PRUNE_FRAMES   600                 // Stats of a zone are discarded after that many frames without being recorded
+#endif
+
+// Zone recorded by IMGUI_PROFILE_SCOPE() or ProfilerBeginZone()/ProfilerEndZone()
+struct ImGuiProfilerZone
+{
+    const char*             Name;                       // Static string
+    ImGuiID                 WindowID;                   // Optional window the zone relates to (e.g. Begin/End of a window), displayed by name
+    ImU64                   StartNs;
+    ImU64                   EndNs;                      // 0 while the zone is open
+    int                     FrameCount;
+    int                     Depth;
+};
+
+// Timings per (Name, WindowID) pair over the last frame, for display in the Metrics window
+struct ImGuiProfilerZoneStats
+{
+    const char*             Name;
+    ImGuiID                 WindowID;
+    int                     Depth;
+    int                     Calls;                      // Calls during last frame
+    float                   TimeMs;                     // Total time during last frame
+    float                   TimeMsAvg;                  // Moving average of TimeMs
+    float                   TimeMsMax;                  // Highest TimeMs since last reset
+    int                     LastFrameActive;            // Last frame the zone was recorded
+};
+
+// Per-context profiler. A context is only used by one thread at a time so recording doesn't need locks.
+struct ImGuiProfiler
+{
+    ImVector<ImGuiProfilerZone> Zones;                  // Ring buffer of IMGUI_PROFILER_MAX_ZONES zones, allocated on first use. Zone N is stored in Zones[N % IMGUI_PROFILER_MAX_ZONES].
+    ImU64                   ZonesCount;                 // Total number of zones recorded
+    ImU64                   ZonesAggregated;            // Zones before this one have been accumulated into Stats[]
+    int                     Depth;
+    bool                    Paused;
+    ImVector<ImGuiProfilerZoneStats> Stats;
+    ImGuiStorage            StatsMap;                   // Hash of (Name, WindowID) -> index into Stats[]
+    ImU64                   TicksPerSecond;             // Win32 QueryPerformanceFrequency(), queried on first use
+    char                    ExportFilename[256];        // Used by the Export button of the Metrics window
+
+    ImGuiProfiler()         { ZonesCount = ZonesAggregated = 0; Depth = 0; Paused = false; TicksPerSecond = 0; ImStrncpy(ExportFilename, "trace.json", IM_ARRAYSIZE(ExportFilename)); }
+};
+#endif // #ifdef IMGUI_ENABLE_PROFILER
+
 struct ImGuiStackLevelInfo
 {
     ImGuiID                 ID;
@@ -1821,16 +2073,20 @@ struct ImGuiContext
     bool                    WithinFrameScopeWithImplicitWindow; // Set by NewFrame(), cleared by EndFrame() when the implicit debug window has been pushed
     bool                    WithinEndChild;                     // Set within EndChild()
     bool                    GcCompactAll;                       // Request full GC
+    ImVector<ImGuiGcCandidate> GcCandidates;                    // Temporary storage for budget-based GC, see GcUpdateTransientBuffers()
     bool                    TestEngineHookItems;                // Will call test engine hooks: ImGuiTestEngineHook_ItemAdd(), ImGuiTestEngineHook_ItemInfo(), ImGuiTestEngineHook_Log()
     void*                   TestEngine;                         // Test engine user data
 
     // Windows state
     ImVector<ImGuiWindow*>  Windows;                            // Windows, sorted in display order, back to front
     ImVector<ImGuiWindow*>  WindowsFocusOrder;                  // Root windows, sorted in focus order, back to front.
-    ImVector<ImGuiWindow*>  WindowsTempSortBuffer;              // Temporary buffer used in EndFrame() to reorder windows so parents are kept before their child
+    ImVector<ImGuiWindow*>  WindowsTempSortBuffer;              // Temporary buffer used in EndFrame() to reorder windows so parents are kept before their child (only when WindowsDisplayOrderDirty is set)
     ImVector<ImGuiWindowStackData> CurrentWindowStack;
     ImGuiStorage            WindowsById;                        // Map window's ImGuiID to ImGuiWindow*
     int                     WindowsActiveCount;                 // Number of unique windows submitted by frame
+    int                     WindowsWasActiveCount;              // Number of windows which were active last frame
+    ImGuiWindowHoverGrid    WindowsHoverGrid;                   // Spatial hash of windows rectangles, for FindHoveredWindow()
+    bool                    WindowsDisplayOrderDirty;           // Set when Windows[] needs to be sorted again in EndFrame(): a window was created, brought to front/back, (de)activated, or changed parent/order within parent
     ImVec2                  WindowsHoverPadding;                // Padding around resizable windows for which hovering on counts as hovering the window == ImMax(style.TouchExtraPadding, WINDOWS_HOVER_PADDING)
     ImGuiWindow*            CurrentWindow;                      // Window being drawn into
     ImGuiWindow*            HoveredWindow;                      // Window the mouse is hovering. Will typically catch mouse inputs.
@@ -1941,6 +2197,17 @@ struct ImGuiContext
     ImRect                  NavScoringRect;                     // Rectangle used for scoring, in screen space. Based of window->NavRectRel[], modified for directional navigation scoring.
     ImRect                  NavScoringNoClipRect;               // Some nav operations (such as PageUp/PageDown) enforce a region which clipper will attempt to always keep submitted
     int                     NavScoringDebugCount;               // Metrics for debugging
+    bool                    NavMoveIndexEnabled;                // Move request may be pruned and is recording NavMoveIndexItemsNext[] (directional move in main layer)
+    bool                    NavMoveIndexBoundPending;           // NavMoveIndexBound will be computed when the first item of NavWindow is submitted
+    float                   NavMoveIndexBound;                  // Best DistBox among NavMoveIndexItems[] around NavId, for the current request. Items which can't reach min(NavMoveIndexBound, NavMoveResultLocal.DistBox) are not scored.
+    ImRect                  NavMoveIndexNavRectRel;             // Backup of NavWindow->NavRectRel[] when the request was submitted, restored if it needs to be redone
+    ImRect                  NavMovePruneRect;                   // Items of NavWindow which (clamped) nav rectangle doesn't overlap this can't beat the current best candidate
+    ImGuiWindow*            NavMoveIndexWindow;                 // Window NavMoveIndexItems[] was recorded in
+    ImGuiWindow*            NavMoveIndexWindowNext;
+    int                     NavMoveIndexNavIdPos;               // Position of NavId in NavMoveIndexItems[] (hint)
+    int                     NavMoveIndexResultPos;              // Position of NavMoveResultLocal in NavMoveIndexItemsNext[]
+    ImVector<ImGuiNavIndexItem> NavMoveIndexItems;              // Items of NavWindow recorded during the previous move request, in submission order
+    ImVector<ImGuiNavIndexItem> NavMoveIndexItemsNext;          // Items of NavWindow being recorded during the current move request
     int                     NavTabbingDir;                      // Generally -1 or +1, 0 when tabbing without a nav id
     int                     NavTabbingCounter;                  // >0 when counting items for tabbing
     ImGuiNavItemData        NavMoveResultLocal;                 // Best move request candidate within NavWindow
@@ -1990,6 +2257,7 @@ struct ImGuiContext
     ImPool<ImGuiTable>              Tables;                     // Persistent table data
     ImVector<float>                 TablesLastTimeActive;       // Last used timestamp of each tables (SOA, for efficient GC)
     ImVector<ImDrawChannel>         DrawChannelsTempMergeBuffer;
+    ImVector<ImU32>                 DrawChannelsTempMergeMasks; // Channel bit masks used by TableMergeDrawChannels()
 
     // Tab bars
     ImGuiTabBar*                    CurrentTabBar;
@@ -2018,6 +2286,7 @@ struct ImGuiContext
     short                   DisabledStackSize;
     short                   TooltipOverrideCount;
     float                   TooltipSlowDelay;                   // Time before slow tooltips appears (FIXME: This is temporary until we merge in tooltip timer+priority work)
+    float                   RedrawRequestDelay;                 // Lowest delay passed to RequestRedraw() since last EndFrame(), FLT_MAX if none
     ImVector<char>          ClipboardHandlerData;               // If no custom clipboard handler is defined
     ImVector<ImGuiID>       MenusIdSubmittedThisFrame;          // A list of menu IDs that were rendered at least once
 
@@ -2035,6 +2304,9 @@ struct ImGuiContext
     bool                    SettingsLoaded;
     float                   SettingsDirtyTimer;                 // Save .ini Settings to memory when time reaches zero
     ImGuiTextBuffer         SettingsIniData;                    // In memory .ini settings
+    ImVector<char>          SettingsBinaryData;                 // In memory binary settings (see SaveBinarySettingsToMemory())
+    ImGuiTextBuffer         SettingsIniDataPrev;                // Copy of last .ini data written by SaveIniSettingsToMemory(), unmodified entries are copied from it instead of being serialized again
+    ImGuiFileWriter*        SettingsIniWriter;                  // Writer used by periodic saving (writes from a background thread with IMGUI_ENABLE_FILE_WRITER_THREAD)
     ImVector<ImGuiSettingsHandler>      SettingsHandlers;       // List of .ini settings handlers
     ImChunkStream<ImGuiWindowSettings>  SettingsWindows;        // ImGuiWindow .ini settings entries
     ImChunkStream<ImGuiTableSettings>   SettingsTables;         // ImGuiTable .ini settings entries
@@ -2044,7 +2316,8 @@ struct ImGuiContext
     // Capture/Logging
     bool                    LogEnabled;                         // Currently capturing
     ImGuiLogType            LogType;                            // Capture target
-    ImFileHandle            LogFile;                            // If != NULL log to stdout/ file
+    ImFileHandle            LogFile;                            // If != NULL log to stdout
+    ImGuiFileStream*        LogFileStream;                      // If != NULL log to file (buffered, see ImFileStreamCreate())
     ImGuiTextBuffer         LogBuffer;                          // Accumulation buffer when log to clipboard. This is pointer so our GImGui static constructor doesn't call heap allocators.
     const char*             LogNextPrefix;
     const char*             LogNextSuffix;
@@ -2069,6 +2342,15 @@ struct ImGuiContext
     int                     WantCaptureKeyboardNextFrame;
     int                     WantTextInputNextFrame;
     char                    TempBuffer[1024 * 3 + 1];           // Temporary text buffer
+    ImGuiFrameArena         FrameArena;                         // Transient allocations, reset every frame. See MemAllocFrame().
+
+    // Memory telemetry (IMGUI_ENABLE_MEMORY_TAGS)
+    ImGuiMemTag             MemTagCurrent;                      // Tag given to new allocations. Set with IMGUI_MEM_TAG_SCOPE() or SetMemTag().
+    ImGuiMemTagContextStats*MemTagStats;                        // Owned by context and referenced by each allocation made while this context was current. See ImGuiMemTagContextStats.
+
+#ifdef IMGUI_ENABLE_PROFILER
+    ImGuiProfiler           Profiler;
+#endif
 
     ImGuiContext(ImFontAtlas* shared_font_atlas)
     {
@@ -2087,6 +2369,8 @@ struct ImGuiContext
         TestEngine = NULL;
 
         WindowsActiveCount = 0;
+        WindowsWasActiveCount = 0;
+        WindowsDisplayOrderDirty = false;
         CurrentWindow = NULL;
         HoveredWindow = NULL;
         HoveredWindowUnderMovingWindow = NULL;
@@ -2157,6 +2441,10 @@ struct ImGuiContext
         NavMoveKeyMods = ImGuiKeyModFlags_None;
         NavMoveDir = NavMoveDirForDebug = NavMoveClipDir = ImGuiDir_None;
         NavScoringDebugCount = 0;
+        NavMoveIndexEnabled = NavMoveIndexBoundPending = false;
+        NavMoveIndexBound = FLT_MAX;
+        NavMoveIndexWindow = NavMoveIndexWindowNext = NULL;
+        NavMoveIndexNavIdPos = NavMoveIndexResultPos = -1;
         NavTabbingDir = 0;
         NavTabbingCounter = 0;
 
@@ -2199,6 +2487,7 @@ struct ImGuiContext
         ScrollbarClickDeltaToGrabCenter = 0.0f;
         TooltipOverrideCount = 0;
         TooltipSlowDelay = 0.50f;
+        RedrawRequestDelay = FLT_MAX;
 
         PlatformImeData.InputPos = ImVec2(0.0f, 0.0f);
         PlatformImeDataPrev.InputPos = ImVec2(-1.0f, -1.0f); // Different to ensure initial submission
@@ -2207,12 +2496,14 @@ struct ImGuiContext
 
         SettingsLoaded = false;
         SettingsDirtyTimer = 0.0f;
+        SettingsIniWriter = NULL;
         HookIdNext = 0;
 
         LogEnabled = false;
         LogType = ImGuiLogType_None;
         LogNextPrefix = LogNextSuffix = NULL;
         LogFile = NULL;
+        LogFileStream = NULL;
         LogLinePosY = FLT_MAX;
         LogLineFirstItem = false;
         LogDepthRef = 0;
@@ -2226,9 +2517,25 @@ struct ImGuiContext
         FramerateSecPerFrameAccum = 0.0f;
         WantCaptureMouseNextFrame = WantCaptureKeyboardNextFrame = WantTextInputNextFrame = -1;
         memset(TempBuffer, 0, sizeof(TempBuffer));
+        MemTagCurrent = ImGuiMemTag_Misc;
+        MemTagStats = NULL;
     }
 };
 
+// Helper: Attribute allocations made until the end of the current scope to a subsystem (see ImGuiMemTag_)
+#ifdef IMGUI_ENABLE_MEMORY_TAGS
+struct ImGuiMemTagScope
+{
+    ImGuiContext*           Ctx;
+    ImGuiMemTag             BackupTag;
+    ImGuiMemTagScope(ImGuiMemTag tag)   { Ctx = GImGui; if (Ctx) { BackupTag = Ctx->MemTagCurrent; Ctx->MemTagCurrent = tag; } else { BackupTag = ImGuiMemTag_Misc; } }
+    ~ImGuiMemTagScope()                 { if (Ctx) Ctx->MemTagCurrent = BackupTag; }
+};
+#define IMGUI_MEM_TAG_SCOPE(_TAG)       ImGuiMemTagScope im_mem_tag_scope(_TAG)
+#else
+#define IMGUI_MEM_TAG_SCOPE(_TAG)       do { } while (0)
+#endif
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImGuiWindowTempData, ImGuiWindow
 //-----------------------------------------------------------------------------
@@ -2366,6 +2673,10 @@ struct IMGUI_API ImGuiWindow
     ImRect                  ContentRegionRect;                  // FIXME: This is currently confusing/misleading. It is essentially WorkRect but not handling of scrolling. We currently rely on it as right/bottom aligned sizing operation need some size to rely on.
     ImVec2ih                HitTestHoleSize;                    // Define an optional rectangular hole where mouse will pass-through the window.
     ImVec2ih                HitTestHoleOffset;
+    ImVec2ih                HoverGridCellMin;                   // Range of cells of g.WindowsHoverGrid we are registered in (inclusive)
+    ImVec2ih                HoverGridCellMax;
+    ImS8                    HoverGridState;                     // 0: not registered in g.WindowsHoverGrid, 1: registered in cells, 2: registered in LargeWindows[]
+    int                     DisplayIndex;                       // Index in g.Windows[], only valid when !g.WindowsDisplayOrderDirty
 
     int                     LastFrameActive;                    // Last frame number the window was Active.
     int                     LastFrameJustFocused;               // Last frame number the window was made Focused.
@@ -2521,12 +2832,12 @@ struct IMGUI_API ImGuiTabBar
 //-----------------------------------------------------------------------------
 
 #define IM_COL32_DISABLE                IM_COL32(0,0,0,1)   // Special sentinel code which cannot be used as a regular color.
-#define IMGUI_TABLE_MAX_COLUMNS         64                  // sizeof(ImU64) * 8. This is solely because we frequently encode columns set in a ImU64.
-#define IMGUI_TABLE_MAX_DRAW_CHANNELS   (4 + 64 * 2)        // See TableSetupDrawChannels()
+#define IMGUI_TABLE_MAX_COLUMNS         2048                // May be further lifted (column sets are stored in bit arrays allocated along with columns)
+#define IMGUI_TABLE_MAX_DRAW_CHANNELS   (4 + IMGUI_TABLE_MAX_COLUMNS * 2)   // See TableSetupDrawChannels()
 
-// Our current column maximum is 64 but we may raise that in the future.
-typedef ImS8 ImGuiTableColumnIdx;
-typedef ImU8 ImGuiTableDrawChannelIdx;
+// Our current column maximum is 2048 but we may raise that in the future.
+typedef ImS16 ImGuiTableColumnIdx;
+typedef ImU16 ImGuiTableDrawChannelIdx;
 
 // [Internal] sizeof() ~ 104
 // We use the terminology "Enabled" to refer to a column that is not Hidden by user/api.
@@ -2536,6 +2847,7 @@ struct ImGuiTableColumn
 {
     ImGuiTableColumnFlags   Flags;                          // Flags after some patching (not directly same as provided by user). See ImGuiTableColumnFlags_
     float                   WidthGiven;                     // Final/actual width visible == (MaxX - MinX), locked in TableUpdateLayout(). May be > WidthRequest to honor minimum width, may be < WidthRequest to honor shrinking columns down in tight space.
+    float                   WidthGivenUnclamped;            // WidthGiven before clamping to the space available at the column position, reused when TableUpdateLayout() skips widths calculation
     float                   MinX;                           // Absolute positions
     float                   MaxX;
     float                   WidthRequest;                   // Master width absolute value when !(Flags & _WidthStretch). When Stretch this is derived every frame from StretchWeight in TableUpdateLayout()
@@ -2602,15 +2914,15 @@ struct IMGUI_API ImGuiTable
 {
     ImGuiID                     ID;
     ImGuiTableFlags             Flags;
-    void*                       RawData;                    // Single allocation to hold Columns[], DisplayOrderToIndex[] and RowCellData[]
+    void*                       RawData;                    // Single allocation to hold Columns[], DisplayOrderToIndex[], RowCellData[] and columns bit arrays
     ImGuiTableTempData*         TempData;                   // Transient data while table is active. Point within g.CurrentTableStack[]
     ImSpan<ImGuiTableColumn>    Columns;                    // Point within RawData[]
     ImSpan<ImGuiTableColumnIdx> DisplayOrderToIndex;        // Point within RawData[]. Store display order of columns (when not reordered, the values are 0...Count-1)
     ImSpan<ImGuiTableCellData>  RowCellData;                // Point within RawData[]. Store cells background requests for current row.
-    ImU64                       EnabledMaskByDisplayOrder;  // Column DisplayOrder -> IsEnabled map
-    ImU64                       EnabledMaskByIndex;         // Column Index -> IsEnabled map (== not hidden by user/api) in a format adequate for iterating column without touching cold data
-    ImU64                       VisibleMaskByIndex;         // Column Index -> IsVisibleX|IsVisibleY map (== not hidden by user/api && not hidden by scrolling/cliprect)
-    ImU64                       RequestOutputMaskByIndex;   // Column Index -> IsVisible || AutoFit (== expect user to submit items)
+    ImBitArrayPtr               EnabledMaskByDisplayOrder;  // Point within RawData[]. Column DisplayOrder -> IsEnabled map
+    ImBitArrayPtr               EnabledMaskByIndex;         // Point within RawData[]. Column Index -> IsEnabled map (== not hidden by user/api) in a format adequate for iterating column without touching cold data
+    ImBitArrayPtr               VisibleMaskByIndex;         // Point within RawData[]. Column Index -> IsVisibleX|IsVisibleY map (== not hidden by user/api && not hidden by scrolling/cliprect)
+    ImBitArrayPtr               RequestOutputMaskByIndex;   // Point within RawData[]. Column Index -> IsVisible || AutoFit (== expect user to submit items)
     ImGuiTableFlags             SettingsLoadedFlags;        // Which data were loaded from the .ini file (e.g. when order is not altered we won't save order)
     int                         SettingsOffset;             // Offset in g.SettingsTables
     int                         LastFrameActive;
@@ -2647,6 +2959,9 @@ struct IMGUI_API ImGuiTable
     float                       ResizedColumnNextWidth;
     float                       ResizeLockMinContentsX2;    // Lock minimum contents width while resizing down in order to not create feedback loops. But we allow growing the table.
     float                       RefScale;                   // Reference scale to be able to rescale columns on font/dpi changes.
+    ImGuiID                     LayoutWidthsHash;           // Hash of inputs of the last columns enabled state/widths calculation in TableUpdateLayout(), 0 if results can't be reused
+    int                         LayoutWidthsCalcCount;      // Number of widths calculations (for debug display)
+    int                         LayoutWidthsSkipCount;      // Number of widths calculations skipped because inputs were unchanged (for debug display)
     ImRect                      OuterRect;                  // Note: for non-scrolling table, OuterRect.Max.y is often FLT_MAX until EndTable(), unless a height has been specified in BeginTable().
     ImRect                      InnerRect;                  // InnerRect but without decoration. As with OuterRect, for non-scrolling tables, InnerRect.Max.y is
     ImRect                      WorkRect;
@@ -2666,6 +2981,7 @@ struct IMGUI_API ImGuiTable
     ImGuiTableColumnIdx         SortSpecsCount;
     ImGuiTableColumnIdx         ColumnsEnabledCount;        // Number of enabled columns (<= ColumnsCount)
     ImGuiTableColumnIdx         ColumnsEnabledFixedCount;   // Number of enabled columns (<= ColumnsCount)
+    ImGuiTableColumnIdx         ColumnsVisibleCount;        // Number of visible columns (<= ColumnsEnabledCount). Only those get their own draw channels.
     ImGuiTableColumnIdx         DeclColumnsCount;           // Count calls to TableSetupColumn()
     ImGuiTableColumnIdx         HoveredColumnBody;          // Index of column whose visible region is being hovered. Important: == ColumnsCount when hovering empty region after the right-most column!
     ImGuiTableColumnIdx         HoveredColumnBorder;        // Index of column whose right-border is being hovered (for resizing).
@@ -2697,6 +3013,7 @@ struct IMGUI_API ImGuiTable
     bool                        IsSettingsRequestLoad;
     bool                        IsSettingsDirty;            // Set when table settings have changed and needs to be reported into ImGuiTableSetttings data.
     bool                        IsDefaultDisplayOrder;      // Set when display order is unchanged from default (DisplayOrder contains 0...Count-1)
+    bool                        IsLayoutSortSpecsDirty;     // Set when the last widths calculation in TableUpdateLayout() marked sort specs dirty (re-applied when skipping it)
     bool                        IsResetAllRequest;
     bool                        IsResetDisplayOrderRequest;
     bool                        IsUnfrozenRows;             // Set when we got past the frozen row.
@@ -2715,6 +3032,7 @@ struct IMGUI_API ImGuiTableTempData
 {
     int                         TableIndex;                 // Index in g.Tables.Buf[] pool
     float                       LastTimeActive;             // Last timestamp this structure was used
+    int                         LastFrameActive;            // Last frame number this structure was used
 
     ImVec2                      UserOuterSize;              // outer_size.x passed to BeginTable()
     ImDrawListSplitter          DrawSplitter;
@@ -2728,7 +3046,7 @@ struct IMGUI_API ImGuiTableTempData
     float                       HostBackupItemWidth;        // Backup of OuterWindow->DC.ItemWidth at the end of BeginTable()
     int                         HostBackupItemWidthStackSize;//Backup of OuterWindow->DC.ItemWidthStack.Size at the end of BeginTable()
 
-    ImGuiTableTempData()        { memset(this, 0, sizeof(*this)); LastTimeActive = -1.0f; }
+    ImGuiTableTempData()        { memset(this, 0, sizeof(*this)); LastTimeActive = -1.0f; LastFrameActive = -1; }
 };
 
 // sizeof() ~ 12
@@ -2764,6 +3082,8 @@ struct ImGuiTableSettings
     ImGuiTableColumnIdx         ColumnsCount;
     ImGuiTableColumnIdx         ColumnsCountMax;        // Maximum number of columns this settings instance can store, we can recycle a settings instance with lower number of columns but not higher
     bool                        WantApply;              // Set when loaded from .ini data (to enable merging/loading .ini data into an already running context)
+    int                         IniOffset;              // Location of this entry in the last .ini data written (see WriteIniSettingsEntryFromCache())
+    int                         IniSize;                // Size of this entry in the last .ini data written, 0 when modified since and needing to be serialized again
 
     ImGuiTableSettings()        { memset(this, 0, sizeof(*this)); }
     ImGuiTableColumnSettings*   GetColumnSettings()     { return (ImGuiTableColumnSettings*)(this + 1); }
@@ -2776,6 +3096,14 @@ struct ImGuiTableSettings
 
 namespace ImGui
 {
+    // Memory
+    IMGUI_API void*         MemAllocFrame(size_t size);         // Allocate transient memory from the current context, valid until next NewFrame() or CompactMemory() call. Never free it.
+    IMGUI_API ImGuiMemTag   SetMemTag(ImGuiMemTag tag);         // Set tag given to new allocations, return previous tag. Prefer using IMGUI_MEM_TAG_SCOPE().
+    IMGUI_API const ImGuiMemTagStats* GetMemTagStats(ImGuiMemTag tag); // Stats are only updated with IMGUI_ENABLE_MEMORY_TAGS
+    IMGUI_API ImGuiMemTagContextStats* MemTagStatsCreate();    // Return a block with a reference count of 1
+    IMGUI_API void          MemTagStatsRelease(ImGuiMemTagContextStats* owner);
+    IMGUI_API const char*   GetMemTagName(ImGuiMemTag tag);
+
     // Windows
     // We should always have a CurrentWindow in the stack (there is an implicit "Debug" window)
     // If this ever crash because g.CurrentWindow is NULL it means that either
@@ -2846,6 +3174,8 @@ namespace ImGui
     IMGUI_API ImGuiWindowSettings*  FindWindowSettings(ImGuiID id);
     IMGUI_API ImGuiWindowSettings*  FindOrCreateWindowSettings(const char* name);
     IMGUI_API ImGuiSettingsHandler* FindSettingsHandler(const char* type_name);
+    IMGUI_API bool                  WriteIniSettingsEntryFromCache(ImGuiTextBuffer* buf, int* ini_offset, int* ini_size);
+    IMGUI_API void                  StoreIniSettingsEntryCache(ImGuiTextBuffer* buf, int entry_start, int* ini_offset, int* ini_size);
 
     // Scrolling
     IMGUI_API void          SetNextWindowScroll(const ImVec2& scroll); // Use -1.0f on one axis to leave as-is
@@ -3091,6 +3421,8 @@ namespace ImGui
     IMGUI_API void          TableRemove(ImGuiTable* table);
     IMGUI_API void          TableGcCompactTransientBuffers(ImGuiTable* table);
     IMGUI_API void          TableGcCompactTransientBuffers(ImGuiTableTempData* table);
+    IMGUI_API size_t        TableGcCalcTransientBuffersSize(ImGuiTable* table);
+    IMGUI_API size_t        TableGcCalcTransientBuffersSize(ImGuiTableTempData* table);
     IMGUI_API void          TableGcCompactSettings();
 
     // Tables: Settings
@@ -3193,7 +3525,7 @@ namespace ImGui
     IMGUI_API bool          DataTypeClamp(ImGuiDataType data_type, void* p_data, const void* p_min, const void* p_max);
 
     // InputText
-    IMGUI_API bool          InputTextEx(const char* label, const char* hint, char* buf, int buf_size, const ImVec2& size_arg, ImGuiInputTextFlags flags, ImGuiInputTextCallback callback = NULL, void* user_data = NULL);
+    IMGUI_API bool          InputTextEx(const char* label, const char* hint, char* buf, int buf_size, const ImVec2& size_arg, ImGuiInputTextFlags flags, ImGuiInputTextCallback callback = NULL, void* user_data = NULL, ImGuiTextRope* rope = NULL);
     IMGUI_API bool          TempInputText(const ImRect& bb, ImGuiID id, const char* label, char* buf, int buf_size, ImGuiInputTextFlags flags);
     IMGUI_API bool          TempInputScalar(const ImRect& bb, ImGuiID id, const char* label, ImGuiDataType data_type, void* p_data, const char* format, const void* p_clamp_min = NULL, const void* p_clamp_max = NULL);
     inline bool             TempInputIsActive(ImGuiID id)       { ImGuiContext& g = *GImGui; return (g.ActiveId == id && g.TempInputId == id); }
@@ -3215,6 +3547,8 @@ namespace ImGui
     IMGUI_API void          GcCompactTransientMiscBuffers();
     IMGUI_API void          GcCompactTransientWindowBuffers(ImGuiWindow* window);
     IMGUI_API void          GcAwakeTransientWindowBuffers(ImGuiWindow* window);
+    IMGUI_API size_t        GcCalcTransientWindowBuffersSize(ImGuiWindow* window);
+    IMGUI_API void          GcUpdateTransientBuffers();
 
     // Debug Tools
     IMGUI_API void          ErrorCheckEndFrameRecover(ImGuiErrorLogCallback log_callback, void* user_data = NULL);
@@ -3240,8 +3574,31 @@ namespace ImGui
     IMGUI_API void          DebugNodeViewport(ImGuiViewportP* viewport);
     IMGUI_API void          DebugRenderViewportThumbnail(ImDrawList* draw_list, ImGuiViewportP* viewport, const ImRect& bb);
 
+    // Profiler (IMGUI_ENABLE_PROFILER)
+#ifdef IMGUI_ENABLE_PROFILER
+    IMGUI_API ImU64         ProfilerBeginZone(const char* name, ImGuiID window_id = 0); // 'name' must be a static string. Return 0 if not recording.
+    IMGUI_API void          ProfilerEndZone(ImU64 zone);
+    IMGUI_API bool          ProfilerExportChromeTrace(const char* filename);             // Write recorded zones as Chrome trace JSON (chrome://tracing, Perfetto). Relative paths are relative to the working directory.
+    IMGUI_API void          DebugNodeProfiler(ImGuiProfiler* profiler);
+#endif
+
 } // namespace ImGui
 
+// Helper: Record a profiler zone until the end of the current scope. Compiles to nothing without IMGUI_ENABLE_PROFILER.
+#ifdef IMGUI_ENABLE_PROFILER
+struct ImGuiProfilerScope
+{
+    ImU64                   Zone;
+    ImGuiProfilerScope(const char* name, ImGuiID window_id = 0) { Zone = ImGui::ProfilerBeginZone(name, window_id); }
+    ~ImGuiProfilerScope()   { ImGui::ProfilerEndZone(Zone); }
+};
+#define IMGUI_PROFILE_SCOPE(_NAME)                      ImGuiProfilerScope im_profile_scope(_NAME)
+#define IMGUI_PROFILE_SCOPE_WINDOW(_NAME, _WINDOW_ID)   ImGuiProfilerScope im_profile_scope(_NAME, _WINDOW_ID)
+#else
+#define IMGUI_PROFILE_SCOPE(_NAME)                      do { } while (0)
+#define IMGUI_PROFILE_SCOPE_WINDOW(_NAME, _WINDOW_ID)   do { } while (0)
+#endif
+
 
 //-----------------------------------------------------------------------------
 // [SECTION] ImFontAtlas internal API
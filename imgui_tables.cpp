@@ -309,13 +309,14 @@ bool    ImGui::BeginTable(const char* str_id, int columns_count, ImGuiTableFlags
 
 bool    ImGui::BeginTableEx(const char* name, ImGuiID id, int columns_count, ImGuiTableFlags flags, const ImVec2& outer_size, float inner_width)
 {
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_Tables);
     ImGuiContext& g = *GImGui;
     ImGuiWindow* outer_window = GetCurrentWindow();
     if (outer_window->SkipItems) // Consistent with other tables + beneficial side effect that assert on miscalling EndTable() will be more visible.
         return false;
 
     // Sanity checks
-    IM_ASSERT(columns_count > 0 && columns_count <= IMGUI_TABLE_MAX_COLUMNS && "Only 1..64 columns allowed!");
+    IM_ASSERT(columns_count > 0 && columns_count <= IMGUI_TABLE_MAX_COLUMNS && "Only 1..IMGUI_TABLE_MAX_COLUMNS columns allowed!");
     if (flags & ImGuiTableFlags_ScrollX)
         IM_ASSERT(inner_width >= 0.0f);
 
@@ -472,6 +473,7 @@ bool    ImGui::BeginTableEx(const char* name, ImGuiID id, int columns_count, ImG
         g.TablesLastTimeActive.resize(table_idx + 1, -1.0f);
     g.TablesLastTimeActive[table_idx] = (float)g.Time;
     temp_data->LastTimeActive = (float)g.Time;
+    temp_data->LastFrameActive = g.FrameCount;
     table->MemoryCompacted = false;
 
     // Setup memory buffer (clear data if columns count changed)
@@ -566,21 +568,28 @@ bool    ImGui::BeginTableEx(const char* name, ImGuiID id, int columns_count, ImG
 // Shared allocations per number of nested tables
 // + 1 (for table->Splitter._Channels)
 // + 2 * active_channels_count (for ImDrawCmd and ImDrawIdx buffers inside channels)
-// Where active_channels_count is variable but often == columns_count or columns_count + 1, see TableSetupDrawChannels() for details.
+// Where active_channels_count is variable but often == visible_columns_count or visible_columns_count + 1, see TableSetupDrawChannels() for details.
 // Unused channels don't perform their +2 allocations.
 void ImGui::TableBeginInitMemory(ImGuiTable* table, int columns_count)
 {
     // Allocate single buffer for our arrays
-    ImSpanAllocator<3> span_allocator;
+    const int columns_bit_array_size = (int)ImBitArrayGetStorageSizeInBytes(columns_count);
+    ImSpanAllocator<7> span_allocator;
     span_allocator.Reserve(0, columns_count * sizeof(ImGuiTableColumn));
     span_allocator.Reserve(1, columns_count * sizeof(ImGuiTableColumnIdx));
     span_allocator.Reserve(2, columns_count * sizeof(ImGuiTableCellData), 4);
+    for (int n = 3; n < 7; n++)
+        span_allocator.Reserve(n, columns_bit_array_size);
     table->RawData = IM_ALLOC(span_allocator.GetArenaSizeInBytes());
     memset(table->RawData, 0, span_allocator.GetArenaSizeInBytes());
     span_allocator.SetArenaBasePtr(table->RawData);
     span_allocator.GetSpan(0, &table->Columns);
     span_allocator.GetSpan(1, &table->DisplayOrderToIndex);
     span_allocator.GetSpan(2, &table->RowCellData);
+    table->EnabledMaskByDisplayOrder = (ImU32*)span_allocator.GetSpanPtrBegin(3);
+    table->EnabledMaskByIndex = (ImU32*)span_allocator.GetSpanPtrBegin(4);
+    table->VisibleMaskByIndex = (ImU32*)span_allocator.GetSpanPtrBegin(5);
+    table->RequestOutputMaskByIndex = (ImU32*)span_allocator.GetSpanPtrBegin(6);
 }
 
 // Apply queued resizing/reordering/hiding requests
@@ -707,37 +716,37 @@ static void TableSetupColumnFlags(ImGuiTable* table, ImGuiTableColumn* column, I
     }
 }
 
-// Layout columns for the frame. This is in essence the followup to BeginTable().
-// Runs on the first call to TableNextRow(), to give a chance for TableSetupColumn() to be called first.
-// FIXME-TABLE: Our width (and therefore our WorkRect) will be minimal in the first frame for _WidthAuto columns.
-// Increase feedback side-effect with widgets relying on WorkRect.Max.x... Maybe provide a default distribution for _WidthAuto columns?
-void ImGui::TableUpdateLayout(ImGuiTable* table)
+// Inputs of TableUpdateLayout() enabled state/widths calculation, for one column
+struct ImGuiTableColumnLayoutInputs
 {
-    ImGuiContext& g = *GImGui;
-    IM_ASSERT(table->IsLayoutLocked == false);
-
-    const ImGuiTableFlags table_sizing_policy = (table->Flags & ImGuiTableFlags_SizingMask_);
-    table->IsDefaultDisplayOrder = true;
-    table->ColumnsEnabledCount = 0;
-    table->EnabledMaskByIndex = 0x00;
-    table->EnabledMaskByDisplayOrder = 0x00;
-    table->LeftMostEnabledColumn = -1;
-    table->MinColumnWidth = ImMax(1.0f, g.Style.FramePadding.x * 1.0f); // g.Style.ColumnsMinSpacing; // FIXME-TABLE
+    ImGuiTableColumnFlags   Flags;
+    int                     IndexAndEnabled;    // Index in display order, IsUserEnabled, IsUserEnabledNextFrame and requesting output
+    int                     SortOrder;
+    float                   WidthRequest;
+    float                   StretchWeight;
+    float                   WidthAuto;
+    float                   InitStretchWeightOrWidth;
+};
+
+// FNV-1a over 32-bit words: we hash every column every frame, which ImHashData() is too slow for on very wide tables.
+static inline ImGuiID TableHashWords(const void* data, size_t data_size, ImGuiID seed)
+{
+    IM_ASSERT((data_size & 3) == 0);
+    const ImU32* words = (const ImU32*)data;
+    ImU32 hash = seed ^ 2166136261u;
+    for (size_t n = 0; n < data_size / 4; n++)
+        hash = (hash ^ words[n]) * 16777619u;
+    return hash;
+}
 
-    // [Part 1] Apply/lock Enabled and Order states. Calculate auto/ideal width for columns. Count fixed/stretch columns.
-    // Process columns in their visible orders as we are building the Prev/Next indices.
-    int count_fixed = 0;                // Number of columns that have fixed sizing policies
-    int count_stretch = 0;              // Number of columns that have stretch sizing policies
-    int prev_visible_column_idx = -1;
-    bool has_auto_fit_request = false;
-    bool has_resizable = false;
-    float stretch_sum_width_auto = 0.0f;
-    float fixed_max_width_auto = 0.0f;
+// Setup columns not submitted by user this frame, then return a hash of all inputs of TableUpdateLayout() Part 1 to 5, or 0 if those can't be skipped.
+static ImGuiID TableCalcLayoutWidthsHash(ImGuiTable* table, float width_avail)
+{
+    bool can_skip = !table->IsInitializing;
+    ImGuiID hash = 0;
     for (int order_n = 0; order_n < table->ColumnsCount; order_n++)
     {
         const int column_n = table->DisplayOrderToIndex[order_n];
-        if (column_n != order_n)
-            table->IsDefaultDisplayOrder = false;
         ImGuiTableColumn* column = &table->Columns[column_n];
 
         // Clear column setup if not submitted by user. Currently we make it mandatory to call TableSetupColumn() every frame.
@@ -750,189 +759,285 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
             column->UserID = 0;
             column->InitStretchWeightOrWidth = -1.0f;
         }
-
-        // Update Enabled state, mark settings and sort specs dirty
         if (!(table->Flags & ImGuiTableFlags_Hideable) || (column->Flags & ImGuiTableColumnFlags_NoHide))
             column->IsUserEnabledNextFrame = true;
-        if (column->IsUserEnabled != column->IsUserEnabledNextFrame)
-        {
-            column->IsUserEnabled = column->IsUserEnabledNextFrame;
-            table->IsSettingsDirty = true;
-        }
-        column->IsEnabled = column->IsUserEnabled && (column->Flags & ImGuiTableColumnFlags_Disabled) == 0;
 
-        if (column->SortOrder != -1 && !column->IsEnabled)
-            table->IsSortSpecsDirty = true;
-        if (column->SortOrder > 0 && !(table->Flags & ImGuiTableFlags_SortMulti))
-            table->IsSortSpecsDirty = true;
+        // Same condition as 'start_auto_fit' in TableUpdateLayout()
+        if (column->AutoFitQueue != 0x00 || column->IsPreserveWidthAuto || ((column->Flags & ImGuiTableColumnFlags_WidthFixed) ? (column->WidthRequest < 0.0f) : (column->StretchWeight < 0.0f)))
+            can_skip = false;
+        if (!can_skip)
+            continue;
 
-        // Auto-fit unsized columns
-        const bool start_auto_fit = (column->Flags & ImGuiTableColumnFlags_WidthFixed) ? (column->WidthRequest < 0.0f) : (column->StretchWeight < 0.0f);
-        if (start_auto_fit)
-            column->AutoFitQueue = column->CannotSkipItemsQueue = (1 << 3) - 1; // Fit for three frames
+        ImGuiTableColumnLayoutInputs inputs;
+        inputs.Flags = column->Flags & ~ImGuiTableColumnFlags_StatusMask_;
+        inputs.IndexAndEnabled = (column_n << 3) | (column->IsUserEnabled ? 1 : 0) | (column->IsUserEnabledNextFrame ? 2 : 0) | (ImBitArrayTestBit(table->RequestOutputMaskByIndex, column_n) ? 4 : 0);
+        inputs.SortOrder = column->SortOrder;
+        inputs.WidthRequest = column->WidthRequest;
+        inputs.StretchWeight = column->StretchWeight;
+        inputs.WidthAuto = ImGui::TableGetColumnWidthAuto(table, column);
+        inputs.InitStretchWeightOrWidth = column->InitStretchWeightOrWidth;
+        hash = TableHashWords(&inputs, sizeof(inputs), hash);
+    }
+    if (!can_skip)
+        return 0;
 
-        if (!column->IsEnabled)
-        {
-            column->IndexWithinEnabledSet = -1;
-            continue;
-        }
+    const int table_inputs[] = { table->Flags, table->ColumnsCount, table->SortSpecsCount };
+    const float table_inputs_widths[] = { table->MinColumnWidth, table->OuterPaddingX, table->CellPaddingX, table->CellSpacingX1, table->CellSpacingX2, width_avail };
+    hash = TableHashWords(table_inputs, sizeof(table_inputs), hash);
+    hash = TableHashWords(table_inputs_widths, sizeof(table_inputs_widths), hash);
+    return (hash != 0) ? hash : 1;
+}
 
-        // Mark as enabled and link to previous/next enabled column
-        column->PrevEnabledColumn = (ImGuiTableColumnIdx)prev_visible_column_idx;
-        column->NextEnabledColumn = -1;
-        if (prev_visible_column_idx != -1)
-            table->Columns[prev_visible_column_idx].NextEnabledColumn = (ImGuiTableColumnIdx)column_n;
-        else
-            table->LeftMostEnabledColumn = (ImGuiTableColumnIdx)column_n;
-        column->IndexWithinEnabledSet = table->ColumnsEnabledCount++;
-        table->EnabledMaskByIndex |= (ImU64)1 << column_n;
-        table->EnabledMaskByDisplayOrder |= (ImU64)1 << column->DisplayOrder;
-        prev_visible_column_idx = column_n;
-        IM_ASSERT(column->IndexWithinEnabledSet <= column->DisplayOrder);
-
-        // Calculate ideal/auto column width (that's the width required for all contents to be visible without clipping)
-        // Combine width from regular rows + width from headers unless requested not to.
-        if (!column->IsPreserveWidthAuto)
-            column->WidthAuto = TableGetColumnWidthAuto(table, column);
-
-        // Non-resizable columns keep their requested width (apply user value regardless of IsPreserveWidthAuto)
-        const bool column_is_resizable = (column->Flags & ImGuiTableColumnFlags_NoResize) == 0;
-        if (column_is_resizable)
-            has_resizable = true;
-        if ((column->Flags & ImGuiTableColumnFlags_WidthFixed) && column->InitStretchWeightOrWidth > 0.0f && !column_is_resizable)
-            column->WidthAuto = column->InitStretchWeightOrWidth;
+// Layout columns for the frame. This is in essence the followup to BeginTable().
+// Runs on the first call to TableNextRow(), to give a chance for TableSetupColumn() to be called first.
+// FIXME-TABLE: Our width (and therefore our WorkRect) will be minimal in the first frame for _WidthAuto columns.
+// Increase feedback side-effect with widgets relying on WorkRect.Max.x... Maybe provide a default distribution for _WidthAuto columns?
+void ImGui::TableUpdateLayout(ImGuiTable* table)
+{
+    IMGUI_PROFILE_SCOPE("TableUpdateLayout");
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(table->IsLayoutLocked == false);
 
-        if (column->AutoFitQueue != 0x00)
-            has_auto_fit_request = true;
-        if (column->Flags & ImGuiTableColumnFlags_WidthStretch)
-        {
-            stretch_sum_width_auto += column->WidthAuto;
-            count_stretch++;
-        }
-        else
-        {
-            fixed_max_width_auto = ImMax(fixed_max_width_auto, column->WidthAuto);
-            count_fixed++;
-        }
-    }
-    if ((table->Flags & ImGuiTableFlags_Sortable) && table->SortSpecsCount == 0 && !(table->Flags & ImGuiTableFlags_SortTristate))
-        table->IsSortSpecsDirty = true;
-    table->RightMostEnabledColumn = (ImGuiTableColumnIdx)prev_visible_column_idx;
-    IM_ASSERT(table->LeftMostEnabledColumn >= 0 && table->RightMostEnabledColumn >= 0);
-
-    // [Part 2] Disable child window clipping while fitting columns. This is not strictly necessary but makes it possible
-    // to avoid the column fitting having to wait until the first visible frame of the child container (may or not be a good thing).
-    // FIXME-TABLE: for always auto-resizing columns may not want to do that all the time.
-    if (has_auto_fit_request && table->OuterWindow != table->InnerWindow)
-        table->InnerWindow->SkipItems = false;
-    if (has_auto_fit_request)
-        table->IsSettingsDirty = true;
+    table->MinColumnWidth = ImMax(1.0f, g.Style.FramePadding.x * 1.0f); // g.Style.ColumnsMinSpacing; // FIXME-TABLE
 
-    // [Part 3] Fix column flags and record a few extra information.
-    float sum_width_requests = 0.0f;        // Sum of all width for fixed and auto-resize columns, excluding width contributed by Stretch columns but including spacing/padding.
-    float stretch_sum_weights = 0.0f;       // Sum of all weights for stretch columns.
-    table->LeftMostStretchedColumn = table->RightMostStretchedColumn = -1;
+    // [Part 0] Setup columns not submitted by user, and hash all inputs of the enabled state/widths calculation (Part 1 to 5).
+    // When they are unchanged since our previous call we reuse its results, which are stored in the table and columns.
+    // Auto-fitting columns are changing every frame, in which case we don't bother.
+    const ImRect work_rect = table->WorkRect;
+    const float width_avail = ((table->Flags & ImGuiTableFlags_ScrollX) && table->InnerWidth == 0.0f) ? table->InnerClipRect.GetWidth() : work_rect.GetWidth();
+    ImGuiID layout_hash = TableCalcLayoutWidthsHash(table, width_avail);
+    bool has_resizable = false;
     for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
     {
-        if (!(table->EnabledMaskByIndex & ((ImU64)1 << column_n)))
-            continue;
         ImGuiTableColumn* column = &table->Columns[column_n];
+        if (column->IsUserEnabledNextFrame && !(column->Flags & ImGuiTableColumnFlags_Disabled) && !(column->Flags & ImGuiTableColumnFlags_NoResize))
+            has_resizable = true;
+    }
 
-        const bool column_is_resizable = (column->Flags & ImGuiTableColumnFlags_NoResize) == 0;
-        if (column->Flags & ImGuiTableColumnFlags_WidthFixed)
+    if (layout_hash != 0 && layout_hash == table->LayoutWidthsHash)
+    {
+        // Reuse results: only restore what is altered after Part 5 by the rest of this function and by TableSetupColumn()
+        for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
         {
-            // Apply same widths policy
-            float width_auto = column->WidthAuto;
-            if (table_sizing_policy == ImGuiTableFlags_SizingFixedSame && (column->AutoFitQueue != 0x00 || !column_is_resizable))
-                width_auto = fixed_max_width_auto;
-
-            // Apply automatic width
-            // Latch initial size for fixed columns and update it constantly for auto-resizing column (unless clipped!)
-            if (column->AutoFitQueue != 0x00)
-                column->WidthRequest = width_auto;
-            else if ((column->Flags & ImGuiTableColumnFlags_WidthFixed) && !column_is_resizable && (table->RequestOutputMaskByIndex & ((ImU64)1 << column_n)))
-                column->WidthRequest = width_auto;
-
-            // FIXME-TABLE: Increase minimum size during init frame to avoid biasing auto-fitting widgets
-            // (e.g. TextWrapped) too much. Otherwise what tends to happen is that TextWrapped would output a very
-            // large height (= first frame scrollbar display very off + clipper would skip lots of items).
-            // This is merely making the side-effect less extreme, but doesn't properly fixes it.
-            // FIXME: Move this to ->WidthGiven to avoid temporary lossyless?
-            // FIXME: This break IsPreserveWidthAuto from not flickering if the stored WidthAuto was smaller.
-            if (column->AutoFitQueue > 0x01 && table->IsInitializing && !column->IsPreserveWidthAuto)
-                column->WidthRequest = ImMax(column->WidthRequest, table->MinColumnWidth * 4.0f); // FIXME-TABLE: Another constant/scale?
-            sum_width_requests += column->WidthRequest;
+            ImGuiTableColumn* column = &table->Columns[column_n];
+            if (!column->IsEnabled)
+                continue;
+            column->WidthGiven = column->WidthGivenUnclamped;
+            if (column->NextEnabledColumn == -1 && table->LeftMostStretchedColumn != -1)
+                column->Flags |= ImGuiTableColumnFlags_NoDirectResize_;
         }
-        else
+        if (table->IsLayoutSortSpecsDirty)
+            table->IsSortSpecsDirty = true;
+        table->LayoutWidthsSkipCount++;
+    }
+    else
+    {
+        const ImGuiTableFlags table_sizing_policy = (table->Flags & ImGuiTableFlags_SizingMask_);
+        const bool backup_sort_specs_dirty = table->IsSortSpecsDirty;
+        table->IsSortSpecsDirty = false;
+        table->IsDefaultDisplayOrder = true;
+        table->ColumnsEnabledCount = 0;
+        ImBitArrayClearAllBits(table->EnabledMaskByIndex, table->ColumnsCount);
+        ImBitArrayClearAllBits(table->EnabledMaskByDisplayOrder, table->ColumnsCount);
+        table->LeftMostEnabledColumn = -1;
+
+        // [Part 1] Apply/lock Enabled and Order states. Calculate auto/ideal width for columns. Count fixed/stretch columns.
+        // Process columns in their visible orders as we are building the Prev/Next indices.
+        int count_fixed = 0;                // Number of columns that have fixed sizing policies
+        int count_stretch = 0;              // Number of columns that have stretch sizing policies
+        int prev_visible_column_idx = -1;
+        bool has_auto_fit_request = false;
+        float stretch_sum_width_auto = 0.0f;
+        float fixed_max_width_auto = 0.0f;
+        for (int order_n = 0; order_n < table->ColumnsCount; order_n++)
         {
-            // Initialize stretch weight
-            if (column->AutoFitQueue != 0x00 || column->StretchWeight < 0.0f || !column_is_resizable)
+            const int column_n = table->DisplayOrderToIndex[order_n];
+            if (column_n != order_n)
+                table->IsDefaultDisplayOrder = false;
+            ImGuiTableColumn* column = &table->Columns[column_n];
+
+            // Update Enabled state, mark settings and sort specs dirty
+            if (column->IsUserEnabled != column->IsUserEnabledNextFrame)
             {
-                if (column->InitStretchWeightOrWidth > 0.0f)
-                    column->StretchWeight = column->InitStretchWeightOrWidth;
-                else if (table_sizing_policy == ImGuiTableFlags_SizingStretchProp)
-                    column->StretchWeight = (column->WidthAuto / stretch_sum_width_auto) * count_stretch;
-                else
-                    column->StretchWeight = 1.0f;
+                column->IsUserEnabled = column->IsUserEnabledNextFrame;
+                table->IsSettingsDirty = true;
             }
+            column->IsEnabled = column->IsUserEnabled && (column->Flags & ImGuiTableColumnFlags_Disabled) == 0;
 
-            stretch_sum_weights += column->StretchWeight;
-            if (table->LeftMostStretchedColumn == -1 || table->Columns[table->LeftMostStretchedColumn].DisplayOrder > column->DisplayOrder)
-                table->LeftMostStretchedColumn = (ImGuiTableColumnIdx)column_n;
-            if (table->RightMostStretchedColumn == -1 || table->Columns[table->RightMostStretchedColumn].DisplayOrder < column->DisplayOrder)
-                table->RightMostStretchedColumn = (ImGuiTableColumnIdx)column_n;
-        }
-        column->IsPreserveWidthAuto = false;
-        sum_width_requests += table->CellPaddingX * 2.0f;
-    }
-    table->ColumnsEnabledFixedCount = (ImGuiTableColumnIdx)count_fixed;
+            if (column->SortOrder != -1 && !column->IsEnabled)
+                table->IsSortSpecsDirty = true;
+            if (column->SortOrder > 0 && !(table->Flags & ImGuiTableFlags_SortMulti))
+                table->IsSortSpecsDirty = true;
 
-    // [Part 4] Apply final widths based on requested widths
-    const ImRect work_rect = table->WorkRect;
-    const float width_spacings = (table->OuterPaddingX * 2.0f) + (table->CellSpacingX1 + table->CellSpacingX2) * (table->ColumnsEnabledCount - 1);
-    const float width_avail = ((table->Flags & ImGuiTableFlags_ScrollX) && table->InnerWidth == 0.0f) ? table->InnerClipRect.GetWidth() : work_rect.GetWidth();
-    const float width_avail_for_stretched_columns = width_avail - width_spacings - sum_width_requests;
-    float width_remaining_for_stretched_columns = width_avail_for_stretched_columns;
-    table->ColumnsGivenWidth = width_spacings + (table->CellPaddingX * 2.0f) * table->ColumnsEnabledCount;
-    for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
-    {
-        if (!(table->EnabledMaskByIndex & ((ImU64)1 << column_n)))
-            continue;
-        ImGuiTableColumn* column = &table->Columns[column_n];
+            // Auto-fit unsized columns
+            const bool start_auto_fit = (column->Flags & ImGuiTableColumnFlags_WidthFixed) ? (column->WidthRequest < 0.0f) : (column->StretchWeight < 0.0f);
+            if (start_auto_fit)
+                column->AutoFitQueue = column->CannotSkipItemsQueue = (1 << 3) - 1; // Fit for three frames
 
-        // Allocate width for stretched/weighted columns (StretchWeight gets converted into WidthRequest)
-        if (column->Flags & ImGuiTableColumnFlags_WidthStretch)
-        {
-            float weight_ratio = column->StretchWeight / stretch_sum_weights;
-            column->WidthRequest = IM_FLOOR(ImMax(width_avail_for_stretched_columns * weight_ratio, table->MinColumnWidth) + 0.01f);
-            width_remaining_for_stretched_columns -= column->WidthRequest;
-        }
+            if (!column->IsEnabled)
+            {
+                column->IndexWithinEnabledSet = -1;
+                continue;
+            }
 
-        // [Resize Rule 1] The right-most Visible column is not resizable if there is at least one Stretch column
-        // See additional comments in TableSetColumnWidth().
-        if (column->NextEnabledColumn == -1 && table->LeftMostStretchedColumn != -1)
-            column->Flags |= ImGuiTableColumnFlags_NoDirectResize_;
+            // Mark as enabled and link to previous/next enabled column
+            column->PrevEnabledColumn = (ImGuiTableColumnIdx)prev_visible_column_idx;
+            column->NextEnabledColumn = -1;
+            if (prev_visible_column_idx != -1)
+                table->Columns[prev_visible_column_idx].NextEnabledColumn = (ImGuiTableColumnIdx)column_n;
+            else
+                table->LeftMostEnabledColumn = (ImGuiTableColumnIdx)column_n;
+            column->IndexWithinEnabledSet = table->ColumnsEnabledCount++;
+            ImBitArraySetBit(table->EnabledMaskByIndex, column_n);
+            ImBitArraySetBit(table->EnabledMaskByDisplayOrder, column->DisplayOrder);
+            prev_visible_column_idx = column_n;
+            IM_ASSERT(column->IndexWithinEnabledSet <= column->DisplayOrder);
+
+            // Calculate ideal/auto column width (that's the width required for all contents to be visible without clipping)
+            // Combine width from regular rows + width from headers unless requested not to.
+            if (!column->IsPreserveWidthAuto)
+                column->WidthAuto = TableGetColumnWidthAuto(table, column);
+
+            // Non-resizable columns keep their requested width (apply user value regardless of IsPreserveWidthAuto)
+            const bool column_is_resizable = (column->Flags & ImGuiTableColumnFlags_NoResize) == 0;
+            if ((column->Flags & ImGuiTableColumnFlags_WidthFixed) && column->InitStretchWeightOrWidth > 0.0f && !column_is_resizable)
+                column->WidthAuto = column->InitStretchWeightOrWidth;
 
-        // Assign final width, record width in case we will need to shrink
-        column->WidthGiven = ImFloor(ImMax(column->WidthRequest, table->MinColumnWidth));
-        table->ColumnsGivenWidth += column->WidthGiven;
-    }
+            if (column->AutoFitQueue != 0x00)
+                has_auto_fit_request = true;
+            if (column->Flags & ImGuiTableColumnFlags_WidthStretch)
+            {
+                stretch_sum_width_auto += column->WidthAuto;
+                count_stretch++;
+            }
+            else
+            {
+                fixed_max_width_auto = ImMax(fixed_max_width_auto, column->WidthAuto);
+                count_fixed++;
+            }
+        }
+        if ((table->Flags & ImGuiTableFlags_Sortable) && table->SortSpecsCount == 0 && !(table->Flags & ImGuiTableFlags_SortTristate))
+            table->IsSortSpecsDirty = true;
+        table->RightMostEnabledColumn = (ImGuiTableColumnIdx)prev_visible_column_idx;
+        IM_ASSERT(table->LeftMostEnabledColumn >= 0 && table->RightMostEnabledColumn >= 0);
+
+        // [Part 2] Disable child window clipping while fitting columns. This is not strictly necessary but makes it possible
+        // to avoid the column fitting having to wait until the first visible frame of the child container (may or not be a good thing).
+        // FIXME-TABLE: for always auto-resizing columns may not want to do that all the time.
+        if (has_auto_fit_request && table->OuterWindow != table->InnerWindow)
+            table->InnerWindow->SkipItems = false;
+        if (has_auto_fit_request)
+            table->IsSettingsDirty = true;
 
-    // [Part 5] Redistribute stretch remainder width due to rounding (remainder width is < 1.0f * number of Stretch column).
-    // Using right-to-left distribution (more likely to match resizing cursor).
-    if (width_remaining_for_stretched_columns >= 1.0f && !(table->Flags & ImGuiTableFlags_PreciseWidths))
-        for (int order_n = table->ColumnsCount - 1; stretch_sum_weights > 0.0f && width_remaining_for_stretched_columns >= 1.0f && order_n >= 0; order_n--)
+        // [Part 3] Fix column flags and record a few extra information.
+        float sum_width_requests = 0.0f;        // Sum of all width for fixed and auto-resize columns, excluding width contributed by Stretch columns but including spacing/padding.
+        float stretch_sum_weights = 0.0f;       // Sum of all weights for stretch columns.
+        table->LeftMostStretchedColumn = table->RightMostStretchedColumn = -1;
+        for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
         {
-            if (!(table->EnabledMaskByDisplayOrder & ((ImU64)1 << order_n)))
+            if (!ImBitArrayTestBit(table->EnabledMaskByIndex, column_n))
                 continue;
-            ImGuiTableColumn* column = &table->Columns[table->DisplayOrderToIndex[order_n]];
-            if (!(column->Flags & ImGuiTableColumnFlags_WidthStretch))
+            ImGuiTableColumn* column = &table->Columns[column_n];
+
+            const bool column_is_resizable = (column->Flags & ImGuiTableColumnFlags_NoResize) == 0;
+            if (column->Flags & ImGuiTableColumnFlags_WidthFixed)
+            {
+                // Apply same widths policy
+                float width_auto = column->WidthAuto;
+                if (table_sizing_policy == ImGuiTableFlags_SizingFixedSame && (column->AutoFitQueue != 0x00 || !column_is_resizable))
+                    width_auto = fixed_max_width_auto;
+
+                // Apply automatic width
+                // Latch initial size for fixed columns and update it constantly for auto-resizing column (unless clipped!)
+                if (column->AutoFitQueue != 0x00)
+                    column->WidthRequest = width_auto;
+                else if ((column->Flags & ImGuiTableColumnFlags_WidthFixed) && !column_is_resizable && ImBitArrayTestBit(table->RequestOutputMaskByIndex, column_n))
+                    column->WidthRequest = width_auto;
+
+                // FIXME-TABLE: Increase minimum size during init frame to avoid biasing auto-fitting widgets
+                // (e.g. TextWrapped) too much. Otherwise what tends to happen is that TextWrapped would output a very
+                // large height (= first frame scrollbar display very off + clipper would skip lots of items).
+                // This is merely making the side-effect less extreme, but doesn't properly fixes it.
+                // FIXME: Move this to ->WidthGiven to avoid temporary lossyless?
+                // FIXME: This break IsPreserveWidthAuto from not flickering if the stored WidthAuto was smaller.
+                if (column->AutoFitQueue > 0x01 && table->IsInitializing && !column->IsPreserveWidthAuto)
+                    column->WidthRequest = ImMax(column->WidthRequest, table->MinColumnWidth * 4.0f); // FIXME-TABLE: Another constant/scale?
+                sum_width_requests += column->WidthRequest;
+            }
+            else
+            {
+                // Initialize stretch weight
+                if (column->AutoFitQueue != 0x00 || column->StretchWeight < 0.0f || !column_is_resizable)
+                {
+                    if (column->InitStretchWeightOrWidth > 0.0f)
+                        column->StretchWeight = column->InitStretchWeightOrWidth;
+                    else if (table_sizing_policy == ImGuiTableFlags_SizingStretchProp)
+                        column->StretchWeight = (column->WidthAuto / stretch_sum_width_auto) * count_stretch;
+                    else
+                        column->StretchWeight = 1.0f;
+                }
+
+                stretch_sum_weights += column->StretchWeight;
+                if (table->LeftMostStretchedColumn == -1 || table->Columns[table->LeftMostStretchedColumn].DisplayOrder > column->DisplayOrder)
+                    table->LeftMostStretchedColumn = (ImGuiTableColumnIdx)column_n;
+                if (table->RightMostStretchedColumn == -1 || table->Columns[table->RightMostStretchedColumn].DisplayOrder < column->DisplayOrder)
+                    table->RightMostStretchedColumn = (ImGuiTableColumnIdx)column_n;
+            }
+            column->IsPreserveWidthAuto = false;
+            sum_width_requests += table->CellPaddingX * 2.0f;
+        }
+        table->ColumnsEnabledFixedCount = (ImGuiTableColumnIdx)count_fixed;
+
+        // [Part 4] Apply final widths based on requested widths
+        const float width_spacings = (table->OuterPaddingX * 2.0f) + (table->CellSpacingX1 + table->CellSpacingX2) * (table->ColumnsEnabledCount - 1);
+        const float width_avail_for_stretched_columns = width_avail - width_spacings - sum_width_requests;
+        float width_remaining_for_stretched_columns = width_avail_for_stretched_columns;
+        table->ColumnsGivenWidth = width_spacings + (table->CellPaddingX * 2.0f) * table->ColumnsEnabledCount;
+        for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
+        {
+            if (!ImBitArrayTestBit(table->EnabledMaskByIndex, column_n))
                 continue;
-            column->WidthRequest += 1.0f;
-            column->WidthGiven += 1.0f;
-            width_remaining_for_stretched_columns -= 1.0f;
+            ImGuiTableColumn* column = &table->Columns[column_n];
+
+            // Allocate width for stretched/weighted columns (StretchWeight gets converted into WidthRequest)
+            if (column->Flags & ImGuiTableColumnFlags_WidthStretch)
+            {
+                float weight_ratio = column->StretchWeight / stretch_sum_weights;
+                column->WidthRequest = IM_FLOOR(ImMax(width_avail_for_stretched_columns * weight_ratio, table->MinColumnWidth) + 0.01f);
+                width_remaining_for_stretched_columns -= column->WidthRequest;
+            }
+
+            // [Resize Rule 1] The right-most Visible column is not resizable if there is at least one Stretch column
+            // See additional comments in TableSetColumnWidth().
+            if (column->NextEnabledColumn == -1 && table->LeftMostStretchedColumn != -1)
+                column->Flags |= ImGuiTableColumnFlags_NoDirectResize_;
+
+            // Assign final width, record width in case we will need to shrink
+            column->WidthGiven = ImFloor(ImMax(column->WidthRequest, table->MinColumnWidth));
+            table->ColumnsGivenWidth += column->WidthGiven;
         }
 
+        // [Part 5] Redistribute stretch remainder width due to rounding (remainder width is < 1.0f * number of Stretch column).
+        // Using right-to-left distribution (more likely to match resizing cursor).
+        if (width_remaining_for_stretched_columns >= 1.0f && !(table->Flags & ImGuiTableFlags_PreciseWidths))
+            for (int order_n = table->ColumnsCount - 1; stretch_sum_weights > 0.0f && width_remaining_for_stretched_columns >= 1.0f && order_n >= 0; order_n--)
+            {
+                if (!ImBitArrayTestBit(table->EnabledMaskByDisplayOrder, order_n))
+                    continue;
+                ImGuiTableColumn* column = &table->Columns[table->DisplayOrderToIndex[order_n]];
+                if (!(column->Flags & ImGuiTableColumnFlags_WidthStretch))
+                    continue;
+                column->WidthRequest += 1.0f;
+                column->WidthGiven += 1.0f;
+                width_remaining_for_stretched_columns -= 1.0f;
+            }
+
+        table->IsLayoutSortSpecsDirty = table->IsSortSpecsDirty;
+        table->IsSortSpecsDirty |= backup_sort_specs_dirty;
+        table->LayoutWidthsHash = layout_hash;
+        table->LayoutWidthsCalcCount++;
+    }
+
     table->HoveredColumnBody = -1;
     table->HoveredColumnBorder = -1;
     const ImRect mouse_hit_rect(table->OuterRect.Min.x, table->OuterRect.Min.y, table->OuterRect.Max.x, ImMax(table->OuterRect.Max.y, table->OuterRect.Min.y + table->LastOuterHeight));
@@ -945,8 +1050,9 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
     float offset_x = ((table->FreezeColumnsCount > 0) ? table->OuterRect.Min.x : work_rect.Min.x) + table->OuterPaddingX - table->CellSpacingX1;
     ImRect host_clip_rect = table->InnerClipRect;
     //host_clip_rect.Max.x += table->CellPaddingX + table->CellSpacingX2;
-    table->VisibleMaskByIndex = 0x00;
-    table->RequestOutputMaskByIndex = 0x00;
+    table->ColumnsVisibleCount = 0;
+    ImBitArrayClearAllBits(table->VisibleMaskByIndex, table->ColumnsCount);
+    ImBitArrayClearAllBits(table->RequestOutputMaskByIndex, table->ColumnsCount);
     for (int order_n = 0; order_n < table->ColumnsCount; order_n++)
     {
         const int column_n = table->DisplayOrderToIndex[order_n];
@@ -963,7 +1069,7 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
         // Clear status flags
         column->Flags &= ~ImGuiTableColumnFlags_StatusMask_;
 
-        if ((table->EnabledMaskByDisplayOrder & ((ImU64)1 << order_n)) == 0)
+        if (!ImBitArrayTestBit(table->EnabledMaskByDisplayOrder, order_n))
         {
             // Hidden column: clear a few fields and we are done with it for the remainder of the function.
             // We set a zero-width clip rect but set Min.y/Max.y properly to not interfere with the clipper.
@@ -986,6 +1092,7 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
         column->MinX = offset_x;
 
         // Lock width based on start position and minimum/maximum width for this position
+        column->WidthGivenUnclamped = column->WidthGiven;
         float max_width = TableGetMaxColumnWidth(table, column_n);
         column->WidthGiven = ImMin(column->WidthGiven, max_width);
         column->WidthGiven = ImMax(column->WidthGiven, ImMin(column->WidthRequest, table->MinColumnWidth));
@@ -1016,12 +1123,15 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
         column->IsVisibleY = true; // (column->ClipRect.Max.y > column->ClipRect.Min.y);
         const bool is_visible = column->IsVisibleX; //&& column->IsVisibleY;
         if (is_visible)
-            table->VisibleMaskByIndex |= ((ImU64)1 << column_n);
+        {
+            ImBitArraySetBit(table->VisibleMaskByIndex, column_n);
+            table->ColumnsVisibleCount++;
+        }
 
         // Mark column as requesting output from user. Note that fixed + non-resizable sets are auto-fitting at all times and therefore always request output.
         column->IsRequestOutput = is_visible || column->AutoFitQueue != 0 || column->CannotSkipItemsQueue != 0;
         if (column->IsRequestOutput)
-            table->RequestOutputMaskByIndex |= ((ImU64)1 << column_n);
+            ImBitArraySetBit(table->RequestOutputMaskByIndex, column_n);
 
         // Mark column as SkipItems (ignoring all items/layout)
         column->IsSkipItems = !column->IsEnabled || table->HostSkipItems;
@@ -1148,7 +1258,7 @@ void ImGui::TableUpdateBorders(ImGuiTable* table)
 
     for (int order_n = 0; order_n < table->ColumnsCount; order_n++)
     {
-        if (!(table->EnabledMaskByDisplayOrder & ((ImU64)1 << order_n)))
+        if (!ImBitArrayTestBit(table->EnabledMaskByDisplayOrder, order_n))
             continue;
 
         const int column_n = table->DisplayOrderToIndex[order_n];
@@ -1194,6 +1304,7 @@ void ImGui::TableUpdateBorders(ImGuiTable* table)
 
 void    ImGui::EndTable()
 {
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_Tables);
     ImGuiContext& g = *GImGui;
     ImGuiTable* table = g.CurrentTable;
     IM_ASSERT(table != NULL && "Only call EndTable() if BeginTable() returns true!");
@@ -1263,7 +1374,7 @@ void    ImGui::EndTable()
     // We have no way to prevent user submitting direct ImDrawList calls into a hidden column (but ImGui:: calls will be clipped out)
     // Pros: remove draw calls which will have no effect. since they'll have zero-size cliprect they may be early out anyway.
     // Cons: making it harder for users watching metrics/debugger to spot the wasted vertices.
-    if (table->DummyDrawChannel != (ImGuiTableColumnIdx)-1)
+    if (table->DummyDrawChannel != (ImGuiTableDrawChannelIdx)-1)
     {
         ImDrawChannel* dummy_channel = &table->DrawSplitter._Channels[table->DummyDrawChannel];
         dummy_channel->_CmdBuffer.resize(0);
@@ -1282,7 +1393,7 @@ void    ImGui::EndTable()
     const float width_spacings = (table->OuterPaddingX * 2.0f) + (table->CellSpacingX1 + table->CellSpacingX2) * (table->ColumnsEnabledCount - 1);
     table->ColumnsAutoFitWidth = width_spacings + (table->CellPaddingX * 2.0f) * table->ColumnsEnabledCount;
     for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
-        if (table->EnabledMaskByIndex & ((ImU64)1 << column_n))
+        if (ImBitArrayTestBit(table->EnabledMaskByIndex, column_n))
         {
             ImGuiTableColumn* column = &table->Columns[column_n];
             if ((column->Flags & ImGuiTableColumnFlags_WidthFixed) && !(column->Flags & ImGuiTableColumnFlags_NoResize))
@@ -1396,6 +1507,7 @@ void    ImGui::EndTable()
 // If (init_width_or_weight <= 0.0f) it is ignored
 void ImGui::TableSetupColumn(const char* label, ImGuiTableColumnFlags flags, float init_width_or_weight, ImGuiID user_id)
 {
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_Tables);
     ImGuiContext& g = *GImGui;
     ImGuiTable* table = g.CurrentTable;
     IM_ASSERT(table != NULL && "Need to call TableSetupColumn() after BeginTable()!");
@@ -1623,7 +1735,7 @@ void ImGui::TableSetBgColor(ImGuiTableBgTarget target, ImU32 color, int column_n
             return;
         if (column_n == -1)
             column_n = table->CurrentColumn;
-        if ((table->VisibleMaskByIndex & ((ImU64)1 << column_n)) == 0)
+        if (!ImBitArrayTestBit(table->VisibleMaskByIndex, column_n))
             return;
         if (table->RowCellDataCurrent < 0 || table->RowCellData[table->RowCellDataCurrent].Column != column_n)
             table->RowCellDataCurrent++;
@@ -1867,6 +1979,7 @@ void ImGui::TableEndRow(ImGuiTable* table)
 // - TableGetColumnIndex()
 // - TableSetColumnIndex()
 // - TableNextColumn()
+// - TableGetNextVisibleColumn()
 // - TableBeginCell() [Internal]
 // - TableEndCell() [Internal]
 //-------------------------------------------------------------------------
@@ -1898,7 +2011,7 @@ bool ImGui::TableSetColumnIndex(int column_n)
 
     // Return whether the column is visible. User may choose to skip submitting items based on this return value,
     // however they shouldn't skip submitting for columns that may have the tallest contribution to row height.
-    return (table->RequestOutputMaskByIndex & ((ImU64)1 << column_n)) != 0;
+    return ImBitArrayTestBit(table->RequestOutputMaskByIndex, column_n);
 }
 
 // [Public] Append into the next column, wrap and create a new row when already on last column
@@ -1924,7 +2037,29 @@ bool ImGui::TableNextColumn()
     // Return whether the column is visible. User may choose to skip submitting items based on this return value,
     // however they shouldn't skip submitting for columns that may have the tallest contribution to row height.
     int column_n = table->CurrentColumn;
-    return (table->RequestOutputMaskByIndex & ((ImU64)1 << column_n)) != 0;
+    return ImBitArrayTestBit(table->RequestOutputMaskByIndex, column_n);
+}
+
+// [Public] Return index of the first column after 'column_n' for which TableSetColumnIndex() would return true, -1 if none.
+// This is meant for tables with many columns: iterating with TableNextColumn() visits every column of every row,
+// whereas scrolled out columns can be skipped in bulk here.
+int ImGui::TableGetNextVisibleColumn(int column_n)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiTable* table = g.CurrentTable;
+    if (!table)
+        return -1;
+    if (!table->IsLayoutLocked)
+        TableUpdateLayout(table);
+
+    for (column_n = ImMax(column_n + 1, 0); column_n < table->ColumnsCount; column_n++)
+    {
+        if (table->RequestOutputMaskByIndex[column_n >> 5] == 0)
+            column_n |= 31; // Skip 32 columns at a time
+        else if (ImBitArrayTestBit(table->RequestOutputMaskByIndex, column_n))
+            return column_n;
+    }
+    return -1;
 }
 
 
@@ -2256,12 +2391,13 @@ void ImGui::TablePopBackgroundChannel()
 // - FreezeRows                   --> 2+D+N*2 (unless scrolling value is zero)
 // - FreezeRows || FreezeColunns  --> 3+D+N*2 (unless scrolling value is zero)
 // Where D is 1 if any column is clipped or hidden (dummy channel) otherwise 0.
+// Where N is the number of visible columns: clipped columns share the dummy channel, so very wide tables only pay for what is in sight.
 void ImGui::TableSetupDrawChannels(ImGuiTable* table)
 {
     const int freeze_row_multiplier = (table->FreezeRowsCount > 0) ? 2 : 1;
-    const int channels_for_row = (table->Flags & ImGuiTableFlags_NoClip) ? 1 : table->ColumnsEnabledCount;
+    const int channels_for_row = (table->Flags & ImGuiTableFlags_NoClip) ? 1 : table->ColumnsVisibleCount;
     const int channels_for_bg = 1 + 1 * freeze_row_multiplier;
-    const int channels_for_dummy = (table->ColumnsEnabledCount < table->ColumnsCount || table->VisibleMaskByIndex != table->EnabledMaskByIndex) ? +1 : 0;
+    const int channels_for_dummy = (table->ColumnsVisibleCount < table->ColumnsCount) ? +1 : 0; // Visible columns are a subset of enabled columns
     const int channels_total = channels_for_bg + (channels_for_row * freeze_row_multiplier) + channels_for_dummy;
     table->DrawSplitter->Split(table->InnerWindow->DrawList, channels_total);
     table->DummyDrawChannel = (ImGuiTableDrawChannelIdx)((channels_for_dummy > 0) ? channels_total - 1 : -1);
@@ -2326,6 +2462,7 @@ void ImGui::TableSetupDrawChannels(ImGuiTable* table)
 // This function is particularly tricky to understand.. take a breath.
 void ImGui::TableMergeDrawChannels(ImGuiTable* table)
 {
+    IMGUI_PROFILE_SCOPE("TableMergeDrawChannels");
     ImGuiContext& g = *GImGui;
     ImDrawListSplitter* splitter = table->DrawSplitter;
     const bool has_freeze_v = (table->FreezeRowsCount > 0);
@@ -2333,21 +2470,29 @@ void ImGui::TableMergeDrawChannels(ImGuiTable* table)
     IM_ASSERT(splitter->_Current == 0);
 
     // Track which groups we are going to attempt to merge, and which channels goes into each group.
+    // Channel masks are sized from the number of channels actually used by this table and stored in shared temporary storage,
+    // 4 merge groups masks followed by 1 remaining channels mask (used in step 2).
     struct MergeGroup
     {
-        ImRect  ClipRect;
-        int     ChannelsCount;
-        ImBitArray<IMGUI_TABLE_MAX_DRAW_CHANNELS> ChannelsMask;
-
-        MergeGroup() { ChannelsCount = 0; }
+        ImRect          ClipRect;
+        int             ChannelsCount;
+        ImBitArrayPtr   ChannelsMask;
     };
+    const int mask_words = (splitter->_Count + 31) >> 5;
+    g.DrawChannelsTempMergeMasks.resize(mask_words * 5);
+    ImBitArrayClearAllBits(g.DrawChannelsTempMergeMasks.Data, mask_words * 5 * 32);
     int merge_group_mask = 0x00;
     MergeGroup merge_groups[4];
+    for (int merge_group_n = 0; merge_group_n < IM_ARRAYSIZE(merge_groups); merge_group_n++)
+    {
+        merge_groups[merge_group_n].ChannelsCount = 0;
+        merge_groups[merge_group_n].ChannelsMask = g.DrawChannelsTempMergeMasks.Data + mask_words * merge_group_n;
+    }
 
     // 1. Scan channels and take note of those which can be merged
     for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
     {
-        if ((table->VisibleMaskByIndex & ((ImU64)1 << column_n)) == 0)
+        if (!ImBitArrayTestBit(table->VisibleMaskByIndex, column_n))
             continue;
         ImGuiTableColumn* column = &table->Columns[column_n];
 
@@ -2379,11 +2524,11 @@ void ImGui::TableMergeDrawChannels(ImGuiTable* table)
             }
 
             const int merge_group_n = (has_freeze_h && column_n < table->FreezeColumnsCount ? 0 : 1) + (has_freeze_v && merge_group_sub_n == 0 ? 0 : 2);
-            IM_ASSERT(channel_no < IMGUI_TABLE_MAX_DRAW_CHANNELS);
+            IM_ASSERT(channel_no < splitter->_Count);
             MergeGroup* merge_group = &merge_groups[merge_group_n];
             if (merge_group->ChannelsCount == 0)
                 merge_group->ClipRect = ImRect(+FLT_MAX, +FLT_MAX, -FLT_MAX, -FLT_MAX);
-            merge_group->ChannelsMask.SetBit(channel_no);
+            ImBitArraySetBit(merge_group->ChannelsMask, channel_no);
             merge_group->ChannelsCount++;
             merge_group->ClipRect.Add(src_channel->_CmdBuffer[0].ClipRect);
             merge_group_mask |= (1 << merge_group_n);
@@ -2419,9 +2564,9 @@ void ImGui::TableMergeDrawChannels(ImGuiTable* table)
         const int LEADING_DRAW_CHANNELS = 2;
         g.DrawChannelsTempMergeBuffer.resize(splitter->_Count - LEADING_DRAW_CHANNELS); // Use shared temporary storage so the allocation gets amortized
         ImDrawChannel* dst_tmp = g.DrawChannelsTempMergeBuffer.Data;
-        ImBitArray<IMGUI_TABLE_MAX_DRAW_CHANNELS> remaining_mask;                       // We need 132-bit of storage
-        remaining_mask.SetBitRange(LEADING_DRAW_CHANNELS, splitter->_Count);
-        remaining_mask.ClearBit(table->Bg2DrawChannelUnfrozen);
+        ImBitArrayPtr remaining_mask = g.DrawChannelsTempMergeMasks.Data + mask_words * 4;
+        ImBitArraySetBitRange(remaining_mask, LEADING_DRAW_CHANNELS, splitter->_Count);
+        ImBitArrayClearBit(remaining_mask, table->Bg2DrawChannelUnfrozen);
         IM_ASSERT(has_freeze_v == false || table->Bg2DrawChannelUnfrozen != TABLE_DRAW_CHANNEL_BG2_FROZEN);
         int remaining_count = splitter->_Count - (has_freeze_v ? LEADING_DRAW_CHANNELS + 1 : LEADING_DRAW_CHANNELS);
         //ImRect host_rect = (table->InnerWindow == table->OuterWindow) ? table->InnerClipRect : table->HostClipRect;
@@ -2454,14 +2599,14 @@ void ImGui::TableMergeDrawChannels(ImGuiTable* table)
                 GetOverlayDrawList()->AddLine(merge_group->ClipRect.Max, merge_clip_rect.Max, IM_COL32(255, 100, 0, 200));
 #endif
                 remaining_count -= merge_group->ChannelsCount;
-                for (int n = 0; n < IM_ARRAYSIZE(remaining_mask.Storage); n++)
-                    remaining_mask.Storage[n] &= ~merge_group->ChannelsMask.Storage[n];
+                for (int n = 0; n < mask_words; n++)
+                    remaining_mask[n] &= ~merge_group->ChannelsMask[n];
                 for (int n = 0; n < splitter->_Count && merge_channels_count != 0; n++)
                 {
                     // Copy + overwrite new clip rect
-                    if (!merge_group->ChannelsMask.TestBit(n))
+                    if (!ImBitArrayTestBit(merge_group->ChannelsMask, n))
                         continue;
-                    merge_group->ChannelsMask.ClearBit(n);
+                    ImBitArrayClearBit(merge_group->ChannelsMask, n);
                     merge_channels_count--;
 
                     ImDrawChannel* channel = &splitter->_Channels[n];
@@ -2479,7 +2624,7 @@ void ImGui::TableMergeDrawChannels(ImGuiTable* table)
         // Append unmergeable channels that we didn't reorder at the end of the list
         for (int n = 0; n < splitter->_Count && remaining_count != 0; n++)
         {
-            if (!remaining_mask.TestBit(n))
+            if (!ImBitArrayTestBit(remaining_mask, n))
                 continue;
             ImDrawChannel* channel = &splitter->_Channels[n];
             memcpy(dst_tmp++, channel, sizeof(ImDrawChannel));
@@ -2493,6 +2638,7 @@ void ImGui::TableMergeDrawChannels(ImGuiTable* table)
 // FIXME-TABLE: This is a mess, need to redesign how we render borders (as some are also done in TableEndRow)
 void ImGui::TableDrawBorders(ImGuiTable* table)
 {
+    IMGUI_PROFILE_SCOPE("TableDrawBorders");
     ImGuiWindow* inner_window = table->InnerWindow;
     if (!table->OuterWindow->ClipRect.Overlaps(table->OuterRect))
         return;
@@ -2510,7 +2656,7 @@ void ImGui::TableDrawBorders(ImGuiTable* table)
     {
         for (int order_n = 0; order_n < table->ColumnsCount; order_n++)
         {
-            if (!(table->EnabledMaskByDisplayOrder & ((ImU64)1 << order_n)))
+            if (!ImBitArrayTestBit(table->EnabledMaskByDisplayOrder, order_n))
                 continue;
 
             const int column_n = table->DisplayOrderToIndex[order_n];
@@ -2595,6 +2741,7 @@ void ImGui::TableDrawBorders(ImGuiTable* table)
 // - TableSetColumnSortDirection() [Internal]
 // - TableSortSpecsSanitize() [Internal]
 // - TableSortSpecsBuild() [Internal]
+// - ImGuiTableSorter
 //-------------------------------------------------------------------------
 
 // Return NULL if no sort specs (most often when ImGuiTableFlags_Sortable is not set)
@@ -2690,8 +2837,11 @@ void ImGui::TableSortSpecsSanitize(ImGuiTable* table)
     IM_ASSERT(table->Flags & ImGuiTableFlags_Sortable);
 
     // Clear SortOrder from hidden column and verify that there's no gap or duplicate.
+    // Without duplicates, all sort orders being < sort_order_count means that they exactly cover [0, sort_order_count).
     int sort_order_count = 0;
-    ImU64 sort_order_mask = 0x00;
+    int sort_order_max = -1;
+    bool sort_order_has_invalid = false;
+    ImBitArray<IMGUI_TABLE_MAX_COLUMNS> sort_order_mask;
     for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
     {
         ImGuiTableColumn* column = &table->Columns[column_n];
@@ -2700,26 +2850,29 @@ void ImGui::TableSortSpecsSanitize(ImGuiTable* table)
         if (column->SortOrder == -1)
             continue;
         sort_order_count++;
-        sort_order_mask |= ((ImU64)1 << column->SortOrder);
-        IM_ASSERT(sort_order_count < (int)sizeof(sort_order_mask) * 8);
+        sort_order_max = ImMax(sort_order_max, (int)column->SortOrder);
+        if (column->SortOrder < 0 || column->SortOrder >= IMGUI_TABLE_MAX_COLUMNS || sort_order_mask.TestBit(column->SortOrder)) // Out of range or duplicate values will be linearized below
+            sort_order_has_invalid = true;
+        else
+            sort_order_mask.SetBit(column->SortOrder);
     }
 
-    const bool need_fix_linearize = ((ImU64)1 << sort_order_count) != (sort_order_mask + 1);
+    const bool need_fix_linearize = sort_order_has_invalid || sort_order_max >= sort_order_count;
     const bool need_fix_single_sort_order = (sort_order_count > 1) && !(table->Flags & ImGuiTableFlags_SortMulti);
     if (need_fix_linearize || need_fix_single_sort_order)
     {
-        ImU64 fixed_mask = 0x00;
+        ImBitArray<IMGUI_TABLE_MAX_COLUMNS> fixed_mask;
         for (int sort_n = 0; sort_n < sort_order_count; sort_n++)
         {
             // Fix: Rewrite sort order fields if needed so they have no gap or duplicate.
             // (e.g. SortOrder 0 disappeared, SortOrder 1..2 exists --> rewrite then as SortOrder 0..1)
             int column_with_smallest_sort_order = -1;
             for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
-                if ((fixed_mask & ((ImU64)1 << (ImU64)column_n)) == 0 && table->Columns[column_n].SortOrder != -1)
+                if (!fixed_mask.TestBit(column_n) && table->Columns[column_n].SortOrder != -1)
                     if (column_with_smallest_sort_order == -1 || table->Columns[column_n].SortOrder < table->Columns[column_with_smallest_sort_order].SortOrder)
                         column_with_smallest_sort_order = column_n;
             IM_ASSERT(column_with_smallest_sort_order != -1);
-            fixed_mask |= ((ImU64)1 << column_with_smallest_sort_order);
+            fixed_mask.SetBit(column_with_smallest_sort_order);
             table->Columns[column_with_smallest_sort_order].SortOrder = (ImGuiTableColumnIdx)sort_n;
 
             // Fix: Make sure only one column has a SortOrder if ImGuiTableFlags_MultiSortable is not set.
@@ -2753,6 +2906,7 @@ void ImGui::TableSortSpecsSanitize(ImGuiTable* table)
 
 void ImGui::TableSortSpecsBuild(ImGuiTable* table)
 {
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_Tables);
     bool dirty = table->IsSortSpecsDirty;
     if (dirty)
     {
@@ -2782,6 +2936,171 @@ void ImGui::TableSortSpecsBuild(ImGuiTable* table)
     table->SortSpecs.SpecsCount = table->SortSpecsCount;
 }
 
+void ImGuiTableSorter::SetColumnKeys(int column_n, ImGuiDataType data_type, const void* data, int stride)
+{
+    IM_ASSERT(column_n >= 0 && column_n < IMGUI_TABLE_MAX_COLUMNS);
+    IM_ASSERT(data_type >= 0 && data_type < ImGuiDataType_COUNT);
+    if (stride == 0)
+        stride = (int)ImGui::DataTypeGetInfo(data_type)->Size;
+    while (Columns.Size <= column_n)
+        Columns.push_back(ImGuiTableSorterColumn());
+    ImGuiTableSorterColumn* column = &Columns[column_n];
+    if (column->DataType != data_type || column->Data != data || column->Stride != stride)
+        IsDirty = true;
+    column->DataType = data_type;
+    column->Data = data;
+    column->Stride = stride;
+}
+
+// Convert a key to an unsigned integer with the same ordering
+static ImU64 TableSorterGetKey(const ImGuiTableSorterColumn* column, int item_n)
+{
+    const void* p = (const char*)column->Data + (size_t)item_n * (size_t)column->Stride;
+    switch (column->DataType)
+    {
+    case ImGuiDataType_S8:  return (ImU8)(*(const ImS8*)p) ^ 0x80;
+    case ImGuiDataType_U8:  return *(const ImU8*)p;
+    case ImGuiDataType_S16: return (ImU16)(*(const ImS16*)p) ^ 0x8000;
+    case ImGuiDataType_U16: return *(const ImU16*)p;
+    case ImGuiDataType_S32: return (ImU32)(*(const ImS32*)p) ^ 0x80000000u;
+    case ImGuiDataType_U32: return *(const ImU32*)p;
+    case ImGuiDataType_S64: return (ImU64)(*(const ImS64*)p) ^ ((ImU64)1 << 63);
+    case ImGuiDataType_U64: return *(const ImU64*)p;
+    case ImGuiDataType_Float:  { ImU32 bits; memcpy(&bits, p, sizeof(bits)); return (bits & 0x80000000u) ? (ImU32)~bits : (bits | 0x80000000u); }
+    case ImGuiDataType_Double: { ImU64 bits; memcpy(&bits, p, sizeof(bits)); return (bits & ((ImU64)1 << 63)) ? ~bits : (bits | ((ImU64)1 << 63)); }
+    case ImGuiDataType_COUNT: break;
+    }
+    IM_ASSERT(0);
+    return 0;
+}
+
+// Stable LSD radix sort of 'indices' by 'keys', 8 bits per pass. Return the buffer holding the sorted indices.
+// Passes over bytes which are identical in all keys are skipped, so e.g. a column of small ints only needs 1 or 2 passes.
+static int* TableSorterRadixSort(ImU64* keys, int* indices, ImU64* temp_keys, int* temp_indices, int count)
+{
+    ImU32 counts[8][256];
+    memset(counts, 0, sizeof(counts));
+    for (int n = 0; n < count; n++)
+    {
+        const ImU64 key = keys[n];
+        for (int byte_n = 0; byte_n < 8; byte_n++)
+            counts[byte_n][(key >> (byte_n * 8)) & 0xFF]++;
+    }
+
+    for (int byte_n = 0; byte_n < 8; byte_n++)
+    {
+        ImU32* offsets = counts[byte_n];
+        const int shift = byte_n * 8;
+        if (offsets[(keys[0] >> shift) & 0xFF] == (ImU32)count)
+            continue;
+        ImU32 offset = 0;
+        for (int bucket_n = 0; bucket_n < 256; bucket_n++)
+        {
+            const ImU32 bucket_count = offsets[bucket_n];
+            offsets[bucket_n] = offset;
+            offset += bucket_count;
+        }
+        for (int n = 0; n < count; n++)
+        {
+            const ImU32 dst = offsets[(keys[n] >> shift) & 0xFF]++;
+            temp_keys[dst] = keys[n];
+            temp_indices[dst] = indices[n];
+        }
+        ImSwap(keys, temp_keys);
+        ImSwap(indices, temp_indices);
+    }
+    return indices;
+}
+
+static const ImGuiTableSorterColumn* TableSorterFindColumn(const ImGuiTableSorter* sorter, const ImGuiTableColumnSortSpecs* sort_spec)
+{
+    if (sort_spec->ColumnIndex < 0 || sort_spec->ColumnIndex >= sorter->Columns.Size)
+        return NULL;
+    const ImGuiTableSorterColumn* column = &sorter->Columns[sort_spec->ColumnIndex];
+    return column->Data ? column : NULL;
+}
+
+void ImGuiTableSorter::Sort(ImGuiTableSortSpecs* sort_specs, int items_count)
+{
+    IM_ASSERT(items_count >= 0);
+    const int specs_count = sort_specs ? sort_specs->SpecsCount : 0;
+    if (sort_specs)
+        sort_specs->SpecsDirty = false;
+    if (Indices.Size != items_count)
+        IsDirty = true;
+
+    // Compare with specs of last sort
+    bool specs_equal = !IsDirty && LastSpecs.Size == specs_count;
+    bool primary_flipped = false;
+    for (int spec_n = 0; spec_n < specs_count && specs_equal; spec_n++)
+    {
+        const ImGuiTableColumnSortSpecs* last_spec = &LastSpecs[spec_n];
+        const ImGuiTableColumnSortSpecs* spec = &sort_specs->Specs[spec_n];
+        if (last_spec->ColumnIndex != spec->ColumnIndex)
+            specs_equal = false;
+        else if (last_spec->SortDirection != spec->SortDirection && spec_n == 0)
+            primary_flipped = true;
+        else if (last_spec->SortDirection != spec->SortDirection)
+            specs_equal = false;
+    }
+    if (specs_equal && !primary_flipped)
+        return;
+    LastSpecs.resize(specs_count);
+    if (specs_count > 0)
+        memcpy(LastSpecs.Data, sort_specs->Specs, (size_t)specs_count * sizeof(ImGuiTableColumnSortSpecs));
+    IsDirty = false;
+    if (items_count <= 1 && Indices.Size == items_count)
+        return;
+
+    // Only the direction of the primary spec changed: reverse the order of runs of items with equal primary keys.
+    // Items within a run keep their order, which is the order given by the other specs.
+    if (specs_equal && primary_flipped)
+    {
+        const ImGuiTableSorterColumn* column = TableSorterFindColumn(this, &sort_specs->Specs[0]);
+        if (column == NULL)
+            return;
+        TempKeys.resize(items_count);
+        TempIndices.resize(items_count);
+        ImU64* keys = TempKeys.Data;
+        for (int n = 0; n < items_count; n++)
+            keys[n] = TableSorterGetKey(column, Indices[n]);
+        int dst = 0;
+        for (int run_end = items_count; run_end > 0; )
+        {
+            int run_start = run_end - 1;
+            while (run_start > 0 && keys[run_start - 1] == keys[run_end - 1])
+                run_start--;
+            memcpy(&TempIndices[dst], &Indices[run_start], (size_t)(run_end - run_start) * sizeof(int));
+            dst += run_end - run_start;
+            run_end = run_start;
+        }
+        Indices.swap(TempIndices);
+        return;
+    }
+
+    // Full sort: starting from items in index order, sort by each spec from the least significant one
+    Indices.resize(items_count);
+    for (int n = 0; n < items_count; n++)
+        Indices[n] = n;
+    if (items_count <= 1)
+        return;
+    TempKeys.resize(items_count * 2);
+    TempIndices.resize(items_count);
+    ImU64* keys = TempKeys.Data;
+    for (int spec_n = specs_count - 1; spec_n >= 0; spec_n--)
+    {
+        const ImGuiTableColumnSortSpecs* spec = &sort_specs->Specs[spec_n];
+        const ImGuiTableSorterColumn* column = TableSorterFindColumn(this, spec);
+        if (column == NULL)
+            continue;
+        const ImU64 key_xor = (spec->SortDirection == ImGuiSortDirection_Descending) ? ~(ImU64)0 : 0;
+        for (int n = 0; n < items_count; n++)
+            keys[n] = TableSorterGetKey(column, Indices[n]) ^ key_xor;
+        if (TableSorterRadixSort(keys, Indices.Data, keys + items_count, TempIndices.Data, items_count) != Indices.Data)
+            Indices.swap(TempIndices);
+    }
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Tables: Headers
 //-------------------------------------------------------------------------
@@ -2801,8 +3120,11 @@ float ImGui::TableGetHeaderRowHeight()
     for (int column_n = 0; column_n < columns_count; column_n++)
     {
         ImGuiTableColumnFlags flags = TableGetColumnFlags(column_n);
-        if ((flags & ImGuiTableColumnFlags_IsEnabled) && !(flags & ImGuiTableColumnFlags_NoHeaderLabel))
-            row_height = ImMax(row_height, CalcTextSize(TableGetColumnName(column_n)).y);
+        if (!(flags & ImGuiTableColumnFlags_IsEnabled) || (flags & ImGuiTableColumnFlags_NoHeaderLabel))
+            continue;
+        const char* name = TableGetColumnName(column_n);
+        if (strchr(name, '\n') != NULL) // Single line labels are never taller than GetTextLineHeight(), skip measuring them
+            row_height = ImMax(row_height, CalcTextSize(name).y);
     }
     row_height += GetStyle().CellPadding.y * 2.0f;
     return row_height;
@@ -2831,11 +3153,11 @@ void ImGui::TableHeadersRow()
     if (table->HostSkipItems) // Merely an optimization, you may skip in your own code.
         return;
 
+    // Only visit columns that are visible: other would be skipped anyway, but not without going through TableSetColumnIndex().
     const int columns_count = TableGetColumnCount();
-    for (int column_n = 0; column_n < columns_count; column_n++)
+    for (int column_n = TableGetNextVisibleColumn(-1); column_n != -1; column_n = TableGetNextVisibleColumn(column_n))
     {
-        if (!TableSetColumnIndex(column_n))
-            continue;
+        TableSetColumnIndex(column_n);
 
         // Push an id to allow unnamed labels (generally accidental, but let's behave nicely with them)
         // - in your own code you may omit the PushID/PopID all-together, provided you know they won't collide
@@ -3131,6 +3453,8 @@ void ImGui::TableDrawContextMenu(ImGuiTable* table)
 // - TableSettingsHandler_ReadOpen() [Internal]
 // - TableSettingsHandler_ReadLine() [Internal]
 // - TableSettingsHandler_WriteAll() [Internal]
+// - TableSettingsHandler_ReadAllBinary() [Internal]
+// - TableSettingsHandler_WriteAllBinary() [Internal]
 // - TableSettingsInstallHandler() [Internal]
 //-------------------------------------------------------------------------
 // [Init] 1: TableSettingsHandler_ReadXXXX()   Load and parse .ini file into TableSettings.
@@ -3159,6 +3483,7 @@ static size_t TableSettingsCalcChunkSize(int columns_count)
 
 ImGuiTableSettings* ImGui::TableSettingsCreate(ImGuiID id, int columns_count)
 {
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_Settings);
     ImGuiContext& g = *GImGui;
     ImGuiTableSettings* settings = g.SettingsTables.alloc_chunk(TableSettingsCalcChunkSize(columns_count));
     TableSettingsInit(settings, id, columns_count, columns_count);
@@ -3251,6 +3576,7 @@ void ImGui::TableSaveSettings(ImGuiTable* table)
     }
     settings->SaveFlags &= table->Flags;
     settings->RefScale = save_ref_scale ? table->RefScale : 0.0f;
+    settings->IniSize = 0; // Serialize again on next save
 
     MarkIniSettingsDirty();
 }
@@ -3283,7 +3609,8 @@ void ImGui::TableLoadSettings(ImGuiTable* table)
 
     // Serialize ImGuiTableSettings/ImGuiTableColumnSettings into ImGuiTable/ImGuiTableColumn
     ImGuiTableColumnSettings* column_settings = settings->GetColumnSettings();
-    ImU64 display_order_mask = 0;
+    ImBitArray<IMGUI_TABLE_MAX_COLUMNS> display_order_mask;
+    int display_order_count = 0;
     for (int data_n = 0; data_n < settings->ColumnsCount; data_n++, column_settings++)
     {
         int column_n = column_settings->Index;
@@ -3303,15 +3630,18 @@ void ImGui::TableLoadSettings(ImGuiTable* table)
             column->DisplayOrder = column_settings->DisplayOrder;
         else
             column->DisplayOrder = (ImGuiTableColumnIdx)column_n;
-        display_order_mask |= (ImU64)1 << column->DisplayOrder;
+        if (column->DisplayOrder >= 0 && column->DisplayOrder < settings->ColumnsCount && !display_order_mask.TestBit(column->DisplayOrder))
+        {
+            display_order_mask.SetBit(column->DisplayOrder);
+            display_order_count++;
+        }
         column->IsUserEnabled = column->IsUserEnabledNextFrame = column_settings->IsEnabled;
         column->SortOrder = column_settings->SortOrder;
         column->SortDirection = column_settings->SortDirection;
     }
 
     // Validate and fix invalid display order data
-    const ImU64 expected_display_order_mask = (settings->ColumnsCount == 64) ? ~0 : ((ImU64)1 << settings->ColumnsCount) - 1;
-    if (display_order_mask != expected_display_order_mask)
+    if (display_order_count != settings->ColumnsCount)
         for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
             table->Columns[column_n].DisplayOrder = (ImGuiTableColumnIdx)column_n;
 
@@ -3341,14 +3671,10 @@ static void TableSettingsHandler_ApplyAll(ImGuiContext* ctx, ImGuiSettingsHandle
         }
 }
 
-static void* TableSettingsHandler_ReadOpen(ImGuiContext*, ImGuiSettingsHandler*, const char* name)
+// Get cleared settings to read into
+static ImGuiTableSettings* TableSettingsRecycleOrCreate(ImGuiID id, int columns_count, bool find_existing)
 {
-    ImGuiID id = 0;
-    int columns_count = 0;
-    if (sscanf(name, "0x%08X,%d", &id, &columns_count) < 2)
-        return NULL;
-
-    if (ImGuiTableSettings* settings = ImGui::TableSettingsFindByID(id))
+    if (ImGuiTableSettings* settings = find_existing ? ImGui::TableSettingsFindByID(id) : NULL)
     {
         if (settings->ColumnsCountMax >= columns_count)
         {
@@ -3360,6 +3686,15 @@ static void* TableSettingsHandler_ReadOpen(ImGuiContext*, ImGuiSettingsHandler*,
     return ImGui::TableSettingsCreate(id, columns_count);
 }
 
+static void* TableSettingsHandler_ReadOpen(ImGuiContext*, ImGuiSettingsHandler*, const char* name)
+{
+    ImGuiID id = 0;
+    int columns_count = 0;
+    if (sscanf(name, "0x%08X,%d", &id, &columns_count) < 2)
+        return NULL;
+    return TableSettingsRecycleOrCreate(id, columns_count, true);
+}
+
 static void TableSettingsHandler_ReadLine(ImGuiContext*, ImGuiSettingsHandler*, void* entry, const char* line)
 {
     // "Column 0  UserID=0x42AD2D21 Width=100 Visible=1 Order=0 Sort=0v"
@@ -3402,7 +3737,10 @@ static void TableSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandle
         const bool save_sort    = (settings->SaveFlags & ImGuiTableFlags_Sortable) != 0;
         if (!save_size && !save_visible && !save_order && !save_sort)
             continue;
+        if (ImGui::WriteIniSettingsEntryFromCache(buf, &settings->IniOffset, &settings->IniSize))
+            continue;
 
+        const int entry_start = buf->size();
         buf->reserve(buf->size() + 30 + settings->ColumnsCount * 50); // ballpark reserve
         buf->appendf("[%s][0x%08X,%d]\n", handler->TypeName, settings->ID, settings->ColumnsCount);
         if (settings->RefScale != 0.0f)
@@ -3424,6 +3762,96 @@ static void TableSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandle
             buf->append("\n");
         }
         buf->append("\n");
+        ImGui::StoreIniSettingsEntryCache(buf, entry_start, &settings->IniOffset, &settings->IniSize);
+    }
+}
+
+// Binary entry: ID, ColumnsCount, SaveFlags, RefScale, saved columns count, then for each saved column: index and data.
+// Same columns are saved as in TableSettingsHandler_WriteAll(), so loading either format gives the same result.
+static bool TableSettingsIsColumnSaved(const ImGuiTableSettings* settings, const ImGuiTableColumnSettings* column)
+{
+    if (column->UserID != 0 || (settings->SaveFlags & (ImGuiTableFlags_Resizable | ImGuiTableFlags_Hideable | ImGuiTableFlags_Reorderable)))
+        return true;
+    return (settings->SaveFlags & ImGuiTableFlags_Sortable) && column->SortOrder != -1;
+}
+
+static void TableSettingsHandler_ReadAllBinary(ImGuiContext* ctx, ImGuiSettingsHandler*, ImGuiSettingsBinaryReader* reader)
+{
+    // Skip lookups when loading into empty settings (typically at startup)
+    ImGuiContext& g = *ctx;
+    const bool find_existing = !g.SettingsTables.empty();
+    while (reader->HasData())
+    {
+        const ImGuiID id = reader->ReadU32();
+        const int columns_count = reader->ReadS16();
+        const ImGuiTableFlags save_flags = (ImGuiTableFlags)reader->ReadU32();
+        const float ref_scale = reader->ReadFloat();
+        const int saved_columns_count = reader->ReadS16();
+        if (reader->Error || id == 0 || columns_count <= 0 || columns_count > IMGUI_TABLE_MAX_COLUMNS || saved_columns_count < 0 || saved_columns_count > columns_count)
+        {
+            reader->Error = true;
+            return;
+        }
+
+        ImGuiTableSettings* settings = TableSettingsRecycleOrCreate(id, columns_count, find_existing);
+        settings->SaveFlags = save_flags;
+        settings->RefScale = ref_scale;
+        for (int n = 0; n < saved_columns_count; n++)
+        {
+            const int column_n = reader->ReadS16();
+            ImGuiTableColumnSettings column_data;
+            column_data.UserID = reader->ReadU32();
+            column_data.WidthOrWeight = reader->ReadFloat();
+            column_data.DisplayOrder = (ImGuiTableColumnIdx)reader->ReadS16();
+            column_data.SortOrder = (ImGuiTableColumnIdx)reader->ReadS16();
+            const ImU8 column_flags = reader->ReadU8();
+            if (reader->Error || column_n < 0 || column_n >= columns_count)
+            {
+                reader->Error = true; // Data is corrupted: don't try to interpret the remaining bytes as another table
+                return;
+            }
+            column_data.Index = (ImGuiTableColumnIdx)column_n;
+            column_data.SortDirection = column_flags & 0x03;
+            column_data.IsEnabled = (column_flags >> 2) & 1;
+            column_data.IsStretch = (column_flags >> 3) & 1;
+            settings->GetColumnSettings()[column_n] = column_data;
+        }
+    }
+}
+
+static void TableSettingsHandler_WriteAllBinary(ImGuiContext* ctx, ImGuiSettingsHandler*, ImGuiSettingsBinaryWriter* writer)
+{
+    ImGuiContext& g = *ctx;
+    for (ImGuiTableSettings* settings = g.SettingsTables.begin(); settings != NULL; settings = g.SettingsTables.next_chunk(settings))
+    {
+        if (settings->ID == 0) // Skip ditched settings
+            continue;
+        if ((settings->SaveFlags & (ImGuiTableFlags_Resizable | ImGuiTableFlags_Hideable | ImGuiTableFlags_Reorderable | ImGuiTableFlags_Sortable)) == 0)
+            continue;
+
+        ImGuiTableColumnSettings* columns = settings->GetColumnSettings();
+        int saved_columns_count = 0;
+        for (int column_n = 0; column_n < settings->ColumnsCount; column_n++)
+            if (TableSettingsIsColumnSaved(settings, &columns[column_n]))
+                saved_columns_count++;
+
+        writer->WriteU32(settings->ID);
+        writer->WriteS16((ImS16)settings->ColumnsCount);
+        writer->WriteU32((ImU32)settings->SaveFlags);
+        writer->WriteFloat(settings->RefScale);
+        writer->WriteS16((ImS16)saved_columns_count);
+        for (int column_n = 0; column_n < settings->ColumnsCount; column_n++)
+        {
+            const ImGuiTableColumnSettings* column = &columns[column_n];
+            if (!TableSettingsIsColumnSaved(settings, column))
+                continue;
+            writer->WriteS16((ImS16)column_n);
+            writer->WriteU32(column->UserID);
+            writer->WriteFloat(column->WidthOrWeight);
+            writer->WriteS16((ImS16)column->DisplayOrder);
+            writer->WriteS16((ImS16)column->SortOrder);
+            writer->WriteU8((ImU8)(column->SortDirection | (column->IsEnabled << 2) | (column->IsStretch << 3)));
+        }
     }
 }
 
@@ -3438,6 +3866,8 @@ void ImGui::TableSettingsInstallHandler(ImGuiContext* context)
     ini_handler.ReadLineFn = TableSettingsHandler_ReadLine;
     ini_handler.ApplyAllFn = TableSettingsHandler_ApplyAll;
     ini_handler.WriteAllFn = TableSettingsHandler_WriteAll;
+    ini_handler.ReadAllBinaryFn = TableSettingsHandler_ReadAllBinary;
+    ini_handler.WriteAllBinaryFn = TableSettingsHandler_WriteAllBinary;
     g.SettingsHandlers.push_back(ini_handler);
 }
 
@@ -3446,6 +3876,7 @@ void ImGui::TableSettingsInstallHandler(ImGuiContext* context)
 //-------------------------------------------------------------------------
 // - TableRemove() [Internal]
 // - TableGcCompactTransientBuffers() [Internal]
+// - TableGcCalcTransientBuffersSize() [Internal]
 // - TableGcCompactSettings() [Internal]
 //-------------------------------------------------------------------------
 
@@ -3483,6 +3914,22 @@ void ImGui::TableGcCompactTransientBuffers(ImGuiTableTempData* temp_data)
     temp_data->LastTimeActive = -1.0f;
 }
 
+// Size of the buffers freed by TableGcCompactTransientBuffers()
+size_t ImGui::TableGcCalcTransientBuffersSize(ImGuiTable* table)
+{
+    IM_ASSERT(table->MemoryCompacted == false);
+    return ImVectorCapacityInBytes(table->SortSpecsMulti) + ImVectorCapacityInBytes(table->ColumnsNames.Buf);
+}
+
+size_t ImGui::TableGcCalcTransientBuffersSize(ImGuiTableTempData* temp_data)
+{
+    const ImDrawListSplitter& splitter = temp_data->DrawSplitter;
+    size_t bytes = ImVectorCapacityInBytes(splitter._Channels);
+    for (int n = 0; n < splitter._Channels.Size; n++)
+        bytes += ImVectorCapacityInBytes(splitter._Channels[n]._CmdBuffer) + ImVectorCapacityInBytes(splitter._Channels[n]._IdxBuffer);
+    return bytes;
+}
+
 // Compact and remove unused settings data (currently only used by TestEngine)
 void ImGui::TableGcCompactSettings()
 {
@@ -3542,6 +3989,8 @@ void ImGui::DebugNodeTable(ImGuiTable* table)
     BulletText("CellPaddingX: %.1f, CellSpacingX: %.1f/%.1f, OuterPaddingX: %.1f", table->CellPaddingX, table->CellSpacingX1, table->CellSpacingX2, table->OuterPaddingX);
     BulletText("HoveredColumnBody: %d, HoveredColumnBorder: %d", table->HoveredColumnBody, table->HoveredColumnBorder);
     BulletText("ResizedColumn: %d, ReorderColumn: %d, HeldHeaderColumn: %d", table->ResizedColumn, table->ReorderColumn, table->HeldHeaderColumn);
+    const int layout_count = table->LayoutWidthsCalcCount + table->LayoutWidthsSkipCount;
+    BulletText("Layout widths: %d calculated, %d skipped (%.0f%%)", table->LayoutWidthsCalcCount, table->LayoutWidthsSkipCount, layout_count > 0 ? table->LayoutWidthsSkipCount * 100.0f / layout_count : 0.0f);
     //BulletText("BgDrawChannels: %d/%d", 0, table->BgDrawChannelUnfrozen);
     float sum_weights = 0.0f;
     for (int n = 0; n < table->ColumnsCount; n++)
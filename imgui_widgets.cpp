@@ -127,6 +127,8 @@ static const ImU64          IM_U64_MAX = (2ULL * 9223372036854775807LL + 1);
 static bool             InputTextFilterCharacter(unsigned int* p_char, ImGuiInputTextFlags flags, ImGuiInputTextCallback callback, void* user_data, ImGuiInputSource input_source);
 static int              InputTextCalcTextLenAndLineCount(const char* text_begin, const char** out_text_end);
 static ImVec2           InputTextCalcTextSizeW(const ImWchar* text_begin, const ImWchar* text_end, const ImWchar** remaining = NULL, ImVec2* out_offset = NULL, bool stop_on_new_line = false);
+static float            InputTextRopeCalcLineWidth(const ImGuiTextRope* rope, int line_start, int pos);
+static void             InputTextRopeRender(ImDrawList* draw_list, const ImGuiTextRope* rope, const ImVec2& pos, float clip_min_y, float clip_max_y, ImU32 col);
 
 //-------------------------------------------------------------------------
 // [SECTION] Widgets: Text, etc.
@@ -3543,6 +3545,7 @@ bool ImGui::InputDouble(const char* label, double* v, double step, double step_f
 // - InputTextWithHint()
 // - InputTextMultiline()
 // - InputTextEx() [Internal]
+// - ImGuiTextRope
 //-------------------------------------------------------------------------
 
 bool ImGui::InputText(const char* label, char* buf, size_t buf_size, ImGuiInputTextFlags flags, ImGuiInputTextCallback callback, void* user_data)
@@ -3556,6 +3559,11 @@ bool ImGui::InputTextMultiline(const char* label, char* buf, size_t buf_size, co
     return InputTextEx(label, NULL, buf, (int)buf_size, size, flags | ImGuiInputTextFlags_Multiline, callback, user_data);
 }
 
+bool ImGui::InputTextMultiline(const char* label, ImGuiTextRope* rope, const ImVec2& size, ImGuiInputTextFlags flags)
+{
+    return InputTextEx(label, NULL, NULL, 0, size, flags | ImGuiInputTextFlags_Multiline, NULL, NULL, rope);
+}
+
 bool ImGui::InputTextWithHint(const char* label, const char* hint, char* buf, size_t buf_size, ImGuiInputTextFlags flags, ImGuiInputTextCallback callback, void* user_data)
 {
     IM_ASSERT(!(flags & ImGuiInputTextFlags_Multiline)); // call InputTextMultiline()
@@ -3621,32 +3629,95 @@ static ImVec2 InputTextCalcTextSizeW(const ImWchar* text_begin, const ImWchar* t
     return text_size;
 }
 
+// Width of the [line_start, pos) section of a line of a ImGuiTextRope
+static float InputTextRopeCalcLineWidth(const ImGuiTextRope* rope, int line_start, int pos)
+{
+    if (pos <= line_start)
+        return 0.0f;
+    ImWchar* text = (ImWchar*)ImGui::MemAllocFrame((size_t)(pos - line_start) * sizeof(ImWchar));
+    const int text_len = rope->GetChars(line_start, pos - line_start, text);
+    return InputTextCalcTextSizeW(text, text + text_len, NULL, NULL, true).x;
+}
+
+// Render the lines of a ImGuiTextRope overlapping [clip_min_y, clip_max_y). Cost is O(visible lines), not O(text size).
+static void InputTextRopeRender(ImDrawList* draw_list, const ImGuiTextRope* rope, const ImVec2& pos, float clip_min_y, float clip_max_y, ImU32 col)
+{
+    ImGuiContext& g = *GImGui;
+    const int line_count = rope->GetLineCount();
+    const int line_first = ImMax((int)ImFloor((clip_min_y - pos.y) / g.FontSize), 0);
+    const int line_last = ImMin((int)ImFloor((clip_max_y - pos.y) / g.FontSize), line_count - 1);
+    if (line_first > line_last)
+        return;
+
+    const int text_start = rope->GetLineStart(line_first);
+    const int text_len = rope->GetLineStart(line_last + 1) - text_start;
+    ImWchar* text_w = (ImWchar*)ImGui::MemAllocFrame((size_t)(text_len + 1) * sizeof(ImWchar));
+    rope->GetChars(text_start, text_len, text_w);
+    text_w[text_len] = 0;
+    const int text_a_size = ImTextCountUtf8BytesFromStr(text_w, text_w + text_len) + 1;
+    char* text_a = (char*)ImGui::MemAllocFrame((size_t)text_a_size);
+    const int text_a_len = ImTextStrToUtf8(text_a, text_a_size, text_w, text_w + text_len);
+    draw_list->AddText(g.Font, g.FontSize, ImVec2(pos.x, pos.y + line_first * g.FontSize), col, text_a, text_a + text_a_len);
+}
+
 // Wrapper for stb_textedit.h to edit text (our wrapper is for: statically sized buffer, single-line, wchar characters. InputText converts between UTF-8 and wchar)
 namespace ImStb
 {
 
 static int     STB_TEXTEDIT_STRINGLEN(const ImGuiInputTextState* obj)                             { return obj->CurLenW; }
-static ImWchar STB_TEXTEDIT_GETCHAR(const ImGuiInputTextState* obj, int idx)                      { return obj->TextW[idx]; }
-static float   STB_TEXTEDIT_GETWIDTH(ImGuiInputTextState* obj, int line_start_idx, int char_idx)  { ImWchar c = obj->TextW[line_start_idx + char_idx]; if (c == '\n') return STB_TEXTEDIT_GETWIDTH_NEWLINE; ImGuiContext& g = *GImGui; return g.Font->GetCharAdvance(c) * (g.FontSize / g.Font->FontSize); }
+static ImWchar STB_TEXTEDIT_GETCHAR(const ImGuiInputTextState* obj, int idx)                      { if (obj->Rope) return (idx < obj->CurLenW) ? obj->Rope->GetChar(idx) : 0; return obj->TextW[idx]; }
+static float   STB_TEXTEDIT_GETWIDTH(ImGuiInputTextState* obj, int line_start_idx, int char_idx)  { ImWchar c = STB_TEXTEDIT_GETCHAR(obj, line_start_idx + char_idx); if (c == '\n') return STB_TEXTEDIT_GETWIDTH_NEWLINE; ImGuiContext& g = *GImGui; return g.Font->GetCharAdvance(c) * (g.FontSize / g.Font->FontSize); }
 static int     STB_TEXTEDIT_KEYTOTEXT(int key)                                                    { return key >= 0x200000 ? 0 : key; }
 static ImWchar STB_TEXTEDIT_NEWLINE = '\n';
 static void    STB_TEXTEDIT_LAYOUTROW(StbTexteditRow* r, ImGuiInputTextState* obj, int line_start_idx)
 {
-    const ImWchar* text = obj->TextW.Data;
+    const ImWchar* text;
+    const ImWchar* text_end;
+    if (ImGuiTextRope* rope = obj->Rope)
+    {
+        // Copy the line to our scratch buffer to measure it
+        const int line_len = rope->GetLineStart(rope->GetLineFromPos(line_start_idx) + 1) - line_start_idx;
+        obj->TextW.resize(line_len + 1);
+        text = obj->TextW.Data;
+        text_end = text + rope->GetChars(line_start_idx, line_len, obj->TextW.Data);
+    }
+    else
+    {
+        text = obj->TextW.Data + line_start_idx;
+        text_end = obj->TextW.Data + obj->CurLenW;
+    }
     const ImWchar* text_remaining = NULL;
-    const ImVec2 size = InputTextCalcTextSizeW(text + line_start_idx, text + obj->CurLenW, &text_remaining, NULL, true);
+    const ImVec2 size = InputTextCalcTextSizeW(text, text_end, &text_remaining, NULL, true);
     r->x0 = 0.0f;
     r->x1 = size.x;
     r->baseline_y_delta = size.y;
     r->ymin = 0.0f;
     r->ymax = size.y;
-    r->num_chars = (int)(text_remaining - (text + line_start_idx));
+    r->num_chars = (int)(text_remaining - text);
+}
+
+// Rows are lines as we don't wrap text, so with a ImGuiTextRope we can find the line of the mouse or cursor without laying out previous lines.
+static int     STB_TEXTEDIT_ROWSTART_AT_Y_IMPL(ImGuiInputTextState* obj, float y, float* out_row_y)
+{
+    ImGuiContext& g = *GImGui;
+    const int line_n = obj->Rope ? ImClamp((int)(y / g.FontSize) - 1, 0, obj->Rope->GetLineCount() - 1) : 0; // Start one line above to not depend on rounding
+    *out_row_y = line_n * g.FontSize;
+    return obj->Rope ? obj->Rope->GetLineStart(line_n) : 0;
 }
+static int     STB_TEXTEDIT_ROWSTART_BEFORE_CHAR_IMPL(ImGuiInputTextState* obj, int idx, float* out_row_y)
+{
+    ImGuiContext& g = *GImGui;
+    const int line_n = obj->Rope ? ImMax(obj->Rope->GetLineFromPos(idx) - 1, 0) : 0;
+    *out_row_y = line_n * g.FontSize;
+    return obj->Rope ? obj->Rope->GetLineStart(line_n) : 0;
+}
+#define STB_TEXTEDIT_ROWSTART_AT_Y          STB_TEXTEDIT_ROWSTART_AT_Y_IMPL          // They need to be #define for stb_textedit.h
+#define STB_TEXTEDIT_ROWSTART_BEFORE_CHAR   STB_TEXTEDIT_ROWSTART_BEFORE_CHAR_IMPL
 
 // When ImGuiInputTextFlags_Password is set, we don't want actions such as CTRL+Arrow to leak the fact that underlying data are blanks or separators.
 static bool is_separator(unsigned int c)                                        { return ImCharIsBlankW(c) || c==',' || c==';' || c=='(' || c==')' || c=='{' || c=='}' || c=='[' || c==']' || c=='|' || c=='\n' || c=='\r'; }
-static int  is_word_boundary_from_right(ImGuiInputTextState* obj, int idx)      { if (obj->Flags & ImGuiInputTextFlags_Password) return 0; return idx > 0 ? (is_separator(obj->TextW[idx - 1]) && !is_separator(obj->TextW[idx]) ) : 1; }
-static int  is_word_boundary_from_left(ImGuiInputTextState* obj, int idx)       { if (obj->Flags & ImGuiInputTextFlags_Password) return 0; return idx > 0 ? (!is_separator(obj->TextW[idx - 1]) && is_separator(obj->TextW[idx])) : 1; }
+static int  is_word_boundary_from_right(ImGuiInputTextState* obj, int idx)      { if (obj->Flags & ImGuiInputTextFlags_Password) return 0; return idx > 0 ? (is_separator(STB_TEXTEDIT_GETCHAR(obj, idx - 1)) && !is_separator(STB_TEXTEDIT_GETCHAR(obj, idx)) ) : 1; }
+static int  is_word_boundary_from_left(ImGuiInputTextState* obj, int idx)       { if (obj->Flags & ImGuiInputTextFlags_Password) return 0; return idx > 0 ? (!is_separator(STB_TEXTEDIT_GETCHAR(obj, idx - 1)) && is_separator(STB_TEXTEDIT_GETCHAR(obj, idx))) : 1; }
 static int  STB_TEXTEDIT_MOVEWORDLEFT_IMPL(ImGuiInputTextState* obj, int idx)   { idx--; while (idx >= 0 && !is_word_boundary_from_right(obj, idx)) idx--; return idx < 0 ? 0 : idx; }
 static int  STB_TEXTEDIT_MOVEWORDRIGHT_MAC(ImGuiInputTextState* obj, int idx)   { idx++; int len = obj->CurLenW; while (idx < len && !is_word_boundary_from_left(obj, idx)) idx++; return idx > len ? len : idx; }
 #define STB_TEXTEDIT_MOVEWORDLEFT   STB_TEXTEDIT_MOVEWORDLEFT_IMPL    // They need to be #define for stb_textedit.h
@@ -3659,6 +3730,14 @@ static int  STB_TEXTEDIT_MOVEWORDRIGHT_WIN(ImGuiInputTextState* obj, int idx)
 
 static void STB_TEXTEDIT_DELETECHARS(ImGuiInputTextState* obj, int pos, int n)
 {
+    if (obj->Rope)
+    {
+        obj->Rope->DeleteChars(pos, n);
+        obj->Edited = true;
+        obj->CurLenW -= n;
+        return;
+    }
+
     ImWchar* dst = obj->TextW.Data + pos;
 
     // We maintain our buffer length in both UTF-8 and wchar formats
@@ -3675,6 +3754,14 @@ static void STB_TEXTEDIT_DELETECHARS(ImGuiInputTextState* obj, int pos, int n)
 
 static bool STB_TEXTEDIT_INSERTCHARS(ImGuiInputTextState* obj, int pos, const ImWchar* new_text, int new_text_len)
 {
+    if (obj->Rope)
+    {
+        obj->Rope->InsertChars(pos, new_text, new_text_len);
+        obj->Edited = true;
+        obj->CurLenW += new_text_len;
+        return true;
+    }
+
     const bool is_resizable = (obj->Flags & ImGuiInputTextFlags_CallbackResize) != 0;
     const int text_len = obj->CurLenW;
     IM_ASSERT(pos <= text_len);
@@ -3908,13 +3995,16 @@ static bool InputTextFilterCharacter(unsigned int* p_char, ImGuiInputTextFlags f
 // - If you want to use ImGui::InputText() with std::string, see misc/cpp/imgui_stdlib.h
 // (FIXME: Rather confusing and messy function, among the worse part of our codebase, expecting to rewrite a V2 at some point.. Partly because we are
 //  doing UTF8 > U16 > UTF8 conversions on the go to easily interface with stb_textedit. Ideally should stay in UTF-8 all the time. See https://github.com/nothings/stb/issues/188)
-bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_size, const ImVec2& size_arg, ImGuiInputTextFlags flags, ImGuiInputTextCallback callback, void* callback_user_data)
+// - When 'rope' is set (see ImGuiTextRope), the text is edited in place in the rope and 'buf' is ignored.
+bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_size, const ImVec2& size_arg, ImGuiInputTextFlags flags, ImGuiInputTextCallback callback, void* callback_user_data, ImGuiTextRope* rope)
 {
+    IMGUI_MEM_TAG_SCOPE(ImGuiMemTag_InputText);
     ImGuiWindow* window = GetCurrentWindow();
     if (window->SkipItems)
         return false;
 
-    IM_ASSERT(buf != NULL && buf_size >= 0);
+    IM_ASSERT((buf != NULL && buf_size >= 0) || rope != NULL);
+    IM_ASSERT(rope == NULL || ((flags & ImGuiInputTextFlags_Multiline) && hint == NULL && callback == NULL)); // Only InputTextMultiline() supports a ImGuiTextRope, without callbacks
     IM_ASSERT(!((flags & ImGuiInputTextFlags_CallbackHistory) && (flags & ImGuiInputTextFlags_Multiline)));        // Can't use both together (they both use up/down keys)
     IM_ASSERT(!((flags & ImGuiInputTextFlags_CallbackCompletion) && (flags & ImGuiInputTextFlags_AllowTabInput))); // Can't use both together (they both use tab key)
 
@@ -4014,19 +4104,33 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         state = &g.InputTextState;
         state->CursorAnimReset();
 
-        // Take a copy of the initial buffer value (both in original UTF-8 format and converted to wchar)
-        // From the moment we focused we are ignoring the content of 'buf' (unless we are in read-only mode)
-        const int buf_len = (int)strlen(buf);
-        state->InitialTextA.resize(buf_len + 1);    // UTF-8. we use +1 to make sure that .Data is always pointing to at least an empty string.
-        memcpy(state->InitialTextA.Data, buf, buf_len + 1);
-
-        // Start edition
-        const char* buf_end = NULL;
-        state->TextW.resize(buf_size + 1);          // wchar count <= UTF-8 count. we use +1 to make sure that .Data is always pointing to at least an empty string.
-        state->TextA.resize(0);
-        state->TextAIsValid = false;                // TextA is not valid yet (we will display buf until then)
-        state->CurLenW = ImTextStrFromUtf8(state->TextW.Data, buf_size, buf, NULL, &buf_end);
-        state->CurLenA = (int)(buf_end - buf);      // We can't get the result from ImStrncpy() above because it is not UTF-8 aware. Here we'll cut off malformed UTF-8.
+        state->Rope = rope;
+        if (rope != NULL)
+        {
+            // Edit the rope in place: there is nothing to copy or convert
+            state->InitialTextA.resize(1);
+            state->InitialTextA[0] = 0;
+            state->TextA.resize(0);
+            state->TextAIsValid = false;
+            state->CurLenW = rope->Size();
+            state->CurLenA = 0;
+        }
+        else
+        {
+            // Take a copy of the initial buffer value (both in original UTF-8 format and converted to wchar)
+            // From the moment we focused we are ignoring the content of 'buf' (unless we are in read-only mode)
+            const int buf_len = (int)strlen(buf);
+            state->InitialTextA.resize(buf_len + 1);    // UTF-8. we use +1 to make sure that .Data is always pointing to at least an empty string.
+            memcpy(state->InitialTextA.Data, buf, buf_len + 1);
+
+            // Start edition
+            const char* buf_end = NULL;
+            state->TextW.resize(buf_size + 1);          // wchar count <= UTF-8 count. we use +1 to make sure that .Data is always pointing to at least an empty string.
+            state->TextA.resize(0);
+            state->TextAIsValid = false;                // TextA is not valid yet (we will display buf until then)
+            state->CurLenW = ImTextStrFromUtf8(state->TextW.Data, buf_size, buf, NULL, &buf_end);
+            state->CurLenA = (int)(buf_end - buf);      // We can't get the result from ImStrncpy() above because it is not UTF-8 aware. Here we'll cut off malformed UTF-8.
+        }
 
         // Preserve cursor position and undo/redo stack if we come back to same widget
         // FIXME: For non-readonly widgets we might be able to require that TextAIsValid && TextA == buf ? (untested) and discard undo stack if user buffer has changed.
@@ -4100,7 +4204,18 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
 
     // When read-only we always use the live data passed to the function
     // FIXME-OPT: Because our selection/cursor code currently needs the wide text we need to convert it when active, which is not ideal :(
-    if (is_readonly && state != NULL && (render_cursor || render_selection))
+    if (rope != NULL && state != NULL)
+    {
+        // The rope may have been modified by the application while read-only (e.g. appending to a log)
+        state->Rope = rope;
+        if (state->CurLenW != rope->Size())
+        {
+            state->CurLenW = rope->Size();
+            state->CursorClamp();
+        }
+        render_selection &= state->HasSelection();
+    }
+    else if (is_readonly && state != NULL && (render_cursor || render_selection))
     {
         const char* buf_end = NULL;
         state->TextW.resize(buf_size + 1);
@@ -4329,11 +4444,19 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
             {
                 const int ib = state->HasSelection() ? ImMin(state->Stb.select_start, state->Stb.select_end) : 0;
                 const int ie = state->HasSelection() ? ImMax(state->Stb.select_start, state->Stb.select_end) : state->CurLenW;
-                const int clipboard_data_len = ImTextCountUtf8BytesFromStr(state->TextW.Data + ib, state->TextW.Data + ie) + 1;
-                char* clipboard_data = (char*)IM_ALLOC(clipboard_data_len * sizeof(char));
-                ImTextStrToUtf8(clipboard_data, clipboard_data_len, state->TextW.Data + ib, state->TextW.Data + ie);
-                SetClipboardText(clipboard_data);
-                MemFree(clipboard_data);
+                if (rope != NULL)
+                {
+                    ImGuiTextBuffer clipboard_data;
+                    rope->GetText(&clipboard_data, ib, ie - ib);
+                    SetClipboardText(clipboard_data.c_str());
+                }
+                else
+                {
+                    const int clipboard_data_len = ImTextCountUtf8BytesFromStr(state->TextW.Data + ib, state->TextW.Data + ie) + 1;
+                    char* clipboard_data = (char*)MemAllocFrame(clipboard_data_len * sizeof(char));
+                    ImTextStrToUtf8(clipboard_data, clipboard_data_len, state->TextW.Data + ib, state->TextW.Data + ie);
+                    SetClipboardText(clipboard_data);
+                }
             }
             if (is_cut)
             {
@@ -4349,7 +4472,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
             {
                 // Filter pasted buffer
                 const int clipboard_len = (int)strlen(clipboard);
-                ImWchar* clipboard_filtered = (ImWchar*)IM_ALLOC((clipboard_len + 1) * sizeof(ImWchar));
+                ImWchar* clipboard_filtered = (ImWchar*)MemAllocFrame((clipboard_len + 1) * sizeof(ImWchar));
                 int clipboard_filtered_len = 0;
                 for (const char* s = clipboard; *s; )
                 {
@@ -4367,7 +4490,6 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                     stb_textedit_paste(state, &state->Stb, clipboard_filtered, clipboard_filtered_len);
                     state->CursorFollow = true;
                 }
-                MemFree(clipboard_filtered);
             }
         }
 
@@ -4378,7 +4500,15 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
     // Process callbacks and apply result back to user's buffer.
     const char* apply_new_text = NULL;
     int apply_new_text_length = 0;
-    if (g.ActiveId == id)
+    if (g.ActiveId == id && rope != NULL)
+    {
+        // Edits were applied in place to the rope. Cancelling doesn't restore the initial text, which would require a copy of it.
+        // Unlike the buffer path we don't compare with the previous text, so any edit reports a change even if the text ends up identical.
+        IM_ASSERT(state != NULL);
+        value_changed = state->Edited;
+        state->Flags = ImGuiInputTextFlags_None;
+    }
+    else if (g.ActiveId == id)
     {
         IM_ASSERT(state != NULL);
         if (cancel_edit)
@@ -4389,13 +4519,15 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                 // Push records into the undo stack so we can CTRL+Z the revert operation itself
                 apply_new_text = state->InitialTextA.Data;
                 apply_new_text_length = state->InitialTextA.Size - 1;
-                ImVector<ImWchar> w_text;
+                ImWchar* w_text = NULL;
+                int w_text_len = 0;
                 if (apply_new_text_length > 0)
                 {
-                    w_text.resize(ImTextCountCharsFromUtf8(apply_new_text, apply_new_text + apply_new_text_length) + 1);
-                    ImTextStrFromUtf8(w_text.Data, w_text.Size, apply_new_text, apply_new_text + apply_new_text_length);
+                    const int w_text_size = ImTextCountCharsFromUtf8(apply_new_text, apply_new_text + apply_new_text_length) + 1;
+                    w_text = (ImWchar*)MemAllocFrame(w_text_size * sizeof(ImWchar));
+                    w_text_len = ImTextStrFromUtf8(w_text, w_text_size, apply_new_text, apply_new_text + apply_new_text_length);
                 }
-                stb_textedit_replace(state, &state->Stb, w_text.Data, (apply_new_text_length > 0) ? (w_text.Size - 1) : 0);
+                stb_textedit_replace(state, &state->Stb, w_text, w_text_len);
             }
         }
 
@@ -4566,7 +4698,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
     if (render_cursor || render_selection)
     {
         IM_ASSERT(state != NULL);
-        if (!is_displaying_hint)
+        if (!is_displaying_hint && rope == NULL)
             buf_display_end = buf_display + state->CurLenA;
 
         // Render text (with cursor and selection)
@@ -4579,6 +4711,15 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         const ImWchar* text_begin = state->TextW.Data;
         ImVec2 cursor_offset, select_start_offset;
 
+        if (rope != NULL)
+        {
+            // Lines are indexed by the rope, no need to iterate the text
+            const int cursor_line = rope->GetLineFromPos(state->Stb.cursor);
+            cursor_offset.x = InputTextRopeCalcLineWidth(rope, rope->GetLineStart(cursor_line), state->Stb.cursor);
+            cursor_offset.y = (cursor_line + 1) * g.FontSize;
+            text_size = ImVec2(inner_size.x, rope->GetLineCount() * g.FontSize);
+        }
+        else
         {
             // Find lines numbers straddling 'cursor' (slot 0) and 'select_start' (slot 1) positions.
             const ImWchar* searches_input_ptr[2] = { NULL, NULL };
@@ -4666,7 +4807,32 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
 
         // Draw selection
         const ImVec2 draw_scroll = ImVec2(state->ScrollX, 0.0f);
-        if (render_selection)
+        if (render_selection && rope != NULL && state->HasSelection())
+        {
+            // Only visit visible lines of the selection
+            const int sel_min = ImMin(state->Stb.select_start, state->Stb.select_end);
+            const int sel_max = ImMax(state->Stb.select_start, state->Stb.select_end);
+            const int line_visible_first = ImMax((int)ImFloor((clip_rect.y - draw_pos.y) / g.FontSize), 0);
+            const int line_visible_last = (int)ImFloor((clip_rect.w - draw_pos.y) / g.FontSize);
+            const int line_first = ImMax(rope->GetLineFromPos(sel_min), line_visible_first);
+            const int line_last = ImMin(rope->GetLineFromPos(sel_max - 1), line_visible_last);
+            ImU32 bg_color = GetColorU32(ImGuiCol_TextSelectedBg, render_cursor ? 1.0f : 0.6f);
+            for (int line_n = line_first; line_n <= line_last; line_n++)
+            {
+                const int line_start = rope->GetLineStart(line_n);
+                const int seg_start = ImMax(sel_min, line_start);
+                const int seg_end = ImMin(sel_max, rope->GetLineStart(line_n + 1));
+                const float x0 = InputTextRopeCalcLineWidth(rope, line_start, seg_start);
+                float w = InputTextRopeCalcLineWidth(rope, seg_start, seg_end);
+                if (w <= 0.0f) w = IM_FLOOR(g.Font->GetCharAdvance((ImWchar)' ') * 0.50f); // So we can see selected empty lines
+                ImVec2 rect_pos = draw_pos - draw_scroll + ImVec2(x0, line_n * g.FontSize);
+                ImRect rect(rect_pos, rect_pos + ImVec2(w, g.FontSize));
+                rect.ClipWith(clip_rect);
+                if (rect.Overlaps(clip_rect))
+                    draw_window->DrawList->AddRectFilled(rect.Min, rect.Max, bg_color);
+            }
+        }
+        else if (render_selection && rope == NULL)
         {
             const ImWchar* text_selected_begin = text_begin + ImMin(state->Stb.select_start, state->Stb.select_end);
             const ImWchar* text_selected_end = text_begin + ImMax(state->Stb.select_start, state->Stb.select_end);
@@ -4702,7 +4868,11 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         }
 
         // We test for 'buf_display_max_length' as a way to avoid some pathological cases (e.g. single-line 1 MB string) which would make ImDrawList crash.
-        if (is_multiline || (buf_display_end - buf_display) < buf_display_max_length)
+        if (rope != NULL)
+        {
+            InputTextRopeRender(draw_window->DrawList, rope, draw_pos - draw_scroll, clip_rect.y, clip_rect.w, GetColorU32(ImGuiCol_Text));
+        }
+        else if (is_multiline || (buf_display_end - buf_display) < buf_display_max_length)
         {
             ImU32 col = GetColorU32(is_displaying_hint ? ImGuiCol_TextDisabled : ImGuiCol_Text);
             draw_window->DrawList->AddText(g.Font, g.FontSize, draw_pos - draw_scroll, col, buf_display, buf_display_end, 0.0f, is_multiline ? NULL : &clip_rect);
@@ -4731,14 +4901,19 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
     else
     {
         // Render text only (no selection, no cursor)
-        if (is_multiline)
+        if (rope != NULL)
+        {
+            text_size = ImVec2(inner_size.x, rope->GetLineCount() * g.FontSize);
+            InputTextRopeRender(draw_window->DrawList, rope, draw_pos, clip_rect.y, clip_rect.w, GetColorU32(ImGuiCol_Text));
+        }
+        else if (is_multiline)
             text_size = ImVec2(inner_size.x, InputTextCalcTextLenAndLineCount(buf_display, &buf_display_end) * g.FontSize); // We don't need width
         else if (!is_displaying_hint && g.ActiveId == id)
             buf_display_end = buf_display + state->CurLenA;
         else if (!is_displaying_hint)
             buf_display_end = buf_display + strlen(buf_display);
 
-        if (is_multiline || (buf_display_end - buf_display) < buf_display_max_length)
+        if (rope == NULL && (is_multiline || (buf_display_end - buf_display) < buf_display_max_length))
         {
             ImU32 col = GetColorU32(is_displaying_hint ? ImGuiCol_TextDisabled : ImGuiCol_Text);
             draw_window->DrawList->AddText(g.Font, g.FontSize, draw_pos, col, buf_display, buf_display_end, 0.0f, is_multiline ? NULL : &clip_rect);
@@ -4773,7 +4948,16 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
     if (g.LogEnabled && (!is_password || is_displaying_hint))
     {
         LogSetNextTextDecoration("{", "}");
-        LogRenderedText(&draw_pos, buf_display, buf_display_end);
+        if (rope != NULL)
+        {
+            ImGuiTextBuffer log_text;
+            rope->GetText(&log_text);
+            LogRenderedText(&draw_pos, log_text.begin(), log_text.end());
+        }
+        else
+        {
+            LogRenderedText(&draw_pos, buf_display, buf_display_end);
+        }
     }
 
     if (label_size.x > 0)
@@ -4789,6 +4973,379 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         return value_changed;
 }
 
+// ImGuiTextRope: text is stored in chunks of at most TEXT_ROPE_CHUNK_CAPACITY characters, each owning a fixed slot of Chars[].
+// Insertions/deletions move characters within one chunk and update the Fenwick trees in O(log N).
+// Splitting or merging chunks shifts the (small) chunk descriptors and rebuilds the trees, which amortizes over many edits.
+
+static const int TEXT_ROPE_CHUNK_CAPACITY = 1024;
+static const int TEXT_ROPE_CHUNK_FILL = 768;        // Size of chunks created by SetText() and splits, leaving room for insertions
+
+static int TextRopeCountNewlines(const ImWchar* text, const ImWchar* text_end)
+{
+    int count = 0;
+    for (const ImWchar* s = text; s < text_end; s++)
+        if (*s == '\n')
+            count++;
+    return count;
+}
+
+static int TextRopeAllocChunk(ImGuiTextRope* rope)
+{
+    if (rope->FreeOffsets.Size > 0)
+    {
+        const int offset = rope->FreeOffsets.back();
+        rope->FreeOffsets.pop_back();
+        return offset;
+    }
+    const int offset = rope->Chars.Size;
+    rope->Chars.resize(offset + TEXT_ROPE_CHUNK_CAPACITY);
+    return offset;
+}
+
+// Build both trees in O(N): each node adds itself to its parent.
+static void TextRopeBuildTrees(ImGuiTextRope* rope)
+{
+    const int count = rope->Chunks.Size;
+    rope->SizeTree.resize(count);
+    rope->NewlineTree.resize(count);
+    for (int n = 0; n < count; n++)
+    {
+        rope->SizeTree[n] = rope->Chunks[n].Size;
+        rope->NewlineTree[n] = rope->Chunks[n].NewlineCount;
+    }
+    for (int n = 1; n <= count; n++)
+    {
+        const int parent = n + (n & -n);
+        if (parent <= count)
+        {
+            rope->SizeTree[parent - 1] += rope->SizeTree[n - 1];
+            rope->NewlineTree[parent - 1] += rope->NewlineTree[n - 1];
+        }
+    }
+}
+
+static void TextRopeAddToChunk(ImGuiTextRope* rope, int chunk_n, int size_delta, int newline_delta)
+{
+    rope->Chunks[chunk_n].Size += size_delta;
+    rope->Chunks[chunk_n].NewlineCount += newline_delta;
+    rope->TextSize += size_delta;
+    rope->NewlineCount += newline_delta;
+    for (int n = chunk_n + 1; n <= rope->SizeTree.Size; n += n & -n)
+    {
+        rope->SizeTree[n - 1] += size_delta;
+        rope->NewlineTree[n - 1] += newline_delta;
+    }
+}
+
+static int TextRopeGetTreeStep(int count)
+{
+    int step = 1;
+    while (step <= count / 2)
+        step <<= 1;
+    return step;
+}
+
+// Descend the trees to find the chunk containing the character at 'pos', and the number of characters/newlines before it.
+// 'pos == TextSize' is located at the end of the last chunk.
+static int TextRopeFindChunkAtPos(const ImGuiTextRope* rope, int pos, int* out_chunk_start, int* out_newlines_before)
+{
+    const int count = rope->Chunks.Size;
+    if (count > 0 && pos >= rope->TextSize)
+    {
+        const ImGuiTextRopeChunk* last_chunk = &rope->Chunks[count - 1];
+        *out_chunk_start = rope->TextSize - last_chunk->Size;
+        *out_newlines_before = rope->NewlineCount - last_chunk->NewlineCount;
+        return count - 1;
+    }
+    int n = 0, chunk_start = 0, newlines_before = 0;
+    for (int step = TextRopeGetTreeStep(count); step > 0; step >>= 1)
+        if (n + step <= count && chunk_start + rope->SizeTree[n + step - 1] <= pos)
+        {
+            n += step;
+            chunk_start += rope->SizeTree[n - 1];
+            newlines_before += rope->NewlineTree[n - 1];
+        }
+    *out_chunk_start = chunk_start;
+    *out_newlines_before = newlines_before;
+    return n;
+}
+
+// Descend the trees to find the chunk containing the newline #newline_n (0-based), and the number of characters/newlines before it.
+static int TextRopeFindChunkAtNewline(const ImGuiTextRope* rope, int newline_n, int* out_chunk_start, int* out_newlines_before)
+{
+    IM_ASSERT(newline_n >= 0 && newline_n < rope->NewlineCount);
+    const int count = rope->Chunks.Size;
+    int n = 0, chunk_start = 0, newlines_before = 0;
+    for (int step = TextRopeGetTreeStep(count); step > 0; step >>= 1)
+        if (n + step <= count && newlines_before + rope->NewlineTree[n + step - 1] <= newline_n)
+        {
+            n += step;
+            chunk_start += rope->SizeTree[n - 1];
+            newlines_before += rope->NewlineTree[n - 1];
+        }
+    *out_chunk_start = chunk_start;
+    *out_newlines_before = newlines_before;
+    return n;
+}
+
+// Merge a small chunk with a neighbor, so that deleting text doesn't leave many small chunks behind
+static void TextRopeMergeSmallChunk(ImGuiTextRope* rope, int chunk_n)
+{
+    if (chunk_n < 0 || chunk_n >= rope->Chunks.Size || rope->Chunks[chunk_n].Size >= TEXT_ROPE_CHUNK_CAPACITY / 4)
+        return;
+    int dst_n = -1;
+    if (chunk_n + 1 < rope->Chunks.Size && rope->Chunks[chunk_n].Size + rope->Chunks[chunk_n + 1].Size <= TEXT_ROPE_CHUNK_FILL)
+        dst_n = chunk_n;
+    else if (chunk_n > 0 && rope->Chunks[chunk_n - 1].Size + rope->Chunks[chunk_n].Size <= TEXT_ROPE_CHUNK_FILL)
+        dst_n = chunk_n - 1;
+    if (dst_n == -1)
+        return;
+    ImGuiTextRopeChunk* dst = &rope->Chunks[dst_n];
+    ImGuiTextRopeChunk* src = &rope->Chunks[dst_n + 1];
+    memcpy(rope->Chars.Data + dst->Offset + dst->Size, rope->Chars.Data + src->Offset, (size_t)src->Size * sizeof(ImWchar));
+    dst->Size += src->Size;
+    dst->NewlineCount += src->NewlineCount;
+    rope->FreeOffsets.push_back(src->Offset);
+    rope->Chunks.erase(src);
+    TextRopeBuildTrees(rope);
+}
+
+void ImGuiTextRope::Clear()
+{
+    Chars.clear();
+    Chunks.clear();
+    FreeOffsets.clear();
+    SizeTree.clear();
+    NewlineTree.clear();
+    TextSize = NewlineCount = 0;
+}
+
+void ImGuiTextRope::SetText(const char* text, const char* text_end)
+{
+    Clear();
+    if (text_end == NULL)
+        text_end = text + strlen(text);
+    while (text < text_end && *text)
+    {
+        ImGuiTextRopeChunk chunk;
+        chunk.Offset = TextRopeAllocChunk(this);
+        ImWchar* chars = Chars.Data + chunk.Offset;
+        chunk.Size = ImTextStrFromUtf8(chars, TEXT_ROPE_CHUNK_FILL + 1, text, text_end, &text); // Writes a zero-terminator, which fits as FILL < CAPACITY
+        chunk.NewlineCount = TextRopeCountNewlines(chars, chars + chunk.Size);
+        if (chunk.Size == 0)
+        {
+            FreeOffsets.push_back(chunk.Offset);
+            break;
+        }
+        Chunks.push_back(chunk);
+        TextSize += chunk.Size;
+        NewlineCount += chunk.NewlineCount;
+    }
+    TextRopeBuildTrees(this);
+}
+
+void ImGuiTextRope::GetText(ImGuiTextBuffer* out, int pos, int count) const
+{
+    IM_ASSERT(pos >= 0 && pos <= TextSize);
+    if (count < 0 || count > TextSize - pos)
+        count = TextSize - pos;
+    if (count == 0)
+        return;
+    int chunk_start, newlines_before;
+    int chunk_n = TextRopeFindChunkAtPos(this, pos, &chunk_start, &newlines_before);
+    int pos_in_chunk = pos - chunk_start;
+    char utf8_buf[TEXT_ROPE_CHUNK_CAPACITY * 4 + 1];
+    for (; count > 0; chunk_n++, pos_in_chunk = 0)
+    {
+        const ImGuiTextRopeChunk* chunk = &Chunks[chunk_n];
+        const int copy_count = ImMin(count, chunk->Size - pos_in_chunk);
+        const ImWchar* chars = Chars.Data + chunk->Offset + pos_in_chunk;
+        const int utf8_len = ImTextStrToUtf8(utf8_buf, IM_ARRAYSIZE(utf8_buf), chars, chars + copy_count);
+        out->append(utf8_buf, utf8_buf + utf8_len);
+        count -= copy_count;
+    }
+}
+
+ImWchar ImGuiTextRope::GetChar(int pos) const
+{
+    IM_ASSERT(pos >= 0 && pos < TextSize);
+    int chunk_start, newlines_before;
+    const int chunk_n = TextRopeFindChunkAtPos(this, pos, &chunk_start, &newlines_before);
+    return Chars[Chunks[chunk_n].Offset + pos - chunk_start];
+}
+
+int ImGuiTextRope::GetChars(int pos, int count, ImWchar* out) const
+{
+    IM_ASSERT(pos >= 0 && pos <= TextSize && count >= 0);
+    count = ImMin(count, TextSize - pos);
+    if (count == 0)
+        return 0;
+    int chunk_start, newlines_before;
+    int chunk_n = TextRopeFindChunkAtPos(this, pos, &chunk_start, &newlines_before);
+    int pos_in_chunk = pos - chunk_start;
+    for (int remaining = count; remaining > 0; chunk_n++, pos_in_chunk = 0)
+    {
+        const ImGuiTextRopeChunk* chunk = &Chunks[chunk_n];
+        const int copy_count = ImMin(remaining, chunk->Size - pos_in_chunk);
+        memcpy(out, Chars.Data + chunk->Offset + pos_in_chunk, (size_t)copy_count * sizeof(ImWchar));
+        out += copy_count;
+        remaining -= copy_count;
+    }
+    return count;
+}
+
+int ImGuiTextRope::GetLineStart(int line_n) const
+{
+    IM_ASSERT(line_n >= 0 && line_n <= NewlineCount + 1);
+    if (line_n == 0)
+        return 0;
+    if (line_n > NewlineCount)
+        return TextSize;
+
+    // Line starts after the newline #(line_n - 1)
+    int chunk_start, newlines_before;
+    const int chunk_n = TextRopeFindChunkAtNewline(this, line_n - 1, &chunk_start, &newlines_before);
+    const ImWchar* chars = Chars.Data + Chunks[chunk_n].Offset;
+    int newlines_remaining = line_n - 1 - newlines_before;
+    for (int pos_in_chunk = 0; ; pos_in_chunk++)
+        if (chars[pos_in_chunk] == '\n' && newlines_remaining-- == 0)
+            return chunk_start + pos_in_chunk + 1;
+}
+
+int ImGuiTextRope::GetLineFromPos(int pos) const
+{
+    IM_ASSERT(pos >= 0 && pos <= TextSize);
+    if (Chunks.Size == 0)
+        return 0;
+    int chunk_start, newlines_before;
+    const int chunk_n = TextRopeFindChunkAtPos(this, pos, &chunk_start, &newlines_before);
+    const ImWchar* chars = Chars.Data + Chunks[chunk_n].Offset;
+    return newlines_before + TextRopeCountNewlines(chars, chars + pos - chunk_start);
+}
+
+void ImGuiTextRope::InsertChars(int pos, const ImWchar* text, int text_len)
+{
+    IM_ASSERT(pos >= 0 && pos <= TextSize && text_len >= 0);
+    if (text_len == 0)
+        return;
+    if (Chunks.Size == 0)
+    {
+        ImGuiTextRopeChunk chunk;
+        chunk.Offset = TextRopeAllocChunk(this);
+        chunk.Size = chunk.NewlineCount = 0;
+        Chunks.push_back(chunk);
+        TextRopeBuildTrees(this);
+    }
+
+    int chunk_start, newlines_before;
+    const int chunk_n = TextRopeFindChunkAtPos(this, pos, &chunk_start, &newlines_before);
+    const int pos_in_chunk = pos - chunk_start;
+    const int text_newlines = TextRopeCountNewlines(text, text + text_len);
+    {
+        ImGuiTextRopeChunk* chunk = &Chunks[chunk_n];
+        if (chunk->Size + text_len <= TEXT_ROPE_CHUNK_CAPACITY)
+        {
+            // Fast path: insert within the chunk
+            ImWchar* chars = Chars.Data + chunk->Offset;
+            memmove(chars + pos_in_chunk + text_len, chars + pos_in_chunk, (size_t)(chunk->Size - pos_in_chunk) * sizeof(ImWchar));
+            memcpy(chars + pos_in_chunk, text, (size_t)text_len * sizeof(ImWchar));
+            TextRopeAddToChunk(this, chunk_n, text_len, text_newlines);
+            return;
+        }
+    }
+
+    // Split the chunk: keep its head, then write the new text followed by its tail, filling the head up to TEXT_ROPE_CHUNK_FILL then new chunks.
+    ImWchar tail[TEXT_ROPE_CHUNK_CAPACITY];
+    const int tail_len = Chunks[chunk_n].Size - pos_in_chunk;
+    memcpy(tail, Chars.Data + Chunks[chunk_n].Offset + pos_in_chunk, (size_t)tail_len * sizeof(ImWchar));
+    Chunks[chunk_n].Size = pos_in_chunk;
+
+    const int head_room = ImMax(TEXT_ROPE_CHUNK_FILL - pos_in_chunk, 0);
+    const int new_chunks_count = (ImMax(text_len + tail_len - head_room, 0) + TEXT_ROPE_CHUNK_FILL - 1) / TEXT_ROPE_CHUNK_FILL;
+    const int old_chunks_count = Chunks.Size;
+    Chunks.resize(old_chunks_count + new_chunks_count);
+    memmove(Chunks.Data + chunk_n + 1 + new_chunks_count, Chunks.Data + chunk_n + 1, (size_t)(old_chunks_count - chunk_n - 1) * sizeof(ImGuiTextRopeChunk));
+    for (int n = chunk_n + 1; n <= chunk_n + new_chunks_count; n++)
+    {
+        Chunks[n].Offset = TextRopeAllocChunk(this);
+        Chunks[n].Size = 0;
+    }
+
+    int dst_n = chunk_n;
+    for (int src_n = 0; src_n < 2; src_n++)
+    {
+        const ImWchar* src = (src_n == 0) ? text : tail;
+        int src_len = (src_n == 0) ? text_len : tail_len;
+        while (src_len > 0)
+        {
+            ImGuiTextRopeChunk* dst = &Chunks[dst_n];
+            const int copy_count = ImMin(src_len, ImMax(TEXT_ROPE_CHUNK_FILL - dst->Size, 0));
+            if (copy_count == 0)
+            {
+                dst_n++;
+                continue;
+            }
+            memcpy(Chars.Data + dst->Offset + dst->Size, src, (size_t)copy_count * sizeof(ImWchar));
+            dst->Size += copy_count;
+            src += copy_count;
+            src_len -= copy_count;
+        }
+    }
+    for (int n = chunk_n; n <= chunk_n + new_chunks_count; n++)
+        Chunks[n].NewlineCount = TextRopeCountNewlines(Chars.Data + Chunks[n].Offset, Chars.Data + Chunks[n].Offset + Chunks[n].Size);
+    TextSize += text_len;
+    NewlineCount += text_newlines;
+    TextRopeBuildTrees(this);
+}
+
+void ImGuiTextRope::DeleteChars(int pos, int count)
+{
+    IM_ASSERT(pos >= 0 && count >= 0 && pos + count <= TextSize);
+    if (count == 0)
+        return;
+    int chunk_start, newlines_before;
+    const int chunk_n = TextRopeFindChunkAtPos(this, pos, &chunk_start, &newlines_before);
+    const int pos_in_chunk = pos - chunk_start;
+    ImGuiTextRopeChunk* chunk = &Chunks[chunk_n];
+    if (pos_in_chunk + count < chunk->Size)
+    {
+        // Fast path: delete within the chunk
+        ImWchar* chars = Chars.Data + chunk->Offset;
+        const int deleted_newlines = TextRopeCountNewlines(chars + pos_in_chunk, chars + pos_in_chunk + count);
+        memmove(chars + pos_in_chunk, chars + pos_in_chunk + count, (size_t)(chunk->Size - pos_in_chunk - count) * sizeof(ImWchar));
+        TextRopeAddToChunk(this, chunk_n, -count, -deleted_newlines);
+        TextRopeMergeSmallChunk(this, chunk_n);
+        return;
+    }
+
+    // Delete across chunks, then remove the chunks which became empty
+    int remaining = count;
+    for (int n = chunk_n, n_pos = pos_in_chunk; remaining > 0; n++, n_pos = 0)
+    {
+        chunk = &Chunks[n];
+        ImWchar* chars = Chars.Data + chunk->Offset;
+        const int delete_count = ImMin(remaining, chunk->Size - n_pos);
+        const int deleted_newlines = TextRopeCountNewlines(chars + n_pos, chars + n_pos + delete_count);
+        memmove(chars + n_pos, chars + n_pos + delete_count, (size_t)(chunk->Size - n_pos - delete_count) * sizeof(ImWchar));
+        chunk->Size -= delete_count;
+        chunk->NewlineCount -= deleted_newlines;
+        NewlineCount -= deleted_newlines;
+        remaining -= delete_count;
+    }
+    TextSize -= count;
+    int dst_n = 0;
+    for (int n = 0; n < Chunks.Size; n++)
+    {
+        if (Chunks[n].Size == 0)
+            FreeOffsets.push_back(Chunks[n].Offset);
+        else
+            Chunks[dst_n++] = Chunks[n];
+    }
+    Chunks.resize(dst_n);
+    TextRopeBuildTrees(this);
+    TextRopeMergeSmallChunk(this, ImMin(chunk_n, Chunks.Size - 1));
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Widgets: ColorEdit, ColorPicker, ColorButton, etc.
 //-------------------------------------------------------------------------
@@ -5701,6 +6258,7 @@ void ImGui::ColorPickerOptionsPopup(const float* ref_col, ImGuiColorEditFlags fl
 // - TreePush()
 // - TreePop()
 // - GetTreeNodeToLabelSpacing()
+// - ImGuiTreeView
 // - SetNextItemOpen()
 // - CollapsingHeader()
 //-------------------------------------------------------------------------
@@ -6077,6 +6635,133 @@ float ImGui::GetTreeNodeToLabelSpacing()
     return g.FontSize + (g.Style.FramePadding.x * 2.0f);
 }
 
+// ImGuiTreeView: rows of open descendants of 'node', in display order, are appended to 'out'.
+// Hierarchies may be very deep so we use an explicit stack of (node, next_child_n, child_count) triplets instead of recursing.
+static void TreeViewAddDescendantRows(ImGuiTreeView* tree, int node, int depth, ImVector<ImGuiTreeViewRow>& out)
+{
+    ImVector<int>& stack = tree->TempStack;
+    stack.resize(0);
+    stack.push_back(node);
+    stack.push_back(0);
+    stack.push_back(tree->GetChildCount(tree->UserData, node));
+    while (stack.Size > 0)
+    {
+        const int parent = stack[stack.Size - 3];
+        const int child_n = stack[stack.Size - 2]++;
+        if (child_n >= stack[stack.Size - 1])
+        {
+            stack.resize(stack.Size - 3);
+            continue;
+        }
+        ImGuiTreeViewRow row;
+        row.Node = tree->GetChild(tree->UserData, parent, child_n);
+        row.Depth = depth + stack.Size / 3 - 1;
+        const int row_child_count = tree->GetChildCount(tree->UserData, row.Node);
+        if (row_child_count > 0)
+        {
+            const void* ptr_id = (void*)(intptr_t)row.Node;
+            row.IsOpen = tree->Storage->GetInt(ImHashData(&ptr_id, sizeof(void*), tree->IdSeed), 0) != 0; // Same as window->GetID(ptr_id) in TreeNode()
+        }
+        else
+        {
+            row.IsOpen = false;
+        }
+        out.push_back(row);
+        if (row.IsOpen)
+        {
+            stack.push_back(row.Node);
+            stack.push_back(0);
+            stack.push_back(row_child_count);
+        }
+    }
+}
+
+void ImGuiTreeView::Begin()
+{
+    IM_ASSERT(GetChildCount != NULL && GetChild != NULL);
+    IM_ASSERT(Storage == NULL && "Forgot to call End()?");
+    ImGuiWindow* window = ImGui::GetCurrentWindow();
+    Storage = window->DC.StateStorage;
+    IdSeed = window->IDStack.back();
+    ToggledRows.resize(0);
+    if (IsDirty)
+    {
+        Rows.resize(0);
+        TreeViewAddDescendantRows(this, -1, 0, Rows);
+        IsDirty = false;
+    }
+}
+
+void ImGuiTreeView::End()
+{
+    IM_ASSERT(Storage != NULL && "Forgot to call Begin()?");
+
+    // Apply from last to first, so indices of rows toggled before are not affected by rows inserted/removed
+    for (int n = ToggledRows.Size - 1; n >= 0; n--)
+        SetRowOpen(ToggledRows[n], !Rows[ToggledRows[n]].IsOpen);
+    ToggledRows.resize(0);
+    Storage = NULL;
+}
+
+bool ImGuiTreeView::TreeNode(int row_n, const char* label, ImGuiTreeNodeFlags flags)
+{
+    IM_ASSERT(Storage != NULL && "Forgot to call Begin()?");
+    ImGuiWindow* window = ImGui::GetCurrentWindow();
+    if (window->SkipItems)
+        return false;
+
+    const ImGuiTreeViewRow& row = Rows[row_n];
+    flags |= ImGuiTreeNodeFlags_NoTreePushOnOpen | ImGuiTreeNodeFlags_NoAutoOpenOnLog;
+    if (GetChildCount(UserData, row.Node) == 0)
+        flags |= ImGuiTreeNodeFlags_Leaf;
+
+    ImGuiContext& g = *GImGui;
+    const float indent_w = row.Depth * g.Style.IndentSpacing;
+    if (indent_w > 0.0f)
+        ImGui::Indent(indent_w);
+    const bool is_open = ImGui::TreeNodeBehavior(window->GetID((void*)(intptr_t)row.Node), flags, label, NULL);
+    if (indent_w > 0.0f)
+        ImGui::Unindent(indent_w);
+
+    if (!(flags & ImGuiTreeNodeFlags_Leaf) && is_open != row.IsOpen)
+        ToggledRows.push_back(row_n);
+    return is_open;
+}
+
+void ImGuiTreeView::SetRowOpen(int row_n, bool open)
+{
+    IM_ASSERT(Storage != NULL && "Forgot to call Begin()?");
+    const void* ptr_id = (void*)(intptr_t)Rows[row_n].Node;
+    Storage->SetInt(ImHashData(&ptr_id, sizeof(void*), IdSeed), open ? 1 : 0);
+    if (open && GetChildCount(UserData, Rows[row_n].Node) == 0)
+        open = false; // Leaf rows are never open, as in TreeViewAddDescendantRows()
+    if (Rows[row_n].IsOpen == open)
+        return;
+    Rows[row_n].IsOpen = open;
+
+    const int depth = Rows[row_n].Depth;
+    if (open)
+    {
+        // Insert rows of the subtree after this one
+        TempRows.resize(0);
+        TreeViewAddDescendantRows(this, Rows[row_n].Node, depth + 1, TempRows);
+        const int old_size = Rows.Size;
+        Rows.resize(old_size + TempRows.Size);
+        memmove(Rows.Data + row_n + 1 + TempRows.Size, Rows.Data + row_n + 1, (size_t)(old_size - row_n - 1) * sizeof(ImGuiTreeViewRow));
+        if (TempRows.Size > 0)
+            memcpy(Rows.Data + row_n + 1, TempRows.Data, (size_t)TempRows.Size * sizeof(ImGuiTreeViewRow));
+    }
+    else
+    {
+        // Remove rows of the subtree, which are all following rows of greater depth
+        int row_end = row_n + 1;
+        while (row_end < Rows.Size && Rows[row_end].Depth > depth)
+            row_end++;
+        if (row_end > row_n + 1)
+            Rows.erase(Rows.Data + row_n + 1, Rows.Data + row_end);
+    }
+}
+
 // Set next TreeNode/CollapsingHeader open state.
 void ImGui::SetNextItemOpen(bool is_open, ImGuiCond cond)
 {
@@ -2,6 +2,7 @@
 // This is a slightly modified version of stb_textedit.h 1.13.
 // Those changes would need to be pushed into nothings/stb:
 // - Fix in stb_textedit_discard_redo (see https://github.com/nothings/stb/issues/321)
+// - Optional STB_TEXTEDIT_ROWSTART_AT_Y/STB_TEXTEDIT_ROWSTART_BEFORE_CHAR to skip laying out rows before the cursor or mouse
 // Grep for [DEAR IMGUI] to find the changes.
 
 // stb_textedit.h - v1.13  - public domain - Sean Barrett
@@ -171,6 +172,10 @@
 //    STB_TEXTEDIT_K_LINEEND2            secondary keyboard input to move cursor to end of line
 //    STB_TEXTEDIT_K_TEXTSTART2          secondary keyboard input to move cursor to start of text
 //    STB_TEXTEDIT_K_TEXTEND2            secondary keyboard input to move cursor to end of text
+//    STB_TEXTEDIT_ROWSTART_AT_Y(obj,y,&row_y)           [DEAR IMGUI] returns the first char of a row starting at or
+//                                                          above 'y' and writes its y, to skip laying out previous rows
+//    STB_TEXTEDIT_ROWSTART_BEFORE_CHAR(obj,n,&row_y)    [DEAR IMGUI] returns the first char of a row before the row
+//                                                          of character #n (or 0) and writes its y
 //
 // Keyboard input must be encoded as a single integer value; e.g. a character code
 // and some bitflags that represent shift states. to simplify the interface, SHIFT must
@@ -406,6 +411,12 @@ static int stb_text_locate_coord(STB_TEXTEDIT_STRING *str, float x, float y)
    r.ymin = r.ymax = 0;
    r.num_chars = 0;
 
+   // [DEAR IMGUI]
+   // skip rows above 'y' without laying them out
+#ifdef STB_TEXTEDIT_ROWSTART_AT_Y
+   i = STB_TEXTEDIT_ROWSTART_AT_Y(str, y, &base_y);
+#endif
+
    // search rows to find one that straddles 'y'
    while (i < n) {
       STB_TEXTEDIT_LAYOUTROW(&r, str, i);
@@ -533,9 +544,18 @@ static void stb_textedit_find_charpos(StbFindState *find, STB_TEXTEDIT_STRING *s
          find->height = r.ymax - r.ymin;
          find->x = r.x1;
       } else {
+#ifdef STB_TEXTEDIT_ROWSTART_BEFORE_CHAR
+         float row_y;
+#endif
          find->y = 0;
          find->x = 0;
          find->height = 1;
+         // [DEAR IMGUI]
+         // skip rows before the row of the last character without laying them out
+#ifdef STB_TEXTEDIT_ROWSTART_BEFORE_CHAR
+         if (z > 0)
+            i = STB_TEXTEDIT_ROWSTART_BEFORE_CHAR(str, z - 1, &row_y);
+#endif
          while (i < z) {
             STB_TEXTEDIT_LAYOUTROW(&r, str, i);
             prev_start = i;
@@ -551,6 +571,12 @@ static void stb_textedit_find_charpos(StbFindState *find, STB_TEXTEDIT_STRING *s
    // search rows to find the one that straddles character n
    find->y = 0;
 
+   // [DEAR IMGUI]
+   // skip rows before the row of character n without laying them out
+#ifdef STB_TEXTEDIT_ROWSTART_BEFORE_CHAR
+   i = STB_TEXTEDIT_ROWSTART_BEFORE_CHAR(str, n, &find->y);
+#endif
+
    for(;;) {
       STB_TEXTEDIT_LAYOUTROW(&r, str, i);
       if (n < i + r.num_chars)
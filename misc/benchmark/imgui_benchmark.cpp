@@ -0,0 +1,772 @@
+// dear imgui
+// (imgui_benchmark.cpp)
+// Headless benchmark: drives a Dear ImGui context with synthetic inputs and a null renderer (no GPU, no window),
+// and measures CPU cost of a set of standard scenarios so performance can be tracked over time.
+
+// For each scenario we create a fresh context, run some warm-up frames, then measure:
+// - nanoseconds per frame (NewFrame() to Render(), mean/median/min/max)
+// - vertices, indices, draw lists and draw calls of the last frame
+// - allocations and allocated bytes per frame (through ImGui::SetAllocatorFunctions())
+// Micro-benchmarks measure a single operation in a loop, outside of NewFrame()/Render(), and report nanoseconds per operation.
+// Results are written to stdout as JSON. Progress is written to stderr.
+
+// Build with, e.g:
+//   # premake5 (project "ImGuiBenchmark")
+//   # g++ -O2 -I../.. imgui_benchmark.cpp ../../imgui*.cpp -o imgui_benchmark
+//   # g++ -O2 -pthread -DIMGUI_ENABLE_THREAD_LOCAL_CONTEXT -I../.. imgui_benchmark.cpp ../../imgui*.cpp -o imgui_benchmark     (to include "contexts_2_threads")
+// Usage:
+//   imgui_benchmark [-frames <n>] [-warmup <n>] [-filter <substring>] [-list]
+// Usage example:
+//   # imgui_benchmark > results.json
+//   # imgui_benchmark -frames 1000 -filter table
+
+#define _CRT_SECURE_NO_WARNINGS
+#include "imgui.h"
+#include "imgui_internal.h"     // DockBuilderXXX functions
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#ifdef IMGUI_ENABLE_THREAD_LOCAL_CONTEXT
+#include <thread>
+#endif
+
+// Reuse the compressors of binary_to_compressed_c.cpp for the font decompression micro-benchmarks
+#define BINARY_TO_COMPRESSED_C_NO_MAIN
+#include "../fonts/binary_to_compressed_c.cpp"
+
+//-----------------------------------------------------------------------------
+// Allocation tracking
+//-----------------------------------------------------------------------------
+
+struct BenchAllocStats
+{
+    ImU64   AllocCount;
+    ImU64   AllocBytes;
+};
+
+static void* BenchMemAlloc(size_t sz, void* user_data)
+{
+    BenchAllocStats* stats = (BenchAllocStats*)user_data;
+    stats->AllocCount++;
+    stats->AllocBytes += sz;
+    return malloc(sz);
+}
+
+static void BenchMemFree(void* ptr, void* user_data)
+{
+    IM_UNUSED(user_data);
+    free(ptr);
+}
+
+//-----------------------------------------------------------------------------
+// Scenarios
+//-----------------------------------------------------------------------------
+
+static const ImVec2 BENCH_DISPLAY_SIZE(1920.0f, 1080.0f);
+
+// Fullscreen window without decorations, used as a container by most scenarios
+static bool BeginFullscreenWindow(const char* name, ImGuiWindowFlags extra_flags = 0)
+{
+    ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+    ImGui::SetNextWindowSize(BENCH_DISPLAY_SIZE);
+    return ImGui::Begin(name, NULL, ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_NoMove | extra_flags);
+}
+
+// 10k small windows laid out in a grid (window management, sorting, hovering, draw list per window)
+static void Scenario_Windows10k(int frame)
+{
+    IM_UNUSED(frame);
+    const int count = 10000;
+    const int columns = 100;
+    const ImVec2 size(BENCH_DISPLAY_SIZE.x / columns, BENCH_DISPLAY_SIZE.y / (count / columns));
+    char name[32];
+    for (int n = 0; n < count; n++)
+    {
+        snprintf(name, IM_ARRAYSIZE(name), "Window %05d", n);
+        ImGui::SetNextWindowPos(ImVec2((n % columns) * size.x, (n / columns) * size.y));
+        ImGui::SetNextWindowSize(ImVec2(size.x * 2.0f, size.y * 4.0f));
+        ImGui::Begin(name, NULL, ImGuiWindowFlags_NoSavedSettings);
+        ImGui::Text("Hello %d", n);
+        ImGui::End();
+    }
+}
+
+// 100k rows table with vertical scrolling, using ImGuiListClipper. The mouse wheel scrolls every frame.
+static void Scenario_Table100kClipped(int frame)
+{
+    IM_UNUSED(frame);
+    BeginFullscreenWindow("Table");
+    const ImGuiTableFlags flags = ImGuiTableFlags_ScrollY | ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders | ImGuiTableFlags_Resizable | ImGuiTableFlags_Reorderable | ImGuiTableFlags_Hideable;
+    if (ImGui::BeginTable("##table", 4, flags))
+    {
+        ImGui::TableSetupScrollFreeze(0, 1);
+        ImGui::TableSetupColumn("ID");
+        ImGui::TableSetupColumn("Name");
+        ImGui::TableSetupColumn("Value");
+        ImGui::TableSetupColumn("Progress");
+        ImGui::TableHeadersRow();
+        ImGuiListClipper clipper;
+        clipper.Begin(100000);
+        while (clipper.Step())
+            for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++)
+            {
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn(); ImGui::Text("%06d", row);
+                ImGui::TableNextColumn(); ImGui::Text("Item %d", row * 7);
+                ImGui::TableNextColumn(); ImGui::Text("%.3f", row * 0.001f);
+                ImGui::TableNextColumn(); ImGui::ProgressBar((row % 100) / 100.0f, ImVec2(-FLT_MIN, 0.0f));
+            }
+        ImGui::EndTable();
+    }
+    ImGui::End();
+}
+
+// 100 columns table sorted on all columns at once (more than 64 sort specs), 10k rows sorted with ImGuiTableSorter and displayed with ImGuiListClipper.
+// Keys have few distinct values so ties are resolved by the next columns. Every 10 frames the sort direction of a column is flipped.
+static const int    BENCH_MULTISORT_COLUMNS = 100;
+static const int    BENCH_MULTISORT_ROWS = 10000;
+static int          BenchMultiSortKeys[BENCH_MULTISORT_ROWS][BENCH_MULTISORT_COLUMNS];
+
+static void Scenario_Table100ColumnsMultiSort(int frame)
+{
+    static ImGuiTableSorter sorter;
+    if (frame == 0)
+    {
+        sorter = ImGuiTableSorter();
+        for (int row = 0; row < BENCH_MULTISORT_ROWS; row++)
+            for (int column = 0; column < BENCH_MULTISORT_COLUMNS; column++)
+                BenchMultiSortKeys[row][column] = (int)((((ImU32)row * 2654435761u) >> (column % 24)) % (ImU32)(2 + column % 3));
+        for (int column = 0; column < BENCH_MULTISORT_COLUMNS; column++)
+            sorter.SetColumnKeys(column, ImGuiDataType_S32, &BenchMultiSortKeys[0][column], sizeof(BenchMultiSortKeys[0]));
+    }
+
+    BeginFullscreenWindow("Table");
+    const ImGuiTableFlags flags = ImGuiTableFlags_Sortable | ImGuiTableFlags_SortMulti | ImGuiTableFlags_ScrollX | ImGuiTableFlags_ScrollY | ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders;
+    if (ImGui::BeginTable("##table", BENCH_MULTISORT_COLUMNS, flags))
+    {
+        char name[32];
+        ImGui::TableSetupScrollFreeze(0, 1);
+        for (int column = 0; column < BENCH_MULTISORT_COLUMNS; column++)
+        {
+            snprintf(name, IM_ARRAYSIZE(name), "C%02d", column);
+            ImGui::TableSetupColumn(name, ImGuiTableColumnFlags_DefaultSort | ImGuiTableColumnFlags_WidthFixed, 40.0f);
+        }
+        if (frame % 10 == 9)
+        {
+            const int column = (frame / 10) % BENCH_MULTISORT_COLUMNS;
+            const ImGuiSortDirection sort_direction = ImGui::GetCurrentTable()->Columns[column].SortDirection;
+            ImGui::TableSetColumnSortDirection(column, sort_direction == ImGuiSortDirection_Ascending ? ImGuiSortDirection_Descending : ImGuiSortDirection_Ascending, true);
+        }
+        ImGuiTableSortSpecs* sort_specs = ImGui::TableGetSortSpecs();
+        IM_ASSERT(sort_specs != NULL && sort_specs->SpecsCount == BENCH_MULTISORT_COLUMNS);
+        for (int n = 0; n < sort_specs->SpecsCount; n++)
+            IM_ASSERT(sort_specs->Specs[n].SortOrder == n);
+        sorter.Sort(sort_specs, BENCH_MULTISORT_ROWS);
+        ImGui::TableHeadersRow();
+
+        ImGuiListClipper clipper;
+        clipper.Begin(BENCH_MULTISORT_ROWS);
+        while (clipper.Step())
+            for (int row_n = clipper.DisplayStart; row_n < clipper.DisplayEnd; row_n++)
+            {
+                const int row = sorter.Indices[row_n];
+                ImGui::TableNextRow();
+                for (int column = 0; column < BENCH_MULTISORT_COLUMNS; column++)
+                    if (ImGui::TableNextColumn())
+                        ImGui::Text("%d", BenchMultiSortKeys[row][column]);
+            }
+        ImGui::EndTable();
+    }
+    ImGui::End();
+}
+
+// A full screen of unformatted and formatted text (glyph lookup, text layout, vertex generation)
+static void Scenario_TextFullscreen(int frame)
+{
+    static const char* line = "The quick brown fox jumps over the lazy dog. 0123456789 !\"#$%&'()*+,-./:;<=>?@[\\]^_`{|}~ "
+                              "Pack my box with five dozen liquor jugs. How vexingly quick daft zebras jump! Sphinx of black quartz, judge my vow.";
+    BeginFullscreenWindow("Text");
+    const int line_count = (int)(BENCH_DISPLAY_SIZE.y / ImGui::GetTextLineHeightWithSpacing());
+    for (int n = 0; n < line_count; n++)
+    {
+        if (n & 1)
+            ImGui::Text("%04d %d %s", n, frame, line);
+        else
+            ImGui::TextUnformatted(line);
+    }
+    ImGui::End();
+}
+
+// Deep docking tree: a dockspace recursively split BENCH_DOCK_DEPTH times, with 2 tabbed windows in each leaf node
+static const int BENCH_DOCK_DEPTH = 7;
+
+static void BenchDockSplit(ImGuiID node_id, int depth, int* window_n)
+{
+    char name[32];
+    if (depth == 0)
+    {
+        for (int n = 0; n < 2; n++)
+        {
+            snprintf(name, IM_ARRAYSIZE(name), "Dock %04d", (*window_n)++);
+            ImGui::DockBuilderDockWindow(name, node_id);
+        }
+        return;
+    }
+    ImGuiID id_at_dir, id_at_opposite;
+    ImGui::DockBuilderSplitNode(node_id, (depth & 1) ? ImGuiDir_Left : ImGuiDir_Up, 0.5f, &id_at_dir, &id_at_opposite);
+    BenchDockSplit(id_at_dir, depth - 1, window_n);
+    BenchDockSplit(id_at_opposite, depth - 1, window_n);
+}
+
+static void Scenario_DockingDeep(int frame)
+{
+    BeginFullscreenWindow("DockHost", ImGuiWindowFlags_NoDocking | ImGuiWindowFlags_NoBringToFrontOnFocus);
+    ImGuiID dockspace_id = ImGui::GetID("DockSpace");
+    int window_count = 0;
+    if (frame == 0)
+    {
+        ImGui::DockBuilderRemoveNode(dockspace_id);
+        ImGui::DockBuilderAddNode(dockspace_id, ImGuiDockNodeFlags_DockSpace);
+        ImGui::DockBuilderSetNodeSize(dockspace_id, BENCH_DISPLAY_SIZE);
+        BenchDockSplit(dockspace_id, BENCH_DOCK_DEPTH, &window_count);
+        ImGui::DockBuilderFinish(dockspace_id);
+    }
+    ImGui::DockSpace(dockspace_id);
+    ImGui::End();
+
+    char name[32];
+    for (int n = 0; n < (2 << BENCH_DOCK_DEPTH); n++)
+    {
+        snprintf(name, IM_ARRAYSIZE(name), "Dock %04d", n);
+        ImGui::Begin(name);
+        ImGui::Text("Docked window %d", n);
+        ImGui::Button("Button");
+        ImGui::End();
+    }
+}
+
+// 1k small plots, all visible
+static void Scenario_Plots1k(int frame)
+{
+    static float values[128];
+    for (int n = 0; n < IM_ARRAYSIZE(values); n++)
+        values[n] = ImSin((n + frame) * 0.1f) * ImCos(n * 0.03f);
+    BeginFullscreenWindow("Plots");
+    const int columns = 25;
+    const ImVec2 plot_size(BENCH_DISPLAY_SIZE.x / columns - ImGui::GetStyle().ItemSpacing.x - 1.0f, 20.0f);
+    for (int n = 0; n < 1000; n++)
+    {
+        if (n % columns != 0)
+            ImGui::SameLine();
+        ImGui::PushID(n);
+        ImGui::PlotLines("##plot", values, IM_ARRAYSIZE(values), n % IM_ARRAYSIZE(values), NULL, -1.0f, 1.0f, plot_size);
+        ImGui::PopID();
+    }
+    ImGui::End();
+}
+
+// Active InputTextMultiline() with a large buffer, receiving typed characters every frame
+static char         BenchInputTextBuf[1024 * 1024];
+
+static void Scenario_InputTextMultiline(int frame)
+{
+    if (frame == 0)
+    {
+        char* p = BenchInputTextBuf;
+        for (int n = 0; n < 10000; n++)
+            p += sprintf(p, "%05d: Lorem ipsum dolor sit amet, consectetur adipiscing elit.\n", n);
+    }
+    BeginFullscreenWindow("InputText");
+    if (frame == 0)
+        ImGui::SetKeyboardFocusHere();
+    ImGui::InputTextMultiline("##text", BenchInputTextBuf, IM_ARRAYSIZE(BenchInputTextBuf), ImVec2(-FLT_MIN, -FLT_MIN));
+    ImGui::End();
+
+    // Type for next frame
+    ImGuiIO& io = ImGui::GetIO();
+    io.AddInputCharacter((frame % 40) == 39 ? '\n' : 'a' + (frame % 26));
+}
+
+struct BenchScenario
+{
+    const char*     Name;
+    void            (*Func)(int frame);
+    bool            Docking;
+    bool            MouseWheel;
+};
+
+static const BenchScenario BenchScenarios[] =
+{
+    { "windows_10k",            Scenario_Windows10k,            false, false },
+    { "table_100k_clipped",     Scenario_Table100kClipped,      false, true  },
+    { "table_100_columns_multisort", Scenario_Table100ColumnsMultiSort, false, true },
+    { "text_fullscreen",        Scenario_TextFullscreen,        false, false },
+    { "docking_deep",           Scenario_DockingDeep,           true,  false },
+    { "plots_1k",               Scenario_Plots1k,               false, false },
+    { "input_text_multiline",   Scenario_InputTextMultiline,    false, false },
+};
+
+//-----------------------------------------------------------------------------
+// Micro-benchmarks
+//-----------------------------------------------------------------------------
+
+typedef std::chrono::steady_clock BenchClock;
+
+static double BenchGetElapsedNs(BenchClock::time_point t0)
+{
+    return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(BenchClock::now() - t0).count();
+}
+
+struct BenchMicroResult
+{
+    int             Ops;            // Number of operations measured
+    double          Ns;             // Total time
+    const char*     Error;          // Set when a check failed
+};
+
+// Uncompressed TTF data of the default font (ProggyClean), compressed in both formats supported by ImFontAtlas
+struct BenchFontData
+{
+    ImVector<unsigned char> TTF;
+    ImVector<unsigned char> CompressedSTB;
+    ImVector<unsigned char> CompressedLZ4;
+
+    BenchFontData()
+    {
+        ImFontAtlas atlas;
+        atlas.AddFontDefault();
+        const ImFontConfig& cfg = atlas.ConfigData[0];
+        TTF.resize(cfg.FontDataSize);
+        memcpy(TTF.Data, cfg.FontData, (size_t)cfg.FontDataSize);
+        CompressedSTB.resize(TTF.Size * 2 + 256);
+        CompressedSTB.resize((int)stb_compress(CompressedSTB.Data, TTF.Data, (stb_uint)TTF.Size));
+        CompressedLZ4.resize(lz4_compress_bound(TTF.Size));
+        CompressedLZ4.resize(lz4_compress(CompressedLZ4.Data, TTF.Data, TTF.Size));
+    }
+};
+
+static void Micro_FontCompressLZ4(BenchMicroResult* out)
+{
+    BenchFontData font;
+    ImVector<unsigned char> compressed;
+    compressed.resize(lz4_compress_bound(font.TTF.Size));
+    BenchClock::time_point t0 = BenchClock::now();
+    for (out->Ops = 0; out->Ops < 20; out->Ops++)
+        lz4_compress(compressed.Data, font.TTF.Data, font.TTF.Size);
+    out->Ns = BenchGetElapsedNs(t0);
+}
+
+static void Micro_FontDecompress(BenchMicroResult* out, bool lz4)
+{
+    BenchFontData font;
+    ImFontAtlas atlas;
+    BenchClock::time_point t0 = BenchClock::now();
+    for (out->Ops = 0; out->Ops < 500; out->Ops++)
+    {
+        ImFont* f = lz4 ? atlas.AddFontFromMemoryCompressedLZ4TTF(font.CompressedLZ4.Data, font.CompressedLZ4.Size, 13.0f) : atlas.AddFontFromMemoryCompressedTTF(font.CompressedSTB.Data, font.CompressedSTB.Size, 13.0f);
+        if (f == NULL || atlas.ConfigData[0].FontDataSize != font.TTF.Size || memcmp(atlas.ConfigData[0].FontData, font.TTF.Data, (size_t)font.TTF.Size) != 0)
+            out->Error = "decompressed data doesn't match";
+        atlas.Clear();
+    }
+    out->Ns = BenchGetElapsedNs(t0);
+}
+static void Micro_FontDecompressLZ4(BenchMicroResult* out) { Micro_FontDecompress(out, true); }
+static void Micro_FontDecompressSTB(BenchMicroResult* out) { Micro_FontDecompress(out, false); }
+
+// ImGuiStorage lookups of existing keys in a storage of 'count' pairs (keys are hashed IDs as used by windows/widgets)
+static void Micro_StorageLookup(BenchMicroResult* out, int count)
+{
+    ImGuiStorage storage;
+    for (int n = 0; n < count; n++)
+        storage.SetInt(ImHashData(&n, sizeof(n)), n);
+    const int lookups = 2000000;
+    unsigned int rng = 1;
+    int errors = 0;
+    BenchClock::time_point t0 = BenchClock::now();
+    for (out->Ops = 0; out->Ops < lookups; out->Ops++)
+    {
+        rng = rng * 1664525u + 1013904223u;
+        const int n = (int)((rng >> 8) % (unsigned int)count);
+        if (storage.GetInt(ImHashData(&n, sizeof(n)), -1) != n)
+            errors++;
+    }
+    out->Ns = BenchGetElapsedNs(t0);
+    if (errors > 0)
+        out->Error = "lookup returned a wrong value";
+}
+static void Micro_StorageLookup1k(BenchMicroResult* out)    { Micro_StorageLookup(out, 1000); }
+static void Micro_StorageLookup100k(BenchMicroResult* out)  { Micro_StorageLookup(out, 100000); }
+static void Micro_StorageLookup1M(BenchMicroResult* out)    { Micro_StorageLookup(out, 1000000); }
+
+// ImGuiStorage insertion of 1M new keys
+static void Micro_StorageInsert1M(BenchMicroResult* out)
+{
+    ImGuiStorage storage;
+    BenchClock::time_point t0 = BenchClock::now();
+    for (out->Ops = 0; out->Ops < 1000000; out->Ops++)
+        storage.SetInt(ImHashData(&out->Ops, sizeof(out->Ops)), out->Ops);
+    out->Ns = BenchGetElapsedNs(t0);
+}
+
+// Results of benchmarked computations are stored here so the compiler can't optimize them away
+static volatile ImU32 BenchSink = 0;
+
+// Reference lookup table versions of ImHashData()/ImHashStr(), to compare against the ARMv8 CRC32 path (IMGUI_ENABLE_ARM_CRC32).
+// When the ARM path is not compiled in, ImHashData()/ImHashStr() use the same lookup table algorithm.
+static ImU32 BenchCrc32Table[256];
+
+static void BenchBuildCrc32Table()
+{
+    for (ImU32 n = 0; n < 256; n++)
+    {
+        ImU32 crc = n;
+        for (int bit = 0; bit < 8; bit++)
+            crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320 : (crc >> 1);
+        BenchCrc32Table[n] = crc;
+    }
+}
+
+static ImGuiID BenchHashDataTable(const void* data_p, size_t data_size, ImU32 seed)
+{
+    ImU32 crc = ~seed;
+    const unsigned char* data = (const unsigned char*)data_p;
+    while (data_size-- != 0)
+        crc = (crc >> 8) ^ BenchCrc32Table[(crc & 0xFF) ^ *data++];
+    return ~crc;
+}
+
+static ImGuiID BenchHashStrTable(const char* data_p, ImU32 seed)
+{
+    seed = ~seed;
+    ImU32 crc = seed;
+    const unsigned char* data = (const unsigned char*)data_p;
+    while (unsigned char c = *data++)
+    {
+        if (c == '#' && data[0] == '#' && data[1] == '#')
+            crc = seed;
+        crc = (crc >> 8) ^ BenchCrc32Table[(crc & 0xFF) ^ c];
+    }
+    return ~crc;
+}
+
+// Hash typical widget labels (4 to 40 characters, a few using "###"), as PushID()/GetID() do.
+static void Micro_HashStr(BenchMicroResult* out, bool use_table)
+{
+    BenchBuildCrc32Table();
+    const int label_count = 1024;
+    ImVector<char> labels_buf;
+    labels_buf.resize(label_count * 48);
+    unsigned int rng = 1;
+    for (int n = 0; n < label_count; n++)
+    {
+        rng = rng * 1664525u + 1013904223u;
+        char* label = &labels_buf[n * 48];
+        if ((rng >> 8) % 8 == 0)
+            snprintf(label, 48, "Label %d###id%d", n, (int)((rng >> 12) % 100));
+        else
+            snprintf(label, 48, "%.*s %d", (int)((rng >> 8) % 32), "Some Widget Label With Some Text", n);
+    }
+    ImGuiID acc = 0;
+    BenchClock::time_point t0 = BenchClock::now();
+    for (out->Ops = 0; out->Ops < 2000000; out->Ops++)
+    {
+        const char* label = &labels_buf[(out->Ops % label_count) * 48];
+        acc += use_table ? BenchHashStrTable(label, 0x1234) : ImHashStr(label, 0, 0x1234);
+    }
+    out->Ns = BenchGetElapsedNs(t0);
+    for (int n = 0; n < label_count; n++)
+        if (ImHashStr(&labels_buf[n * 48], 0, 0x1234) != BenchHashStrTable(&labels_buf[n * 48], 0x1234))
+            out->Error = "ImHashStr() doesn't match the lookup table version";
+    BenchSink = acc;
+}
+static void Micro_HashStr(BenchMicroResult* out)         { Micro_HashStr(out, false); }
+static void Micro_HashStrTable(BenchMicroResult* out)    { Micro_HashStr(out, true); }
+
+// Hash 4 KB blocks
+static void Micro_HashData4K(BenchMicroResult* out, bool use_table)
+{
+    BenchBuildCrc32Table();
+    ImVector<unsigned char> data;
+    data.resize(4096);
+    for (int n = 0; n < data.Size; n++)
+        data[n] = (unsigned char)(n * 7 + (n >> 5));
+    ImGuiID acc = 0;
+    BenchClock::time_point t0 = BenchClock::now();
+    for (out->Ops = 0; out->Ops < 20000; out->Ops++)
+        acc += use_table ? BenchHashDataTable(data.Data, (size_t)data.Size, (ImU32)out->Ops) : ImHashData(data.Data, (size_t)data.Size, (ImU32)out->Ops);
+    out->Ns = BenchGetElapsedNs(t0);
+    for (int size = 0; size <= 64; size++)
+        if (ImHashData(data.Data, (size_t)size, 0x1234) != BenchHashDataTable(data.Data, (size_t)size, 0x1234))
+            out->Error = "ImHashData() doesn't match the lookup table version";
+    BenchSink = acc;
+}
+static void Micro_HashData4K(BenchMicroResult* out)      { Micro_HashData4K(out, false); }
+static void Micro_HashData4KTable(BenchMicroResult* out) { Micro_HashData4K(out, true); }
+
+#ifdef IMGUI_ENABLE_THREAD_LOCAL_CONTEXT
+// Smoke test for IMGUI_ENABLE_THREAD_LOCAL_CONTEXT: two threads each run their own context (with its own font atlas) concurrently.
+// Each thread must produce the same draw data as a context running alone on the main thread. Also worth running under ThreadSanitizer.
+struct BenchThreadContext
+{
+    int             Frames;
+    ImGuiID         DrawDataHash;   // Hash of vertices and indices of the last frame
+};
+
+static void BenchThreadContextRun(BenchThreadContext* data)
+{
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.DisplaySize = BENCH_DISPLAY_SIZE;
+    io.DeltaTime = 1.0f / 60.0f;
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;
+    unsigned char* tex_pixels = NULL;
+    int tex_w, tex_h;
+    io.Fonts->GetTexDataAsAlpha8(&tex_pixels, &tex_w, &tex_h);
+    io.Fonts->SetTexID((ImTextureID)(intptr_t)1);
+    for (int frame = 0; frame < data->Frames; frame++)
+    {
+        const float t = frame * 0.05f;
+        io.AddMousePosEvent(BENCH_DISPLAY_SIZE.x * (0.5f + ImCos(t) * 0.25f), BENCH_DISPLAY_SIZE.y * (0.5f + ImSin(t) * 0.25f));
+        io.AddMouseWheelEvent(0.0f, (frame % 100) < 50 ? -5.0f : +5.0f);
+        ImGui::NewFrame();
+        Scenario_Table100kClipped(frame);
+        Scenario_TextFullscreen(frame);
+        ImGui::Render();
+    }
+    ImDrawData* draw_data = ImGui::GetDrawData();
+    ImGuiID hash = 0;
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+    {
+        const ImDrawList* draw_list = draw_data->CmdLists[n];
+        hash = ImHashData(draw_list->VtxBuffer.Data, (size_t)draw_list->VtxBuffer.size_in_bytes(), hash);
+        hash = ImHashData(draw_list->IdxBuffer.Data, (size_t)draw_list->IdxBuffer.size_in_bytes(), hash);
+    }
+    data->DrawDataHash = hash;
+    ImGui::DestroyContext();
+}
+
+static void Micro_Contexts2Threads(BenchMicroResult* out)
+{
+    ImGuiContext* backup_ctx = ImGui::GetCurrentContext();
+    BenchThreadContext reference = { 200, 0 };
+    BenchThreadContextRun(&reference);
+
+    BenchThreadContext data[2] = { { 200, 0 }, { 200, 0 } };
+    BenchClock::time_point t0 = BenchClock::now();
+    std::thread thread_a(BenchThreadContextRun, &data[0]);
+    std::thread thread_b(BenchThreadContextRun, &data[1]);
+    thread_a.join();
+    thread_b.join();
+    out->Ns = BenchGetElapsedNs(t0);
+    out->Ops = data[0].Frames + data[1].Frames;
+    if (data[0].DrawDataHash != reference.DrawDataHash || data[1].DrawDataHash != reference.DrawDataHash)
+        out->Error = "draw data differs from single-threaded run";
+    ImGui::SetCurrentContext(backup_ctx);
+}
+#endif
+
+struct BenchMicro
+{
+    const char*     Name;
+    void            (*Func)(BenchMicroResult* out);
+};
+
+static const BenchMicro BenchMicros[] =
+{
+    { "font_compress_lz4",      Micro_FontCompressLZ4 },
+    { "font_decompress_lz4",    Micro_FontDecompressLZ4 },  // AddFontFromMemoryCompressedLZ4TTF()
+    { "font_decompress_stb",    Micro_FontDecompressSTB },  // AddFontFromMemoryCompressedTTF(), for comparison
+    { "storage_lookup_1k",      Micro_StorageLookup1k },    // Lookup cost includes hashing the key with ImHashData()
+    { "storage_lookup_100k",    Micro_StorageLookup100k },
+    { "storage_lookup_1m",      Micro_StorageLookup1M },
+    { "storage_insert_1m",      Micro_StorageInsert1M },
+    { "hash_str",               Micro_HashStr },            // ImHashStr(), using ARMv8 CRC32 instructions when available (see "arm_crc32" in output)
+    { "hash_str_table",         Micro_HashStrTable },       // Lookup table version, for comparison
+    { "hash_data_4k",           Micro_HashData4K },         // ImHashData()
+    { "hash_data_4k_table",     Micro_HashData4KTable },
+#ifdef IMGUI_ENABLE_THREAD_LOCAL_CONTEXT
+    { "contexts_2_threads",     Micro_Contexts2Threads },   // Op is a frame. Smoke test for IMGUI_ENABLE_THREAD_LOCAL_CONTEXT.
+#endif
+};
+
+//-----------------------------------------------------------------------------
+// Runner
+//-----------------------------------------------------------------------------
+
+struct BenchResult
+{
+    double  NsMean, NsMedian, NsMin, NsMax;
+    int     Vertices, Indices, DrawLists, DrawCalls;
+    double  AllocsPerFrame, AllocBytesPerFrame;
+};
+
+static int CompareDouble(const void* lhs, const void* rhs)
+{
+    const double a = *(const double*)lhs, b = *(const double*)rhs;
+    return (a < b) ? -1 : (a > b) ? +1 : 0;
+}
+
+static void RunScenario(const BenchScenario& scenario, int warmup_frames, int measured_frames, BenchResult* out)
+{
+    BenchAllocStats alloc_stats = { 0, 0 };
+    ImGuiMemAllocFunc prev_alloc_func;
+    ImGuiMemFreeFunc prev_free_func;
+    void* prev_user_data;
+    ImGui::GetAllocatorFunctions(&prev_alloc_func, &prev_free_func, &prev_user_data);
+    ImGui::SetAllocatorFunctions(BenchMemAlloc, BenchMemFree, &alloc_stats);
+    ImGui::CreateContext();
+
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.DisplaySize = BENCH_DISPLAY_SIZE;
+    io.DeltaTime = 1.0f / 60.0f;
+    io.BackendRendererName = "imgui_benchmark_null";
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // Large draw lists are fine since we don't render them
+    if (scenario.Docking)
+        io.ConfigFlags |= ImGuiConfigFlags_DockingEnable;
+
+    // Null renderer: build the atlas and give it a dummy texture identifier
+    unsigned char* tex_pixels = NULL;
+    int tex_w, tex_h;
+    io.Fonts->GetTexDataAsAlpha8(&tex_pixels, &tex_w, &tex_h);
+    io.Fonts->SetTexID((ImTextureID)(intptr_t)1);
+
+    ImVector<double> frame_ns;
+    frame_ns.reserve(measured_frames);
+    ImU64 alloc_count_start = 0, alloc_bytes_start = 0;
+    const int total_frames = warmup_frames + measured_frames;
+    for (int frame = 0; frame < total_frames; frame++)
+    {
+        if (frame == warmup_frames)
+        {
+            alloc_count_start = alloc_stats.AllocCount;
+            alloc_bytes_start = alloc_stats.AllocBytes;
+        }
+
+        // Synthetic inputs: mouse moving in a circle around the center of the screen, optional scrolling
+        const float t = frame * 0.05f;
+        io.AddMousePosEvent(BENCH_DISPLAY_SIZE.x * (0.5f + ImCos(t) * 0.25f), BENCH_DISPLAY_SIZE.y * (0.5f + ImSin(t) * 0.25f));
+        if (scenario.MouseWheel)
+            io.AddMouseWheelEvent(0.0f, (frame % 400) < 200 ? -5.0f : +5.0f);
+
+        std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+        ImGui::NewFrame();
+        scenario.Func(frame);
+        ImGui::Render();
+        std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
+        if (frame >= warmup_frames)
+            frame_ns.push_back((double)std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count());
+    }
+
+    // Last frame output
+    ImDrawData* draw_data = ImGui::GetDrawData();
+    out->Vertices = draw_data->TotalVtxCount;
+    out->Indices = draw_data->TotalIdxCount;
+    out->DrawLists = draw_data->CmdListsCount;
+    out->DrawCalls = 0;
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+        out->DrawCalls += draw_data->CmdLists[n]->CmdBuffer.Size;
+
+    out->AllocsPerFrame = (double)(alloc_stats.AllocCount - alloc_count_start) / measured_frames;
+    out->AllocBytesPerFrame = (double)(alloc_stats.AllocBytes - alloc_bytes_start) / measured_frames;
+
+    double ns_total = 0.0;
+    for (int n = 0; n < frame_ns.Size; n++)
+        ns_total += frame_ns[n];
+    qsort(frame_ns.Data, (size_t)frame_ns.Size, sizeof(double), CompareDouble);
+    out->NsMean = ns_total / frame_ns.Size;
+    out->NsMedian = frame_ns[frame_ns.Size / 2];
+    out->NsMin = frame_ns.front();
+    out->NsMax = frame_ns.back();
+
+    frame_ns.clear();
+    ImGui::DestroyContext();
+    ImGui::SetAllocatorFunctions(prev_alloc_func, prev_free_func, prev_user_data);
+}
+
+int main(int argc, char** argv)
+{
+    int measured_frames = 300;
+    int warmup_frames = 30;
+    const char* filter = NULL;
+    for (int argn = 1; argn < argc; argn++)
+    {
+        if (strcmp(argv[argn], "-frames") == 0 && argn + 1 < argc)
+            measured_frames = atoi(argv[++argn]);
+        else if (strcmp(argv[argn], "-warmup") == 0 && argn + 1 < argc)
+            warmup_frames = atoi(argv[++argn]);
+        else if (strcmp(argv[argn], "-filter") == 0 && argn + 1 < argc)
+            filter = argv[++argn];
+        else if (strcmp(argv[argn], "-list") == 0)
+        {
+            for (int n = 0; n < IM_ARRAYSIZE(BenchScenarios); n++)
+                printf("%s\n", BenchScenarios[n].Name);
+            for (int n = 0; n < IM_ARRAYSIZE(BenchMicros); n++)
+                printf("%s\n", BenchMicros[n].Name);
+            return 0;
+        }
+        else
+        {
+            printf("Syntax: %s [-frames <n>] [-warmup <n>] [-filter <substring>] [-list]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (measured_frames < 1)
+        measured_frames = 1;
+    if (warmup_frames < 0)
+        warmup_frames = 0;
+
+    printf("{\n");
+    printf("  \"imgui_version\": \"%s\",\n", IMGUI_VERSION);
+    printf("  \"imgui_version_num\": %d,\n", IMGUI_VERSION_NUM);
+#ifdef IMGUI_ENABLE_ARM_CRC32
+    printf("  \"arm_crc32\": true,\n");
+#else
+    printf("  \"arm_crc32\": false,\n");
+#endif
+    printf("  \"warmup_frames\": %d,\n", warmup_frames);
+    printf("  \"measured_frames\": %d,\n", measured_frames);
+    printf("  \"scenarios\": [");
+    bool first = true;
+    for (int n = 0; n < IM_ARRAYSIZE(BenchScenarios); n++)
+    {
+        const BenchScenario& scenario = BenchScenarios[n];
+        if (filter && strstr(scenario.Name, filter) == NULL)
+            continue;
+        fprintf(stderr, "Running '%s'...\n", scenario.Name);
+        BenchResult r;
+        RunScenario(scenario, warmup_frames, measured_frames, &r);
+        printf("%s\n    { \"name\": \"%s\", \"ns_per_frame_mean\": %.0f, \"ns_per_frame_median\": %.0f, \"ns_per_frame_min\": %.0f, \"ns_per_frame_max\": %.0f, "
+            "\"vertices\": %d, \"indices\": %d, \"draw_lists\": %d, \"draw_calls\": %d, \"allocs_per_frame\": %.2f, \"alloc_bytes_per_frame\": %.0f }",
+            first ? "" : ",", scenario.Name, r.NsMean, r.NsMedian, r.NsMin, r.NsMax,
+            r.Vertices, r.Indices, r.DrawLists, r.DrawCalls, r.AllocsPerFrame, r.AllocBytesPerFrame);
+        fflush(stdout);
+        first = false;
+    }
+    printf("\n  ],\n");
+
+    printf("  \"micro\": [");
+    first = true;
+    bool has_error = false;
+    for (int n = 0; n < IM_ARRAYSIZE(BenchMicros); n++)
+    {
+        const BenchMicro& micro = BenchMicros[n];
+        if (filter && strstr(micro.Name, filter) == NULL)
+            continue;
+        fprintf(stderr, "Running '%s'...\n", micro.Name);
+        BenchMicroResult r = { 0, 0.0, NULL };
+        micro.Func(&r);
+        printf("%s\n    { \"name\": \"%s\", \"ops\": %d, \"ns_per_op\": %.1f%s%s%s }",
+            first ? "" : ",", micro.Name, r.Ops, r.Ops > 0 ? r.Ns / r.Ops : 0.0,
+            r.Error ? ", \"error\": \"" : "", r.Error ? r.Error : "", r.Error ? "\"" : "");
+        if (r.Error)
+            fprintf(stderr, "'%s' failed: %s\n", micro.Name, r.Error);
+        fflush(stdout);
+        has_error |= (r.Error != NULL);
+        first = false;
+    }
+    printf("\n  ]\n}\n");
+    return has_error ? 1 : 0;
+}
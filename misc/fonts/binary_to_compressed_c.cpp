@@ -7,6 +7,8 @@
 // (If we used 32-bit constants it would require take 11 bytes of source code to encode 4 bytes, and be endianness dependent)
 // Note that even with compression, the output array is likely to be bigger than the binary file..
 // Load compressed TTF fonts with ImGui::GetIO().Fonts->AddFontFromMemoryCompressedTTF()
+// With -lz4 the data is compressed in the LZ4 block format instead, which is slightly larger but decompresses many times faster.
+// Load those with ImGui::GetIO().Fonts->AddFontFromMemoryCompressedLZ4TTF(). (-lz4 cannot be combined with -base85)
 
 // Build with, e.g:
 //   # cl.exe binary_to_compressed_c.cpp
@@ -15,10 +17,12 @@
 // You can also find a precompiled Windows binary in the binary/demo package available from https://github.com/ocornut/imgui
 
 // Usage:
-//   binary_to_compressed_c.exe [-base85] [-nocompress] [-nostatic] <inputfile> <symbolname>
+//   binary_to_compressed_c.exe [-base85] [-lz4] [-nocompress] [-nostatic] <inputfile> <symbolname>
 // Usage example:
 //   # binary_to_compressed_c.exe myfont.ttf MyFont > myfont.cpp
 //   # binary_to_compressed_c.exe -base85 myfont.ttf MyFont > myfont.cpp
+//   # binary_to_compressed_c.exe -lz4 myfont.ttf MyFont > myfont.cpp
+// Define BINARY_TO_COMPRESSED_C_NO_MAIN before including this file to only use the compressors from another program (e.g. misc/benchmark/imgui_benchmark.cpp).
 
 #define _CRT_SECURE_NO_WARNINGS
 #include <stdio.h>
@@ -31,23 +35,30 @@ typedef unsigned int stb_uint;
 typedef unsigned char stb_uchar;
 stb_uint stb_compress(stb_uchar* out, stb_uchar* in, stb_uint len);
 
-static bool binary_to_compressed_c(const char* filename, const char* symbol, bool use_base85_encoding, bool use_compression, bool use_static);
+// LZ4 block compressor - declaration
+static int lz4_compress(unsigned char* out, const unsigned char* in, int len);
+static int lz4_compress_bound(int len) { return 8 + len + len / 255 + 16; }
+
+#ifndef BINARY_TO_COMPRESSED_C_NO_MAIN
+static bool binary_to_compressed_c(const char* filename, const char* symbol, bool use_base85_encoding, bool use_compression, bool use_lz4, bool use_static);
 
 int main(int argc, char** argv)
 {
     if (argc < 3)
     {
-        printf("Syntax: %s [-base85] [-nocompress] [-nostatic] <inputfile> <symbolname>\n", argv[0]);
+        printf("Syntax: %s [-base85] [-lz4] [-nocompress] [-nostatic] <inputfile> <symbolname>\n", argv[0]);
         return 0;
     }
 
     int argn = 1;
     bool use_base85_encoding = false;
     bool use_compression = true;
+    bool use_lz4 = false;
     bool use_static = true;
     while (argn < (argc - 2) && argv[argn][0] == '-')
     {
         if (strcmp(argv[argn], "-base85") == 0) { use_base85_encoding = true; argn++; }
+        else if (strcmp(argv[argn], "-lz4") == 0) { use_lz4 = true; argn++; }
         else if (strcmp(argv[argn], "-nocompress") == 0) { use_compression = false; argn++; }
         else if (strcmp(argv[argn], "-nostatic") == 0) { use_static = false; argn++; }
         else
@@ -57,7 +68,13 @@ int main(int argc, char** argv)
         }
     }
 
-    bool ret = binary_to_compressed_c(argv[argn], argv[argn + 1], use_base85_encoding, use_compression, use_static);
+    if (use_lz4 && (use_base85_encoding || !use_compression))
+    {
+        fprintf(stderr, "-lz4 cannot be combined with -base85 or -nocompress\n");
+        return 1;
+    }
+
+    bool ret = binary_to_compressed_c(argv[argn], argv[argn + 1], use_base85_encoding, use_compression, use_lz4, use_static);
     if (!ret)
         fprintf(stderr, "Error opening or reading file: '%s'\n", argv[argn]);
     return ret ? 0 : 1;
@@ -69,7 +86,7 @@ char Encode85Byte(unsigned int x)
     return (char)((x >= '\\') ? x + 1 : x);
 }
 
-bool binary_to_compressed_c(const char* filename, const char* symbol, bool use_base85_encoding, bool use_compression, bool use_static)
+bool binary_to_compressed_c(const char* filename, const char* symbol, bool use_base85_encoding, bool use_compression, bool use_lz4, bool use_static)
 {
     // Read file
     FILE* f = fopen(filename, "rb");
@@ -83,15 +100,17 @@ bool binary_to_compressed_c(const char* filename, const char* symbol, bool use_b
 
     // Compress
     int maxlen = data_sz + 512 + (data_sz >> 2) + sizeof(int); // total guess
+    if (use_lz4 && maxlen < lz4_compress_bound(data_sz) + 4)
+        maxlen = lz4_compress_bound(data_sz) + 4;
     char* compressed = use_compression ? new char[maxlen] : data;
-    int compressed_sz = use_compression ? stb_compress((stb_uchar*)compressed, (stb_uchar*)data, data_sz) : data_sz;
+    int compressed_sz = !use_compression ? data_sz : use_lz4 ? lz4_compress((unsigned char*)compressed, (const unsigned char*)data, data_sz) : stb_compress((stb_uchar*)compressed, (stb_uchar*)data, data_sz);
     if (use_compression)
         memset(compressed + compressed_sz, 0, maxlen - compressed_sz);
 
     // Output as Base85 encoded
     FILE* out = stdout;
     fprintf(out, "// File: '%s' (%d bytes)\n", filename, (int)data_sz);
-    fprintf(out, "// Exported using binary_to_compressed_c.cpp\n");
+    fprintf(out, "// Exported using binary_to_compressed_c.cpp%s\n", use_lz4 ? " (LZ4 format: load with AddFontFromMemoryCompressedLZ4TTF)" : "");
     const char* static_str = use_static ? "static " : "";
     const char* compressed_str = use_compression ? "compressed_" : "";
     if (use_base85_encoding)
@@ -135,6 +154,7 @@ bool binary_to_compressed_c(const char* filename, const char* symbol, bool use_b
         delete[] compressed;
     return true;
 }
+#endif // #ifndef BINARY_TO_COMPRESSED_C_NO_MAIN
 
 // stb_compress* from stb.h - definition
 
@@ -386,3 +406,106 @@ stb_uint stb_compress(stb_uchar *out, stb_uchar *input, stb_uint length)
 
     return (stb_uint)(stb__out - out);
 }
+
+// LZ4 block compressor - definition
+// Output: 'I','L','Z','4' + decompressed size (little-endian 32-bit) + a single block in the standard LZ4 block format.
+// This runs offline so we favor compression ratio: hash chains over the whole 64 KB window, greedy parsing.
+
+#define LZ4_MIN_MATCH       4
+#define LZ4_LAST_LITERALS   5       // The last 5 bytes of a block are always literals
+#define LZ4_MF_LIMIT        12      // The last match must start at least 12 bytes before the end of a block
+#define LZ4_MAX_DISTANCE    65535
+#define LZ4_HASH_LOG        16
+#define LZ4_CHAIN_DEPTH     512
+
+static unsigned int lz4_hash(const unsigned char* p)
+{
+    unsigned int v = (unsigned int)p[0] | ((unsigned int)p[1] << 8) | ((unsigned int)p[2] << 16) | ((unsigned int)p[3] << 24);
+    return (v * 2654435761u) >> (32 - LZ4_HASH_LOG);
+}
+
+static unsigned char* lz4_write_length(unsigned char* op, int len)
+{
+    for (; len >= 255; len -= 255)
+        *op++ = 255;
+    *op++ = (unsigned char)len;
+    return op;
+}
+
+static unsigned char* lz4_write_sequence(unsigned char* op, const unsigned char* literals, int literal_len, int offset, int match_len)
+{
+    unsigned char* token = op++;
+    *token = (unsigned char)((literal_len >= 15 ? 15 : literal_len) << 4);
+    if (literal_len >= 15)
+        op = lz4_write_length(op, literal_len - 15);
+    memcpy(op, literals, literal_len);
+    op += literal_len;
+    if (match_len == 0)
+        return op; // Last sequence
+    *op++ = (unsigned char)(offset & 0xFF);
+    *op++ = (unsigned char)(offset >> 8);
+    match_len -= LZ4_MIN_MATCH;
+    *token |= (unsigned char)(match_len >= 15 ? 15 : match_len);
+    if (match_len >= 15)
+        op = lz4_write_length(op, match_len - 15);
+    return op;
+}
+
+static int lz4_compress(unsigned char* out, const unsigned char* in, int len)
+{
+    unsigned char* op = out;
+    *op++ = 'I'; *op++ = 'L'; *op++ = 'Z'; *op++ = '4';
+    *op++ = (unsigned char)(len >> 0); *op++ = (unsigned char)(len >> 8); *op++ = (unsigned char)(len >> 16); *op++ = (unsigned char)(len >> 24);
+
+    int* head = new int[1 << LZ4_HASH_LOG];
+    int* chain = new int[LZ4_MAX_DISTANCE + 1];
+    for (int n = 0; n < (1 << LZ4_HASH_LOG); n++)
+        head[n] = -1;
+
+    const int match_start_limit = len - LZ4_MF_LIMIT;
+    const int match_end_limit = len - LZ4_LAST_LITERALS;
+    int anchor = 0;
+    int pos = 0;
+    while (pos < match_start_limit)
+    {
+        // Find longest match in window
+        const unsigned int h = lz4_hash(in + pos);
+        int best_len = 0, best_offset = 0;
+        for (int candidate = head[h], depth = 0; candidate >= 0 && pos - candidate <= LZ4_MAX_DISTANCE && depth < LZ4_CHAIN_DEPTH; candidate = chain[candidate & LZ4_MAX_DISTANCE], depth++)
+        {
+            int match_len = 0;
+            while (pos + match_len < match_end_limit && in[candidate + match_len] == in[pos + match_len])
+                match_len++;
+            if (match_len > best_len)
+            {
+                best_len = match_len;
+                best_offset = pos - candidate;
+            }
+        }
+
+        if (best_len < LZ4_MIN_MATCH)
+        {
+            chain[pos & LZ4_MAX_DISTANCE] = head[h];
+            head[h] = pos;
+            pos++;
+            continue;
+        }
+
+        op = lz4_write_sequence(op, in + anchor, pos - anchor, best_offset, best_len);
+        for (int end = pos + best_len; pos < end; pos++)
+        {
+            if (pos < match_start_limit)
+            {
+                const unsigned int hp = lz4_hash(in + pos);
+                chain[pos & LZ4_MAX_DISTANCE] = head[hp];
+                head[hp] = pos;
+            }
+        }
+        anchor = pos;
+    }
+    op = lz4_write_sequence(op, in + anchor, len - anchor, 0, 0);
+
+    delete[] head;
+    delete[] chain;
+    return (int)(op - out);
+}
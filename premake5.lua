@@ -42,3 +42,47 @@ project "ImGui"
 		runtime "Release"
 		optimize "on"
         symbols "off"
+
+project "ImGuiBenchmark"
+	kind "ConsoleApp"
+	language "C++"
+	staticruntime "off"
+
+	targetdir ("bin/" .. outputdir .. "/%{prj.name}")
+	objdir ("bin-int/" .. outputdir .. "/%{prj.name}")
+
+	files
+	{
+		"misc/benchmark/imgui_benchmark.cpp"
+	}
+
+	includedirs
+	{
+		"."
+	}
+
+	links
+	{
+		"ImGui"
+	}
+
+	filter "system:windows"
+		systemversion "latest"
+		cppdialect "C++17"
+
+	filter "system:linux"
+		systemversion "latest"
+		cppdialect "C++17"
+
+	filter "configurations:Debug"
+		runtime "Debug"
+		symbols "on"
+
+	filter "configurations:Release"
+		runtime "Release"
+		optimize "on"
+
+	filter "configurations:Dist"
+		runtime "Release"
+		optimize "on"
+		symbols "off"